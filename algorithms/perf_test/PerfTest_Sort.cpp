@@ -0,0 +1,143 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Sort.hpp>
+#include <benchmark/benchmark.h>
+#include "Benchmark_Context.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+
+namespace Test {
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+
+// Fills the View with a fixed pseudo-random sequence so that every run sorts
+// the same input.
+template <class T>
+void fill_keys(Kokkos::View<T*, ExecSpace> const& keys) {
+  Kokkos::parallel_for(
+      "fill_keys", Kokkos::RangePolicy<ExecSpace>(0, keys.extent(0)),
+      KOKKOS_LAMBDA(std::size_t i) {
+        std::uint64_t x = i + 0x9e3779b97f4a7c15ull;
+        x               = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x               = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        x ^= x >> 31;
+        if constexpr (std::is_floating_point_v<T>) {
+          keys(i) = T(x >> 11) * T(0x1.0p-53) - T(0.5);
+        } else {
+          keys(i) = static_cast<T>(x);
+        }
+      });
+  Kokkos::fence();
+}
+
+// Reports the View throughput together with the sorted keys per second.
+template <class T>
+void report_sort(benchmark::State& state,
+                 Kokkos::View<T*, ExecSpace> const& keys, int data_ratio,
+                 double time) {
+  KokkosBenchmark::report_results(state, keys, data_ratio, time);
+  state.counters[KokkosBenchmark::benchmark_fom("Mkeys/s")] =
+      benchmark::Counter(keys.extent(0) / 1e6,
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <class T>
+static void Sort_Radix(benchmark::State& state) {
+  Kokkos::View<T*, ExecSpace> keys(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "keys"), state.range(0));
+
+  for (auto _ : state) {
+    fill_keys(keys);
+    Kokkos::Timer timer;
+    Kokkos::sort(ExecSpace(), keys);
+    ExecSpace().fence();
+    report_sort(state, keys, 1, timer.seconds());
+  }
+}
+
+template <class T>
+static void Sort_Comparator(benchmark::State& state) {
+  Kokkos::View<T*, ExecSpace> keys(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "keys"), state.range(0));
+
+  for (auto _ : state) {
+    fill_keys(keys);
+    Kokkos::Timer timer;
+    Kokkos::sort(ExecSpace(), keys, std::greater<T>());
+    ExecSpace().fence();
+    report_sort(state, keys, 1, timer.seconds());
+  }
+}
+
+template <class T>
+static void SortByKey_Radix(benchmark::State& state) {
+  Kokkos::View<T*, ExecSpace> keys(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "keys"), state.range(0));
+  Kokkos::View<T*, ExecSpace> values(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "values"),
+      state.range(0));
+
+  for (auto _ : state) {
+    fill_keys(keys);
+    Kokkos::Timer timer;
+    Kokkos::Experimental::sort_by_key(ExecSpace(), keys, values);
+    ExecSpace().fence();
+    report_sort(state, keys, 2, timer.seconds());
+  }
+}
+
+// Serial std::sort as the baseline the parallel sorts have to beat.
+template <class T>
+static void Sort_StdSort(benchmark::State& state) {
+  Kokkos::View<T*, ExecSpace> keys(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "keys"), state.range(0));
+
+  for (auto _ : state) {
+    fill_keys(keys);
+    Kokkos::Timer timer;
+    std::sort(keys.data(), keys.data() + keys.extent(0));
+    report_sort(state, keys, 1, timer.seconds());
+  }
+}
+
+#define KOKKOS_SORT_BENCHMARK(NAME, TYPE, MAX_N) \
+  BENCHMARK(NAME<TYPE>)                         \
+      ->ArgName("N")                            \
+      ->RangeMultiplier(10)                     \
+      ->Range(100'000, MAX_N)                   \
+      ->Unit(benchmark::kMillisecond)           \
+      ->UseManualTime()
+
+// Sorting 1e9 32-bit keys needs 8 GB for the keys and the radix sort buffer.
+// The other variants stop at 1e8 keys to keep the memory footprint of a full
+// benchmark run within that.
+KOKKOS_SORT_BENCHMARK(Sort_Radix, std::uint32_t, 1'000'000'000);
+KOKKOS_SORT_BENCHMARK(Sort_Radix, std::int64_t, 100'000'000);
+KOKKOS_SORT_BENCHMARK(Sort_Radix, float, 100'000'000);
+KOKKOS_SORT_BENCHMARK(Sort_Radix, double, 100'000'000);
+KOKKOS_SORT_BENCHMARK(Sort_Comparator, std::uint32_t, 100'000'000);
+KOKKOS_SORT_BENCHMARK(Sort_Comparator, double, 100'000'000);
+KOKKOS_SORT_BENCHMARK(SortByKey_Radix, std::uint32_t, 100'000'000);
+KOKKOS_SORT_BENCHMARK(Sort_StdSort, std::uint32_t, 100'000'000);
+KOKKOS_SORT_BENCHMARK(Sort_StdSort, double, 100'000'000);
+
+#undef KOKKOS_SORT_BENCHMARK
+
+}  // namespace Test
@@ -0,0 +1,625 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_Random.hpp
+/// \brief Counter-based random number generation.
+///
+/// Random_Philox4x32 is the Philox-4x32-10 generator of Salmon et al.,
+/// "Parallel Random Numbers: As Easy as 1, 2, 3" (SC'11). Its output is a
+/// pure function of a 64-bit seed, a 64-bit stream id and the position in
+/// the stream, so a kernel can construct a generator from (seed, iteration
+/// index) and draw from it without any per-thread state. The results then do
+/// not depend on the number of threads.
+///
+/// Random_Philox4x32_Pool hands out one stream per UniqueToken value for
+/// kernels that want a generator which carries on where the previous kernel
+/// on the same token stopped, and fill_random fills a View from a seed and a
+/// distribution.
+
+#ifndef KOKKOS_RANDOM_HPP
+#define KOKKOS_RANDOM_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_RANDOM
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+// Multipliers and Weyl key increments of Philox-4x32.
+inline constexpr std::uint32_t philox_m0 = 0xD2511F53;
+inline constexpr std::uint32_t philox_m1 = 0xCD9E8D57;
+inline constexpr std::uint32_t philox_w0 = 0x9E3779B9;
+inline constexpr std::uint32_t philox_w1 = 0xBB67AE85;
+
+KOKKOS_FORCEINLINE_FUNCTION
+void philox4x32_round(std::uint32_t& c0, std::uint32_t& c1, std::uint32_t& c2,
+                      std::uint32_t& c3, std::uint32_t k0, std::uint32_t k1) {
+  std::uint64_t const p0 = std::uint64_t(philox_m0) * c0;
+  std::uint64_t const p1 = std::uint64_t(philox_m1) * c2;
+  c0                     = std::uint32_t(p1 >> 32) ^ c1 ^ k0;
+  c1                     = std::uint32_t(p1);
+  c2                     = std::uint32_t(p0 >> 32) ^ c3 ^ k1;
+  c3                     = std::uint32_t(p0);
+}
+
+/// \brief Philox-4x32-10: maps the 128-bit counter to 128 random bits under
+///   the 64-bit key.
+KOKKOS_INLINE_FUNCTION
+Kokkos::Array<std::uint32_t, 4> philox4x32_10(
+    Kokkos::Array<std::uint32_t, 4> ctr, Kokkos::Array<std::uint32_t, 2> key) {
+  std::uint32_t k0 = key[0];
+  std::uint32_t k1 = key[1];
+  for (int round = 0; round < 10; ++round) {
+    if (round != 0) {
+      k0 += philox_w0;
+      k1 += philox_w1;
+    }
+    philox4x32_round(ctr[0], ctr[1], ctr[2], ctr[3], k0, k1);
+  }
+  return ctr;
+}
+
+// Block `block` of stream `stream` under `seed`.
+KOKKOS_FORCEINLINE_FUNCTION
+Kokkos::Array<std::uint32_t, 4> philox_block(std::uint64_t seed,
+                                             std::uint64_t stream,
+                                             std::uint64_t block) {
+  return philox4x32_10(
+      {std::uint32_t(block), std::uint32_t(block >> 32), std::uint32_t(stream),
+       std::uint32_t(stream >> 32)},
+      {std::uint32_t(seed), std::uint32_t(seed >> 32)});
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+std::uint64_t random_bits64(std::uint32_t lo, std::uint32_t hi) {
+  return std::uint64_t(hi) << 32 | lo;
+}
+
+// Uniform in [0, 1) from the upper 53 or 24 bits.
+KOKKOS_FORCEINLINE_FUNCTION
+double random_unit_double(std::uint64_t bits) {
+  return double(bits >> 11) * 0x1.0p-53;
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+float random_unit_float(std::uint32_t bits) {
+  return float(bits >> 8) * 0x1.0p-24f;
+}
+
+// Uniform in (0, 1], so that its logarithm is finite.
+KOKKOS_FORCEINLINE_FUNCTION
+double random_open_unit_double(std::uint64_t bits) {
+  return double((bits >> 11) + 1) * 0x1.0p-53;
+}
+
+// Uniform in [0, range) by Lemire's multiply-shift; the bias is at most
+// range / 2^32 (resp. range / 2^64).
+KOKKOS_FORCEINLINE_FUNCTION
+std::uint32_t random_below(std::uint32_t bits, std::uint32_t range) {
+  return std::uint32_t((std::uint64_t(bits) * range) >> 32);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+std::uint64_t random_below(std::uint64_t bits, std::uint64_t range) {
+  std::uint64_t const b_lo = std::uint32_t(bits), b_hi = bits >> 32;
+  std::uint64_t const r_lo = std::uint32_t(range), r_hi = range >> 32;
+  std::uint64_t const mid  = b_hi * r_lo + ((b_lo * r_lo) >> 32);
+  return b_hi * r_hi + (mid >> 32) +
+         ((std::uint32_t(mid) + b_lo * r_hi) >> 32);
+}
+
+}  // namespace Impl
+
+/// \brief Philox-4x32-10 generator positioned in one stream of a seed.
+///
+/// The stream is the sequence of 32-bit words of the Philox blocks with
+/// counters (0, stream), (1, stream), ... Constructing the generator costs
+/// nothing; the first draw computes a block.
+class Random_Philox4x32 {
+ public:
+  /// \brief The generator at 32-bit word \c position of \c stream of
+  ///   \c seed.
+  KOKKOS_FUNCTION
+  Random_Philox4x32(std::uint64_t seed, std::uint64_t stream,
+                    std::uint64_t position = 0)
+      : m_seed(seed), m_stream(stream), m_position(position) {}
+
+  KOKKOS_FUNCTION std::uint64_t seed() const { return m_seed; }
+  KOKKOS_FUNCTION std::uint64_t stream() const { return m_stream; }
+
+  /// \brief The number of 32-bit words drawn from the start of the stream.
+  KOKKOS_FUNCTION std::uint64_t position() const { return m_position; }
+
+  KOKKOS_FUNCTION void discard(std::uint64_t count) { m_position += count; }
+
+  KOKKOS_FUNCTION std::uint32_t urand() {
+    std::uint64_t const block = m_position / 4;
+    if (!m_cached || block != m_cached_block) {
+      m_block        = Impl::philox_block(m_seed, m_stream, block);
+      m_cached_block = block;
+      m_cached       = true;
+    }
+    return m_block[m_position++ % 4];
+  }
+
+  /// \brief The next two words, the first one as the low half.
+  KOKKOS_FUNCTION std::uint64_t urand64() {
+    std::uint32_t const lo = urand();
+    return Impl::random_bits64(lo, urand());
+  }
+
+  /// \brief Uniform in [0, range).
+  KOKKOS_FUNCTION std::uint32_t urand(std::uint32_t range) {
+    return Impl::random_below(urand(), range);
+  }
+
+  /// \brief Uniform in [start, end).
+  KOKKOS_FUNCTION std::uint32_t urand(std::uint32_t start, std::uint32_t end) {
+    return start + urand(end - start);
+  }
+
+  KOKKOS_FUNCTION std::uint64_t urand64(std::uint64_t range) {
+    return Impl::random_below(urand64(), range);
+  }
+
+  KOKKOS_FUNCTION std::uint64_t urand64(std::uint64_t start,
+                                        std::uint64_t end) {
+    return start + urand64(end - start);
+  }
+
+  /// \brief Uniform in [0, 1).
+  KOKKOS_FUNCTION float frand() { return Impl::random_unit_float(urand()); }
+
+  KOKKOS_FUNCTION float frand(float range) { return range * frand(); }
+
+  KOKKOS_FUNCTION float frand(float start, float end) {
+    return start + (end - start) * frand();
+  }
+
+  /// \brief Uniform in [0, 1).
+  KOKKOS_FUNCTION double drand() {
+    return Impl::random_unit_double(urand64());
+  }
+
+  KOKKOS_FUNCTION double drand(double range) { return range * drand(); }
+
+  KOKKOS_FUNCTION double drand(double start, double end) {
+    return start + (end - start) * drand();
+  }
+
+  /// \brief Standard normal by the Box-Muller transform; draws four words.
+  KOKKOS_FUNCTION double normal() {
+    double const u1 = Impl::random_open_unit_double(urand64());
+    double const u2 = drand();
+    return Kokkos::sqrt(-2.0 * Kokkos::log(u1)) *
+           Kokkos::cos(2.0 * Kokkos::numbers::pi * u2);
+  }
+
+  KOKKOS_FUNCTION double normal(double mean, double std_dev) {
+    return mean + std_dev * normal();
+  }
+
+ private:
+  std::uint64_t m_seed;
+  std::uint64_t m_stream;
+  std::uint64_t m_position;
+  std::uint64_t m_cached_block            = 0;
+  Kokkos::Array<std::uint32_t, 4> m_block = {};
+  bool m_cached                           = false;
+};
+
+/// \brief Pool of Random_Philox4x32 streams, one per UniqueToken value.
+///
+/// get_state() acquires a token and returns the generator of its stream at
+/// the position where the last free_state() on that token left it, so the
+/// pool keeps 8 bytes of state per concurrent thread. Which thread gets
+/// which stream depends on the scheduling; kernels that need results that do
+/// not depend on the thread count should construct Random_Philox4x32 from the
+/// iteration index instead. The pool uses the streams with the top bit set,
+/// which keeps them apart from index-keyed streams of the same seed.
+template <class DeviceType = Kokkos::DefaultExecutionSpace>
+class Random_Philox4x32_Pool {
+ public:
+  using generator_type  = Random_Philox4x32;
+  using device_type     = typename DeviceType::device_type;
+  using execution_space = typename device_type::execution_space;
+  using memory_space    = typename device_type::memory_space;
+
+ private:
+  using token_type = Kokkos::Experimental::UniqueToken<
+      execution_space, Kokkos::Experimental::UniqueTokenScope::Global>;
+  using size_type = typename token_type::size_type;
+
+  static constexpr std::uint64_t pool_stream = std::uint64_t(1) << 63;
+
+ public:
+  Random_Philox4x32_Pool() = default;
+
+  explicit Random_Philox4x32_Pool(std::uint64_t seed,
+                                  execution_space const& exec =
+                                      execution_space())
+      : m_seed(seed),
+        m_tokens(exec),
+        m_positions("Kokkos::Random_Philox4x32_Pool::positions",
+                    m_tokens.size()) {}
+
+  KOKKOS_FUNCTION size_type num_states() const { return m_tokens.size(); }
+
+  KOKKOS_FUNCTION generator_type get_state() const {
+    size_type const token = m_tokens.acquire();
+    return generator_type(m_seed, pool_stream | token, m_positions(token));
+  }
+
+  KOKKOS_FUNCTION void free_state(generator_type const& generator) const {
+    auto const token   = size_type(generator.stream() & ~pool_stream);
+    m_positions(token) = generator.position();
+    m_tokens.release(token);
+  }
+
+ private:
+  std::uint64_t m_seed = 0;
+  token_type m_tokens;
+  Kokkos::View<std::uint64_t*, device_type> m_positions;
+};
+
+/// \brief Integers uniformly distributed on the closed interval [a, b].
+template <class T = int>
+class uniform_int_distribution {
+  static_assert(std::is_integral_v<T> && sizeof(T) <= 8,
+                "Kokkos::uniform_int_distribution requires an integer type");
+
+ public:
+  using result_type = T;
+  using bits_type =
+      std::conditional_t<sizeof(T) <= 4, std::uint32_t, std::uint64_t>;
+
+  KOKKOS_FUNCTION explicit uniform_int_distribution(
+      T a = 0, T b = Kokkos::Experimental::finite_max_v<T>)
+      : m_a(a), m_b(b) {}
+
+  KOKKOS_FUNCTION T a() const { return m_a; }
+  KOKKOS_FUNCTION T b() const { return m_b; }
+
+  /// \brief The number drawn from \c bits, which holds one or two words.
+  KOKKOS_FUNCTION T from_bits(bits_type bits) const {
+    // The range wraps to zero when [a, b] covers all of bits_type.
+    bits_type const range = bits_type(bits_type(m_b) - bits_type(m_a) + 1);
+    return T(bits_type(m_a) +
+             (range == 0 ? bits : Impl::random_below(bits, range)));
+  }
+
+  template <class Generator>
+  KOKKOS_FUNCTION T operator()(Generator& generator) const {
+    if constexpr (sizeof(bits_type) == 4) {
+      return from_bits(generator.urand());
+    } else {
+      return from_bits(generator.urand64());
+    }
+  }
+
+ private:
+  T m_a;
+  T m_b;
+};
+
+/// \brief Reals uniformly distributed on [a, b).
+template <class T = double>
+class uniform_real_distribution {
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                "Kokkos::uniform_real_distribution requires float or double");
+
+ public:
+  using result_type = T;
+
+  KOKKOS_FUNCTION explicit uniform_real_distribution(T a = 0, T b = 1)
+      : m_a(a), m_b(b) {}
+
+  KOKKOS_FUNCTION T a() const { return m_a; }
+  KOKKOS_FUNCTION T b() const { return m_b; }
+
+  KOKKOS_FUNCTION T from_unit(T u) const { return m_a + (m_b - m_a) * u; }
+
+  template <class Generator>
+  KOKKOS_FUNCTION T operator()(Generator& generator) const {
+    if constexpr (std::is_same_v<T, float>) {
+      return from_unit(generator.frand());
+    } else {
+      return from_unit(generator.drand());
+    }
+  }
+
+ private:
+  T m_a;
+  T m_b;
+};
+
+/// \brief Normally distributed reals.
+template <class T = double>
+class normal_distribution {
+  static_assert(std::is_same_v<T, float> || std::is_same_v<T, double>,
+                "Kokkos::normal_distribution requires float or double");
+
+ public:
+  using result_type = T;
+
+  KOKKOS_FUNCTION explicit normal_distribution(T mean = 0, T stddev = 1)
+      : m_mean(mean), m_stddev(stddev) {}
+
+  KOKKOS_FUNCTION T mean() const { return m_mean; }
+  KOKKOS_FUNCTION T stddev() const { return m_stddev; }
+
+  template <class Generator>
+  KOKKOS_FUNCTION T operator()(Generator& generator) const {
+    return T(generator.normal(m_mean, m_stddev));
+  }
+
+ private:
+  T m_mean;
+  T m_stddev;
+};
+
+namespace Impl {
+
+// fill_random cuts the stream 0 of the seed into Philox blocks and turns
+// each block into values_per_block values. The uniform distributions use
+// every word once, in order, so that the View holds exactly the sequence
+// distribution(generator) yields for Random_Philox4x32(seed, 0). The normal
+// distribution uses both outputs of each Box-Muller pair.
+template <class Distribution>
+struct RandomFill;
+
+template <class T>
+struct RandomFill<uniform_int_distribution<T>> {
+  using bits_type = typename uniform_int_distribution<T>::bits_type;
+  static constexpr int values_per_block = 4 / (sizeof(bits_type) / 4);
+
+  KOKKOS_FUNCTION static void from_block(
+      uniform_int_distribution<T> const& dist,
+      Kokkos::Array<std::uint32_t, 4> const& block, T* out) {
+    if constexpr (values_per_block == 4) {
+      for (int k = 0; k < 4; ++k) out[k] = dist.from_bits(block[k]);
+    } else {
+      out[0] = dist.from_bits(random_bits64(block[0], block[1]));
+      out[1] = dist.from_bits(random_bits64(block[2], block[3]));
+    }
+  }
+};
+
+template <class T>
+struct RandomFill<uniform_real_distribution<T>> {
+  static constexpr int values_per_block = std::is_same_v<T, float> ? 4 : 2;
+
+  KOKKOS_FUNCTION static void from_block(
+      uniform_real_distribution<T> const& dist,
+      Kokkos::Array<std::uint32_t, 4> const& block, T* out) {
+    if constexpr (values_per_block == 4) {
+      for (int k = 0; k < 4; ++k) {
+        out[k] = dist.from_unit(random_unit_float(block[k]));
+      }
+    } else {
+      out[0] = dist.from_unit(
+          random_unit_double(random_bits64(block[0], block[1])));
+      out[1] = dist.from_unit(
+          random_unit_double(random_bits64(block[2], block[3])));
+    }
+  }
+};
+
+// A Box-Muller pair takes two 64-bit uniforms for double and two 32-bit
+// uniforms for float, so a block makes one pair for double and two for
+// float.
+template <class T>
+struct RandomFill<normal_distribution<T>> {
+  static constexpr int values_per_block = std::is_same_v<T, float> ? 4 : 2;
+  static constexpr int pairs_per_block  = values_per_block / 2;
+
+  KOKKOS_FUNCTION static void pair_uniforms(
+      Kokkos::Array<std::uint32_t, 4> const& block, int pair, double& u1,
+      double& u2) {
+    if constexpr (pairs_per_block == 1) {
+      u1 = random_open_unit_double(random_bits64(block[0], block[1]));
+      u2 = random_unit_double(random_bits64(block[2], block[3]));
+    } else {
+      u1 = (double(block[2 * pair]) + 1.0) * 0x1.0p-32;
+      u2 = double(block[2 * pair + 1]) * 0x1.0p-32;
+    }
+  }
+
+  KOKKOS_FUNCTION static void from_block(
+      normal_distribution<T> const& dist,
+      Kokkos::Array<std::uint32_t, 4> const& block, T* out) {
+    for (int pair = 0; pair < pairs_per_block; ++pair) {
+      double u1, u2;
+      pair_uniforms(block, pair, u1, u2);
+      double const r     = Kokkos::sqrt(-2.0 * Kokkos::log(u1));
+      double const theta = 2.0 * Kokkos::numbers::pi * u2;
+      out[2 * pair] = T(dist.mean() + dist.stddev() * r * Kokkos::cos(theta));
+      out[2 * pair + 1] =
+          T(dist.mean() + dist.stddev() * r * Kokkos::sin(theta));
+    }
+  }
+};
+
+// Number of Philox blocks a host thread generates at a time. The rounds and
+// the conversions run over the whole batch in structure-of-arrays loops that
+// the compiler vectorizes.
+inline constexpr int random_fill_batch_blocks = 64;
+
+template <class Distribution, class T>
+void random_fill_host_batch(Distribution const& dist, std::uint64_t seed,
+                            std::uint64_t first_block, T* out) {
+  using fill_type      = RandomFill<Distribution>;
+  constexpr int blocks = random_fill_batch_blocks;
+
+  std::uint32_t c0[blocks], c1[blocks], c2[blocks], c3[blocks];
+  for (int b = 0; b < blocks; ++b) {
+    std::uint64_t const block = first_block + b;
+    c0[b]                     = std::uint32_t(block);
+    c1[b]                     = std::uint32_t(block >> 32);
+    c2[b]                     = 0;
+    c3[b]                     = 0;
+  }
+  std::uint32_t k0 = std::uint32_t(seed);
+  std::uint32_t k1 = std::uint32_t(seed >> 32);
+  for (int round = 0; round < 10; ++round) {
+    if (round != 0) {
+      k0 += philox_w0;
+      k1 += philox_w1;
+    }
+    for (int b = 0; b < blocks; ++b) {
+      philox4x32_round(c0[b], c1[b], c2[b], c3[b], k0, k1);
+    }
+  }
+
+  if constexpr (std::is_same_v<Distribution, normal_distribution<T>>) {
+    using simd_type     = Kokkos::Experimental::native_simd<double>;
+    using tag_type      = Kokkos::Experimental::element_aligned_tag;
+    constexpr int pairs = blocks * fill_type::pairs_per_block;
+    static_assert(pairs % simd_type::size() == 0);
+
+    double u1[pairs], u2[pairs];
+    for (int b = 0; b < blocks; ++b) {
+      Kokkos::Array<std::uint32_t, 4> const block = {c0[b], c1[b], c2[b],
+                                                     c3[b]};
+      for (int pair = 0; pair < fill_type::pairs_per_block; ++pair) {
+        int const p = b * fill_type::pairs_per_block + pair;
+        fill_type::pair_uniforms(block, pair, u1[p], u2[p]);
+      }
+    }
+    simd_type const mean(double(dist.mean()));
+    simd_type const stddev(double(dist.stddev()));
+    for (int p = 0; p < pairs; p += simd_type::size()) {
+      simd_type x1, x2;
+      x1.copy_from(u1 + p, tag_type());
+      x2.copy_from(u2 + p, tag_type());
+      simd_type const r     = Kokkos::sqrt(simd_type(-2.0) * Kokkos::log(x1));
+      simd_type const theta = simd_type(2.0 * Kokkos::numbers::pi) * x2;
+      (mean + stddev * r * Kokkos::cos(theta)).copy_to(u1 + p, tag_type());
+      (mean + stddev * r * Kokkos::sin(theta)).copy_to(u2 + p, tag_type());
+    }
+    for (int p = 0; p < pairs; ++p) {
+      out[2 * p]     = T(u1[p]);
+      out[2 * p + 1] = T(u2[p]);
+    }
+  } else {
+    for (int b = 0; b < blocks; ++b) {
+      fill_type::from_block(dist, {c0[b], c1[b], c2[b], c3[b]},
+                            out + b * fill_type::values_per_block);
+    }
+  }
+}
+
+template <class ExecutionSpace, class Distribution, class Store>
+void random_fill(ExecutionSpace const& exec, std::size_t n, std::uint64_t seed,
+                 Distribution const& dist, Store const& store) {
+  using value_type = typename Distribution::result_type;
+  using fill_type  = RandomFill<Distribution>;
+  constexpr std::size_t values_per_block = fill_type::values_per_block;
+
+  if constexpr (SpaceAccessibility<ExecutionSpace, HostSpace>::accessible) {
+    constexpr std::size_t batch_size =
+        random_fill_batch_blocks * values_per_block;
+    std::size_t const batches = (n + batch_size - 1) / batch_size;
+    Kokkos::parallel_for(
+        "Kokkos::fill_random",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, batches),
+        [=](std::size_t batch) {
+          value_type values[batch_size];
+          random_fill_host_batch(dist, seed, batch * random_fill_batch_blocks,
+                                 values);
+          std::size_t const first = batch * batch_size;
+          std::size_t const count = Kokkos::min(batch_size, n - first);
+          for (std::size_t k = 0; k < count; ++k) store(first + k, values[k]);
+        });
+  } else {
+    std::size_t const blocks = (n + values_per_block - 1) / values_per_block;
+    Kokkos::parallel_for(
+        "Kokkos::fill_random",
+        Kokkos::RangePolicy<ExecutionSpace>(exec, 0, blocks),
+        KOKKOS_LAMBDA(std::size_t block) {
+          value_type values[values_per_block];
+          fill_type::from_block(dist, philox_block(seed, 0, block), values);
+          std::size_t const first = block * values_per_block;
+          std::size_t const count = Kokkos::min(values_per_block, n - first);
+          for (std::size_t k = 0; k < count; ++k) store(first + k, values[k]);
+        });
+  }
+}
+
+}  // namespace Impl
+
+/// \brief Fills the View with values of the distribution drawn from \c seed.
+///
+/// Every value depends only on the seed and its position in the View, not on
+/// the execution space or its concurrency. Contiguous Views of any rank are
+/// filled in memory order, strided Views must have rank one.
+template <class ExecutionSpace, class DataType, class... Properties,
+          class Distribution>
+std::enable_if_t<Kokkos::is_execution_space_v<ExecutionSpace>> fill_random(
+    ExecutionSpace const& exec, View<DataType, Properties...> const& view,
+    std::uint64_t seed, Distribution const& dist) {
+  using view_type  = View<DataType, Properties...>;
+  using value_type = typename view_type::value_type;
+  static_assert(!std::is_const_v<value_type>,
+                "Kokkos::fill_random requires a View of non-const values");
+  static_assert(
+      SpaceAccessibility<ExecutionSpace,
+                         typename view_type::memory_space>::accessible,
+      "Kokkos::fill_random: the View must be accessible from the execution "
+      "space");
+  using result_type = typename Distribution::result_type;
+
+  if (view.span_is_contiguous()) {
+    value_type* const data = view.data();
+    Impl::random_fill(
+        exec, view.size(), seed, dist,
+        KOKKOS_LAMBDA(std::size_t i, result_type value) {
+          data[i] = value_type(value);
+        });
+  } else if constexpr (view_type::rank() == 1) {
+    Impl::random_fill(
+        exec, view.extent(0), seed, dist,
+        KOKKOS_LAMBDA(std::size_t i, result_type value) {
+          view(i) = value_type(value);
+        });
+  } else {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::fill_random: strided Views must have rank one");
+  }
+}
+
+template <class DataType, class... Properties, class Distribution>
+void fill_random(View<DataType, Properties...> const& view, std::uint64_t seed,
+                 Distribution const& dist) {
+  typename View<DataType, Properties...>::execution_space exec;
+  fill_random(exec, view, seed, dist);
+  exec.fence("Kokkos::fill_random: fence after filling the View");
+}
+
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_RANDOM
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_RANDOM
+#endif
+#endif
@@ -0,0 +1,162 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_Sort.hpp
+/// \brief Declaration and definition of Kokkos::sort and
+///   Kokkos::Experimental::sort_by_key.
+///
+/// Integer and floating-point keys are sorted with a parallel radix sort,
+/// everything else and every sort with a user-provided comparator with a
+/// parallel merge sort. Both are stable. The sorts run on host execution
+/// spaces.
+
+#ifndef KOKKOS_SORT_HPP
+#define KOKKOS_SORT_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_SORT
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_SortImpl.hpp>
+
+#include <functional>
+#include <type_traits>
+
+namespace Kokkos {
+
+/// \brief Sorts the rank-1 View in ascending order on the execution space
+///   instance.
+template <class ExecutionSpace, class DataType, class... Properties>
+std::enable_if_t<Kokkos::is_execution_space_v<ExecutionSpace>> sort(
+    ExecutionSpace const& exec, View<DataType, Properties...> const& view) {
+  using view_type  = View<DataType, Properties...>;
+  using value_type = typename view_type::non_const_value_type;
+  Impl::static_assert_sortable<ExecutionSpace, view_type>();
+
+  Impl::sort_contiguous(exec, view, [&](value_type* data) {
+    if constexpr (Impl::RadixSortKey<value_type>::value) {
+      Impl::radix_sort(exec, data, static_cast<Impl::SortNoValues*>(nullptr),
+                       view.extent(0));
+    } else {
+      Impl::merge_sort(exec, data, view.extent(0), std::less<value_type>());
+    }
+  });
+}
+
+/// \brief Sorts the rank-1 View so that comparator(b, a) is false for every
+///   element a that precedes an element b.
+template <class ExecutionSpace, class ComparatorType, class DataType,
+          class... Properties>
+std::enable_if_t<Kokkos::is_execution_space_v<ExecutionSpace>> sort(
+    ExecutionSpace const& exec, View<DataType, Properties...> const& view,
+    ComparatorType const& comparator) {
+  using view_type  = View<DataType, Properties...>;
+  using value_type = typename view_type::non_const_value_type;
+  Impl::static_assert_sortable<ExecutionSpace, view_type>();
+
+  Impl::sort_contiguous(exec, view, [&](value_type* data) {
+    Impl::merge_sort(exec, data, view.extent(0), comparator);
+  });
+}
+
+template <class DataType, class... Properties>
+void sort(View<DataType, Properties...> const& view) {
+  typename View<DataType, Properties...>::execution_space exec;
+  sort(exec, view);
+  exec.fence("Kokkos::sort: fence after sorting");
+}
+
+template <class ComparatorType, class DataType, class... Properties>
+void sort(View<DataType, Properties...> const& view,
+          ComparatorType const& comparator) {
+  typename View<DataType, Properties...>::execution_space exec;
+  sort(exec, view, comparator);
+  exec.fence("Kokkos::sort: fence after sorting");
+}
+
+namespace Experimental {
+
+/// \brief Sorts the rank-1 View of keys in ascending order and applies the
+///   same permutation to the rank-1 View of values. Equal keys keep the
+///   order of their values.
+template <class ExecutionSpace, class KeysDataType, class... KeysProperties,
+          class ValuesDataType, class... ValuesProperties>
+void sort_by_key(ExecutionSpace const& exec,
+                 View<KeysDataType, KeysProperties...> const& keys,
+                 View<ValuesDataType, ValuesProperties...> const& values) {
+  using keys_type   = View<KeysDataType, KeysProperties...>;
+  using values_type = View<ValuesDataType, ValuesProperties...>;
+  using key_type    = typename keys_type::non_const_value_type;
+  using value_type  = typename values_type::non_const_value_type;
+  Kokkos::Impl::static_assert_sortable<ExecutionSpace, keys_type>();
+  Kokkos::Impl::static_assert_sortable<ExecutionSpace, values_type>();
+  if (keys.extent(0) != values.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::sort_by_key: keys and values must have the "
+        "same extent");
+  }
+
+  Kokkos::Impl::sort_contiguous(exec, keys, [&](key_type* key_data) {
+    Kokkos::Impl::sort_contiguous(exec, values, [&](value_type* value_data) {
+      if constexpr (Kokkos::Impl::RadixSortKey<key_type>::value) {
+        Kokkos::Impl::radix_sort(exec, key_data, value_data, keys.extent(0));
+      } else {
+        Kokkos::Impl::merge_sort_by_key(exec, key_data, value_data,
+                                        keys.extent(0),
+                                        std::less<key_type>());
+      }
+    });
+  });
+}
+
+/// \brief Like sort_by_key(exec, keys, values), ordering the keys with the
+///   comparator.
+template <class ExecutionSpace, class ComparatorType, class KeysDataType,
+          class... KeysProperties, class ValuesDataType,
+          class... ValuesProperties>
+void sort_by_key(ExecutionSpace const& exec,
+                 View<KeysDataType, KeysProperties...> const& keys,
+                 View<ValuesDataType, ValuesProperties...> const& values,
+                 ComparatorType const& comparator) {
+  using keys_type   = View<KeysDataType, KeysProperties...>;
+  using values_type = View<ValuesDataType, ValuesProperties...>;
+  using key_type    = typename keys_type::non_const_value_type;
+  using value_type  = typename values_type::non_const_value_type;
+  Kokkos::Impl::static_assert_sortable<ExecutionSpace, keys_type>();
+  Kokkos::Impl::static_assert_sortable<ExecutionSpace, values_type>();
+  if (keys.extent(0) != values.extent(0)) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::sort_by_key: keys and values must have the "
+        "same extent");
+  }
+
+  Kokkos::Impl::sort_contiguous(exec, keys, [&](key_type* key_data) {
+    Kokkos::Impl::sort_contiguous(exec, values, [&](value_type* value_data) {
+      Kokkos::Impl::merge_sort_by_key(exec, key_data, value_data,
+                                      keys.extent(0), comparator);
+    });
+  });
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_SORT
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_SORT
+#endif
+#endif
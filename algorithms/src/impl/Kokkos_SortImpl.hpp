@@ -0,0 +1,360 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SORT_IMPL_HPP
+#define KOKKOS_SORT_IMPL_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+// Maps a key onto an unsigned integer of the same width whose ordering as an
+// unsigned number matches the ordering of the keys, so that a radix sort on
+// the bits sorts the keys. Negative floating-point numbers have all of their
+// bits flipped and non-negative ones only the sign bit.
+template <class Key, class Enable = void>
+struct RadixSortKey {
+  static constexpr bool value = false;
+};
+
+template <class Key>
+struct RadixSortKey<
+    Key, std::enable_if_t<std::is_integral_v<Key> ||
+                          std::is_same_v<Key, float> ||
+                          std::is_same_v<Key, double>>> {
+  static constexpr bool value = true;
+
+  using bits_type = std::conditional_t<
+      sizeof(Key) == 1, std::uint8_t,
+      std::conditional_t<
+          sizeof(Key) == 2, std::uint16_t,
+          std::conditional_t<sizeof(Key) == 4, std::uint32_t,
+                             std::uint64_t>>>;
+
+  static constexpr int digits = 8 * sizeof(Key);
+  static constexpr bits_type sign_bit = bits_type(bits_type(1) << (digits - 1));
+
+  static bits_type encode(Key key) {
+    auto const bits = Kokkos::bit_cast<bits_type>(key);
+    if constexpr (std::is_floating_point_v<Key>) {
+      return bits & sign_bit ? bits_type(~bits) : bits_type(bits | sign_bit);
+    } else if constexpr (std::is_signed_v<Key>) {
+      return bits_type(bits ^ sign_bit);
+    } else {
+      return bits;
+    }
+  }
+};
+
+// Placeholder value type for sorting keys that carry no values.
+struct SortNoValues {};
+
+// The host sorts below split the input into contiguous blocks, one per thread
+// of the execution space, but never into blocks so small that the per-block
+// bookkeeping dominates.
+template <class ExecutionSpace>
+std::size_t sort_block_count(ExecutionSpace const& exec, std::size_t n) {
+  constexpr std::size_t min_block_size = 1 << 14;
+  std::size_t const blocks = (n + min_block_size - 1) / min_block_size;
+  return std::clamp<std::size_t>(blocks, 1, exec.concurrency());
+}
+
+template <class ExecutionSpace, class T>
+Kokkos::View<T*, typename ExecutionSpace::memory_space> sort_buffer(
+    ExecutionSpace const& exec, std::string const& label, std::size_t n) {
+  return Kokkos::View<T*, typename ExecutionSpace::memory_space>(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, exec, label), n);
+}
+
+template <class ExecutionSpace, class T>
+void sort_copy(ExecutionSpace const& exec, T const* src, T* dst,
+               std::size_t n) {
+  Kokkos::parallel_for(
+      "Kokkos::sort::copy", Kokkos::RangePolicy<ExecutionSpace>(exec, 0, n),
+      [=](std::size_t i) { dst[i] = src[i]; });
+}
+
+// Stable least-significant-digit radix sort of keys[0, n), moving values
+// along with the keys unless Value is SortNoValues. Every pass histograms the
+// digit in each block, turns the histograms into scatter offsets with a
+// parallel_scan ordered digit-major, block-minor, and then scatters each block
+// in order. Passes over a digit that is the same for every key are skipped, so
+// small integer ranges only pay for the digits they use.
+template <class ExecutionSpace, class Key, class Value>
+void radix_sort(ExecutionSpace const& exec, Key* keys, Value* values,
+                std::size_t n) {
+  using key_traits            = RadixSortKey<Key>;
+  using bits_type             = typename key_traits::bits_type;
+  using policy_type           = Kokkos::RangePolicy<ExecutionSpace>;
+  constexpr bool has_values   = !std::is_same_v<Value, SortNoValues>;
+  constexpr int digit_bits    = 8;
+  constexpr std::size_t radix = std::size_t(1) << digit_bits;
+  constexpr int passes        = key_traits::digits / digit_bits;
+  static_assert(std::is_unsigned_v<bits_type>);
+
+  if (n < 2) return;
+
+  std::size_t const blocks     = sort_block_count(exec, n);
+  std::size_t const block_size = (n + blocks - 1) / blocks;
+
+  auto offsets_view =
+      sort_buffer<ExecutionSpace, std::size_t>(exec, "Kokkos::sort::offsets",
+                                               radix * blocks);
+  auto keys_view = sort_buffer<ExecutionSpace, Key>(exec, "Kokkos::sort::keys",
+                                                    n);
+  auto values_view = sort_buffer<ExecutionSpace, Value>(
+      exec, "Kokkos::sort::values", has_values ? n : 0);
+  std::size_t* const offsets = offsets_view.data();
+
+  Key* src_keys     = keys;
+  Key* dst_keys     = keys_view.data();
+  Value* src_values = values;
+  Value* dst_values = values_view.data();
+
+  for (int pass = 0; pass < passes; ++pass) {
+    int const shift = pass * digit_bits;
+    auto digit      = [=](Key key) {
+      return std::size_t(key_traits::encode(key) >> shift) & (radix - 1);
+    };
+
+    Kokkos::parallel_for(
+        "Kokkos::sort::radix_histogram", policy_type(exec, 0, blocks),
+        [=](std::size_t b) {
+          std::size_t count[radix] = {};
+          std::size_t const end    = std::min(n, (b + 1) * block_size);
+          for (std::size_t i = b * block_size; i < end; ++i) {
+            ++count[digit(src_keys[i])];
+          }
+          for (std::size_t d = 0; d < radix; ++d) {
+            offsets[d * blocks + b] = count[d];
+          }
+        });
+    std::size_t total = 0;
+    Kokkos::parallel_scan(
+        "Kokkos::sort::radix_offsets", policy_type(exec, 0, radix * blocks),
+        [=](std::size_t i, std::size_t& update, bool final) {
+          std::size_t const count = offsets[i];
+          if (final) offsets[i] = update;
+          update += count;
+        },
+        total);
+
+    // The scan returned its total, so the offsets can be read here.
+    bool single_digit = false;
+    for (std::size_t d = 0; d < radix && !single_digit; ++d) {
+      std::size_t const end =
+          d + 1 < radix ? offsets[(d + 1) * blocks] : total;
+      single_digit = end - offsets[d * blocks] == n;
+    }
+    if (single_digit) continue;
+
+    Kokkos::parallel_for(
+        "Kokkos::sort::radix_scatter", policy_type(exec, 0, blocks),
+        [=](std::size_t b) {
+          std::size_t position[radix];
+          for (std::size_t d = 0; d < radix; ++d) {
+            position[d] = offsets[d * blocks + b];
+          }
+          std::size_t const end = std::min(n, (b + 1) * block_size);
+          for (std::size_t i = b * block_size; i < end; ++i) {
+            std::size_t const p = position[digit(src_keys[i])]++;
+            dst_keys[p]         = src_keys[i];
+            if constexpr (has_values) dst_values[p] = src_values[i];
+          }
+        });
+    std::swap(src_keys, dst_keys);
+    std::swap(src_values, dst_values);
+  }
+
+  if (src_keys != keys) {
+    sort_copy(exec, src_keys, keys, n);
+    if constexpr (has_values) sort_copy(exec, src_values, values, n);
+  }
+  exec.fence("Kokkos::sort: fence before releasing the radix sort buffers");
+}
+
+// Number of elements that the first k elements of the stable merge of a[0, m)
+// and b[0, l) take from a. Ties go to a.
+template <class T, class Compare>
+std::size_t merge_path(T const* a, std::size_t m, T const* b, std::size_t l,
+                       std::size_t k, Compare const& comp) {
+  std::size_t lo = k > l ? k - l : 0;
+  std::size_t hi = std::min(k, m);
+  while (lo < hi) {
+    std::size_t const i = lo + (hi - lo) / 2;
+    std::size_t const j = k - i;
+    if (!comp(b[j - 1], a[i])) {
+      lo = i + 1;
+    } else {
+      hi = i;
+    }
+  }
+  return lo;
+}
+
+// Stable merge sort of data[0, n). The blocks are sorted independently with
+// std::stable_sort, after which every pass merges pairs of sorted runs. Each
+// pass splits the output evenly between the blocks and locates where a block's
+// share starts in its two input runs with merge_path, so all threads stay busy
+// down to the final merge.
+template <class ExecutionSpace, class T, class Compare>
+void merge_sort(ExecutionSpace const& exec, T* data, std::size_t n,
+                Compare const& comp) {
+  using policy_type = Kokkos::RangePolicy<ExecutionSpace>;
+
+  if (n < 2) return;
+
+  std::size_t const blocks     = sort_block_count(exec, n);
+  std::size_t const block_size = (n + blocks - 1) / blocks;
+
+  Kokkos::parallel_for(
+      "Kokkos::sort::merge_sort_blocks", policy_type(exec, 0, blocks),
+      [=](std::size_t b) {
+        std::size_t const begin = std::min(n, b * block_size);
+        std::size_t const end   = std::min(n, begin + block_size);
+        std::stable_sort(data + begin, data + end, comp);
+      });
+  if (blocks == 1) {
+    exec.fence("Kokkos::sort: fence after sorting a single block");
+    return;
+  }
+
+  auto buffer = sort_buffer<ExecutionSpace, T>(exec, "Kokkos::sort::buffer", n);
+  T* src      = data;
+  T* dst      = buffer.data();
+  for (std::size_t width = block_size; width < n; width *= 2) {
+    Kokkos::parallel_for(
+        "Kokkos::sort::merge_sort_merge", policy_type(exec, 0, blocks),
+        [=](std::size_t b) {
+          std::size_t out       = std::min(n, b * block_size);
+          std::size_t const end = std::min(n, out + block_size);
+          while (out < end) {
+            std::size_t const first  = out / (2 * width) * (2 * width);
+            std::size_t const middle = std::min(n, first + width);
+            std::size_t const last   = std::min(n, first + 2 * width);
+            std::size_t const stop   = std::min(end, last);
+            T const* a               = src + first;
+            T const* c               = src + middle;
+            std::size_t const m      = middle - first;
+            std::size_t const l      = last - middle;
+            std::size_t i = merge_path(a, m, c, l, out - first, comp);
+            std::size_t j = out - first - i;
+            for (; out < stop; ++out) {
+              if (j < l && (i == m || comp(c[j], a[i]))) {
+                dst[out] = c[j++];
+              } else {
+                dst[out] = a[i++];
+              }
+            }
+          }
+        });
+    std::swap(src, dst);
+  }
+
+  if (src != data) sort_copy(exec, static_cast<T const*>(src), data, n);
+  exec.fence("Kokkos::sort: fence before releasing the merge sort buffer");
+}
+
+template <class Key, class Compare>
+struct SortPermutationCompare {
+  Key const* keys;
+  Compare comp;
+
+  bool operator()(std::size_t i, std::size_t j) const {
+    return comp(keys[i], keys[j]);
+  }
+};
+
+// Sorts the keys with a comparator and applies the same permutation to the
+// values: the indices of the keys are merge sorted and then used to gather
+// both arrays.
+template <class ExecutionSpace, class Key, class Value, class Compare>
+void merge_sort_by_key(ExecutionSpace const& exec, Key* keys, Value* values,
+                       std::size_t n, Compare const& comp) {
+  using policy_type = Kokkos::RangePolicy<ExecutionSpace>;
+
+  if (n < 2) return;
+
+  auto permutation_view = sort_buffer<ExecutionSpace, std::size_t>(
+      exec, "Kokkos::sort::permutation", n);
+  auto keys_view =
+      sort_buffer<ExecutionSpace, Key>(exec, "Kokkos::sort::keys", n);
+  auto values_view =
+      sort_buffer<ExecutionSpace, Value>(exec, "Kokkos::sort::values", n);
+  std::size_t* const permutation = permutation_view.data();
+  Key* const sorted_keys         = keys_view.data();
+  Value* const sorted_values     = values_view.data();
+
+  Kokkos::parallel_for(
+      "Kokkos::sort::permutation_init", policy_type(exec, 0, n),
+      [=](std::size_t i) { permutation[i] = i; });
+  merge_sort(exec, permutation, n,
+             SortPermutationCompare<Key, Compare>{keys, comp});
+  Kokkos::parallel_for(
+      "Kokkos::sort::permutation_gather", policy_type(exec, 0, n),
+      [=](std::size_t i) {
+        sorted_keys[i]   = keys[permutation[i]];
+        sorted_values[i] = values[permutation[i]];
+      });
+  sort_copy(exec, static_cast<Key const*>(sorted_keys), keys, n);
+  sort_copy(exec, static_cast<Value const*>(sorted_values), values, n);
+  exec.fence("Kokkos::sort: fence before releasing the permutation buffers");
+}
+
+// The sorts above work on contiguous host-accessible arrays. A strided View
+// is copied into a contiguous buffer first and back afterwards.
+template <class ExecutionSpace, class ViewType, class Functor>
+void sort_contiguous(ExecutionSpace const& exec, ViewType const& view,
+                     Functor const& functor) {
+  using value_type = typename ViewType::non_const_value_type;
+  if (view.span_is_contiguous()) {
+    functor(view.data());
+    return;
+  }
+  auto buffer = sort_buffer<ExecutionSpace, value_type>(
+      exec, "Kokkos::sort::contiguous", view.extent(0));
+  Kokkos::deep_copy(exec, buffer, view);
+  functor(buffer.data());
+  Kokkos::deep_copy(exec, view, buffer);
+  exec.fence("Kokkos::sort: fence before releasing the contiguous copy");
+}
+
+template <class ExecutionSpace, class ViewType>
+constexpr void static_assert_sortable() {
+  static_assert(Kokkos::is_execution_space_v<ExecutionSpace>);
+  static_assert(Kokkos::is_view_v<ViewType>);
+  static_assert(ViewType::rank == 1, "Kokkos::sort: the View must be rank 1");
+  static_assert(!std::is_const_v<typename ViewType::value_type>,
+                "Kokkos::sort: the View must not be const");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace, Kokkos::HostSpace>::accessible,
+      "Kokkos::sort: only host execution spaces are supported");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename ViewType::memory_space>::accessible,
+      "Kokkos::sort: the View must be accessible from the execution space");
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,231 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Random.hpp>
+
+#include <cmath>
+#include <cstdint>
+
+namespace Test {
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+
+// Known-answer vectors of the Random123 distribution.
+TEST(algorithms, random_philox_known_answers) {
+  struct {
+    Kokkos::Array<std::uint32_t, 4> ctr;
+    Kokkos::Array<std::uint32_t, 2> key;
+    Kokkos::Array<std::uint32_t, 4> expected;
+  } const vectors[] = {
+      {{0, 0, 0, 0},
+       {0, 0},
+       {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+      {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff},
+       {0xffffffff, 0xffffffff},
+       {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+      {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344},
+       {0xa4093822, 0x299f31d0},
+       {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}},
+  };
+  for (auto const& v : vectors) {
+    auto const result = Kokkos::Impl::philox4x32_10(v.ctr, v.key);
+    for (int k = 0; k < 4; ++k) EXPECT_EQ(result[k], v.expected[k]) << k;
+  }
+}
+
+TEST(algorithms, random_philox_streams) {
+  Kokkos::Random_Philox4x32 gen(42, 7);
+  std::uint32_t words[10];
+  for (auto& word : words) word = gen.urand();
+  EXPECT_EQ(gen.position(), 10u);
+
+  // A generator placed anywhere in the stream continues the same sequence.
+  Kokkos::Random_Philox4x32 skipped(42, 7, 5);
+  for (int k = 5; k < 10; ++k) EXPECT_EQ(skipped.urand(), words[k]) << k;
+  Kokkos::Random_Philox4x32 discarded(42, 7);
+  discarded.discard(3);
+  EXPECT_EQ(discarded.urand64(),
+            std::uint64_t(words[4]) << 32 | std::uint64_t(words[3]));
+
+  Kokkos::Random_Philox4x32 other_stream(42, 8);
+  Kokkos::Random_Philox4x32 other_seed(43, 7);
+  EXPECT_NE(other_stream.urand(), words[0]);
+  EXPECT_NE(other_seed.urand(), words[0]);
+
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_LT(gen.urand(10), 10u);
+    auto const u = gen.urand(5, 9);
+    ASSERT_TRUE(5 <= u && u < 9) << u;
+    ASSERT_LT(gen.urand64(std::uint64_t(1) << 40), std::uint64_t(1) << 40);
+    auto const d = gen.drand(-1.0, 1.0);
+    ASSERT_TRUE(-1.0 <= d && d < 1.0) << d;
+    auto const f = gen.frand();
+    ASSERT_TRUE(0.0f <= f && f < 1.0f) << f;
+    ASSERT_TRUE(std::isfinite(gen.normal()));
+  }
+}
+
+// Keyed by the iteration index, the draws do not depend on the number of
+// threads or on the schedule.
+TEST(algorithms, random_counter_based_kernel) {
+  constexpr int n = 10000;
+  Kokkos::View<double*, ExecSpace> values("values", n);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace, Kokkos::Schedule<Kokkos::Dynamic>>(0, n),
+      KOKKOS_LAMBDA(int i) {
+        Kokkos::Random_Philox4x32 gen(2024, i);
+        values(i) = gen.drand() + gen.drand();
+      });
+  Kokkos::fence();
+  for (int i = 0; i < n; ++i) {
+    Kokkos::Random_Philox4x32 gen(2024, i);
+    ASSERT_EQ(values(i), gen.drand() + gen.drand()) << i;
+  }
+}
+
+TEST(algorithms, random_pool) {
+  Kokkos::Random_Philox4x32_Pool<ExecSpace> pool(5);
+  EXPECT_GE(pool.num_states(), ExecSpace().concurrency());
+
+  constexpr int n = 100000;
+  Kokkos::View<std::uint32_t*, ExecSpace> values("values", n);
+  for (int pass = 0; pass < 2; ++pass) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecSpace>(0, n / 2), KOKKOS_LAMBDA(int i) {
+          auto gen = pool.get_state();
+          values(pass * n / 2 + i) = gen.urand(1000);
+          pool.free_state(gen);
+        });
+  }
+  Kokkos::fence();
+
+  // The second pass continues the streams, so the draws of both passes
+  // together still look uniform.
+  int counts[10] = {};
+  for (int i = 0; i < n; ++i) {
+    ASSERT_LT(values(i), 1000u);
+    ++counts[values(i) / 100];
+  }
+  for (int count : counts) EXPECT_NEAR(count, n / 10, n / 100);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, 1), KOKKOS_LAMBDA(int) {
+        auto gen  = pool.get_state();
+        values(0) = gen.position();
+        pool.free_state(gen);
+      });
+  Kokkos::fence();
+  EXPECT_GT(values(0), 0u);
+}
+
+// The uniform distributions fill the View with the sequence the distribution
+// draws from stream 0 of the seed.
+template <class Distribution>
+void check_fill_sequence(Distribution const& dist) {
+  using T         = typename Distribution::result_type;
+  constexpr int n = 10007;
+  Kokkos::View<T*, ExecSpace> values("values", n);
+  Kokkos::fill_random(values, 99, dist);
+  Kokkos::Random_Philox4x32 gen(99, 0);
+  for (int i = 0; i < n; ++i) ASSERT_EQ(values(i), dist(gen)) << i;
+}
+
+TEST(algorithms, random_fill_uniform) {
+  check_fill_sequence(Kokkos::uniform_real_distribution<double>());
+  check_fill_sequence(Kokkos::uniform_real_distribution<float>());
+  check_fill_sequence(Kokkos::uniform_int_distribution<int>(-5, 5));
+  check_fill_sequence(Kokkos::uniform_int_distribution<std::uint64_t>());
+  check_fill_sequence(
+      Kokkos::uniform_int_distribution<std::int64_t>(-(std::int64_t(1) << 40),
+                                                     3));
+  check_fill_sequence(Kokkos::uniform_int_distribution<std::int8_t>());
+
+  constexpr int n = 100000;
+  Kokkos::View<double*, ExecSpace> reals("reals", n);
+  Kokkos::fill_random(reals, 1, Kokkos::uniform_real_distribution<>(2, 3));
+  Kokkos::View<int*, ExecSpace> ints("ints", n);
+  Kokkos::fill_random(ints, 1, Kokkos::uniform_int_distribution<>(-2, 2));
+  double sum    = 0;
+  int counts[5] = {};
+  for (int i = 0; i < n; ++i) {
+    ASSERT_TRUE(2 <= reals(i) && reals(i) < 3) << reals(i);
+    ASSERT_TRUE(-2 <= ints(i) && ints(i) <= 2) << ints(i);
+    sum += reals(i);
+    ++counts[ints(i) + 2];
+  }
+  EXPECT_NEAR(sum / n, 2.5, 0.01);
+  for (int count : counts) EXPECT_NEAR(count, n / 5, n / 100);
+}
+
+template <class T>
+void check_fill_normal() {
+  constexpr int n = 200000;
+  Kokkos::View<T*, ExecSpace> values("values", n);
+  Kokkos::fill_random(values, 7, Kokkos::normal_distribution<T>(1, 2));
+  double sum = 0, sum_sq = 0;
+  for (int i = 0; i < n; ++i) {
+    ASSERT_TRUE(std::isfinite(values(i))) << i;
+    sum += values(i);
+    sum_sq += (values(i) - 1) * (values(i) - 1);
+  }
+  EXPECT_NEAR(sum / n, 1.0, 0.03);
+  EXPECT_NEAR(sum_sq / n, 4.0, 0.06);
+}
+
+TEST(algorithms, random_fill_normal) {
+  check_fill_normal<double>();
+  check_fill_normal<float>();
+
+  // The first value of each pair is the one normal() draws from the same
+  // words.
+  Kokkos::View<double*, ExecSpace> values("values", 1000);
+  Kokkos::fill_random(values, 3, Kokkos::normal_distribution<double>());
+  for (int i = 0; i < 1000; i += 2) {
+    Kokkos::Random_Philox4x32 gen(3, 0, 2 * i);
+    double const expected = gen.normal();
+    ASSERT_NEAR(values(i), expected, 1e-12 * (1 + std::abs(expected))) << i;
+  }
+}
+
+TEST(algorithms, random_fill_layouts) {
+  Kokkos::View<double**, Kokkos::LayoutLeft, ExecSpace> matrix("matrix", 30,
+                                                               40);
+  Kokkos::fill_random(ExecSpace(), matrix, 11,
+                      Kokkos::uniform_real_distribution<double>());
+  ExecSpace().fence();
+  Kokkos::View<double*, ExecSpace> flat("flat", 30 * 40);
+  Kokkos::fill_random(flat, 11, Kokkos::uniform_real_distribution<double>());
+  for (int j = 0; j < 40; ++j) {
+    for (int i = 0; i < 30; ++i) ASSERT_EQ(matrix(i, j), flat(i + 30 * j));
+  }
+
+  auto row = Kokkos::subview(matrix, 3, Kokkos::ALL);
+  Kokkos::fill_random(row, 12, Kokkos::uniform_real_distribution<double>());
+  Kokkos::View<double*, ExecSpace> expected("expected", 40);
+  Kokkos::fill_random(expected, 12,
+                      Kokkos::uniform_real_distribution<double>());
+  for (int j = 0; j < 40; ++j) ASSERT_EQ(row(j), expected(j));
+
+  auto block = Kokkos::subview(matrix, Kokkos::pair(0, 2), Kokkos::ALL);
+  EXPECT_THROW(Kokkos::fill_random(block, 1,
+                                   Kokkos::uniform_real_distribution<>()),
+               std::runtime_error);
+}
+
+}  // namespace Test
@@ -0,0 +1,217 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Sort.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace Test {
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+
+// Large enough to be split into several blocks on every host backend.
+constexpr std::size_t sort_size = 100000;
+
+template <class T>
+std::vector<T> random_keys(std::size_t n, T lo, T hi) {
+  std::mt19937_64 engine(1234);
+  std::vector<T> keys(n);
+  for (auto& key : keys) {
+    if constexpr (std::is_integral_v<T>) {
+      // uniform_int_distribution does not accept character types.
+      using wide_type = std::conditional_t<std::is_signed_v<T>, long long,
+                                           unsigned long long>;
+      key = T(std::uniform_int_distribution<wide_type>(lo, hi)(engine));
+    } else {
+      key = std::uniform_real_distribution<T>(lo, hi)(engine);
+    }
+  }
+  return keys;
+}
+
+template <class T>
+Kokkos::View<T*, ExecSpace> to_view(std::vector<T> const& values) {
+  Kokkos::View<T*, ExecSpace> view("values", values.size());
+  std::copy(values.begin(), values.end(), view.data());
+  return view;
+}
+
+template <class T, class... Properties>
+std::vector<T> to_vector(Kokkos::View<T*, Properties...> const& view) {
+  std::vector<T> values(view.extent(0));
+  for (std::size_t i = 0; i < values.size(); ++i) values[i] = view(i);
+  return values;
+}
+
+template <class T>
+void check_sort(std::size_t n, T lo, T hi) {
+  auto expected = random_keys(n, lo, hi);
+  auto keys     = to_view(expected);
+  Kokkos::sort(ExecSpace(), keys);
+  ExecSpace().fence();
+  std::sort(expected.begin(), expected.end());
+  EXPECT_EQ(to_vector(keys), expected) << n;
+}
+
+TEST(algorithms, sort_radix) {
+  for (std::size_t n : {std::size_t(0), std::size_t(1), std::size_t(1000),
+                        sort_size}) {
+    check_sort<int>(n, std::numeric_limits<int>::min(),
+                    std::numeric_limits<int>::max());
+    check_sort<std::int64_t>(n, -1000, 1000);
+    check_sort<std::uint64_t>(n, 0, std::numeric_limits<std::uint64_t>::max());
+    check_sort<std::int16_t>(n, -300, 300);
+    check_sort<unsigned char>(n, 0, 255);
+    check_sort<float>(n, -1e10f, 1e10f);
+    check_sort<double>(n, -1.0, 1.0);
+  }
+}
+
+TEST(algorithms, sort_special_floating_point) {
+  std::vector<double> expected = {0.0,  -0.0, 1e-310, -1e-310, -1e300,
+                                  1e300, -std::numeric_limits<double>::infinity(),
+                                  std::numeric_limits<double>::infinity(), 2.5,
+                                  -2.5};
+  auto keys = to_view(expected);
+  Kokkos::sort(keys);
+  std::stable_sort(expected.begin(), expected.end());
+  auto const sorted = to_vector(keys);
+  ASSERT_EQ(sorted.size(), expected.size());
+  for (std::size_t i = 0; i < sorted.size(); ++i) {
+    EXPECT_EQ(sorted[i], expected[i]) << i;
+  }
+  EXPECT_TRUE(std::signbit(sorted[4]));
+  EXPECT_FALSE(std::signbit(sorted[5]));
+}
+
+TEST(algorithms, sort_comparator) {
+  auto expected = random_keys<int>(sort_size, -50, 50);
+  auto keys     = to_view(expected);
+  Kokkos::sort(ExecSpace(), keys, std::greater<int>());
+  ExecSpace().fence();
+  std::sort(expected.begin(), expected.end(), std::greater<int>());
+  EXPECT_EQ(to_vector(keys), expected);
+}
+
+struct Point {
+  int x;
+  int y;
+
+  friend bool operator<(Point const& a, Point const& b) { return a.x < b.x; }
+};
+
+// Types without a radix key go through the merge sort, which is stable.
+TEST(algorithms, sort_merge_stable) {
+  std::vector<Point> expected(sort_size);
+  auto const xs = random_keys<int>(sort_size, 0, 99);
+  for (std::size_t i = 0; i < sort_size; ++i) {
+    expected[i] = {xs[i], static_cast<int>(i)};
+  }
+  Kokkos::View<Point*, ExecSpace> points("points", sort_size);
+  std::copy(expected.begin(), expected.end(), points.data());
+  Kokkos::sort(points);
+  std::stable_sort(expected.begin(), expected.end());
+  for (std::size_t i = 0; i < sort_size; ++i) {
+    ASSERT_EQ(points(i).x, expected[i].x) << i;
+    ASSERT_EQ(points(i).y, expected[i].y) << i;
+  }
+}
+
+TEST(algorithms, sort_strided) {
+  Kokkos::View<int**, Kokkos::LayoutRight, ExecSpace> values("values",
+                                                              sort_size, 2);
+  auto const keys = random_keys<int>(sort_size, -1000, 1000);
+  for (std::size_t i = 0; i < sort_size; ++i) {
+    values(i, 0) = keys[i];
+    values(i, 1) = -1;
+  }
+  auto column = Kokkos::subview(values, Kokkos::ALL, 0);
+  Kokkos::sort(ExecSpace(), column);
+  ExecSpace().fence();
+  auto expected = keys;
+  std::sort(expected.begin(), expected.end());
+  for (std::size_t i = 0; i < sort_size; ++i) {
+    ASSERT_EQ(values(i, 0), expected[i]) << i;
+    ASSERT_EQ(values(i, 1), -1) << i;
+  }
+}
+
+template <class Key>
+void check_sort_by_key(std::size_t n, Key lo, Key hi) {
+  auto const keys = random_keys<Key>(n, lo, hi);
+  std::vector<std::size_t> order(n);
+  for (std::size_t i = 0; i < n; ++i) order[i] = i;
+  std::stable_sort(order.begin(), order.end(),
+                   [&](std::size_t i, std::size_t j) {
+                     return keys[i] < keys[j];
+                   });
+
+  auto keys_view = to_view(keys);
+  Kokkos::View<std::size_t*, ExecSpace> values("values", n);
+  for (std::size_t i = 0; i < n; ++i) values(i) = i;
+  Kokkos::Experimental::sort_by_key(ExecSpace(), keys_view, values);
+  ExecSpace().fence();
+  for (std::size_t i = 0; i < n; ++i) {
+    ASSERT_EQ(values(i), order[i]) << i;
+    ASSERT_EQ(keys_view(i), keys[order[i]]) << i;
+  }
+}
+
+TEST(algorithms, sort_by_key) {
+  for (std::size_t n : {std::size_t(0), std::size_t(7), sort_size}) {
+    check_sort_by_key<int>(n, -100, 100);
+    check_sort_by_key<std::uint32_t>(n, 0, 1 << 20);
+    check_sort_by_key<double>(n, -1.0, 1.0);
+  }
+}
+
+TEST(algorithms, sort_by_key_comparator) {
+  auto const keys = random_keys<int>(sort_size, 0, 99);
+  std::vector<int> order(sort_size);
+  for (std::size_t i = 0; i < sort_size; ++i) order[i] = i;
+  std::stable_sort(order.begin(), order.end(),
+                   [&](int i, int j) { return keys[i] > keys[j]; });
+
+  auto keys_view = to_view(keys);
+  Kokkos::View<int*, Kokkos::LayoutRight, ExecSpace> values("values",
+                                                             sort_size);
+  for (std::size_t i = 0; i < sort_size; ++i) values(i) = i;
+  Kokkos::Experimental::sort_by_key(ExecSpace(), keys_view, values,
+                                    std::greater<int>());
+  ExecSpace().fence();
+  for (std::size_t i = 0; i < sort_size; ++i) {
+    ASSERT_EQ(values(i), order[i]) << i;
+    ASSERT_EQ(keys_view(i), keys[order[i]]) << i;
+  }
+}
+
+TEST(algorithms, sort_by_key_extent_mismatch) {
+  Kokkos::View<int*, ExecSpace> keys("keys", 4);
+  Kokkos::View<int*, ExecSpace> values("values", 3);
+  EXPECT_THROW(Kokkos::Experimental::sort_by_key(ExecSpace(), keys, values),
+               std::runtime_error);
+}
+
+}  // namespace Test
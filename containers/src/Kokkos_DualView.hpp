@@ -0,0 +1,341 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_DualView.hpp
+/// \brief Declaration and definition of Kokkos::DualView.
+///
+/// A DualView pairs a View with its host mirror and keeps track of which of
+/// the two was modified last, so that synchronizing them only copies when
+/// the other side is stale.
+
+#ifndef KOKKOS_DUALVIEW_HPP
+#define KOKKOS_DUALVIEW_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_DUALVIEW
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Error.hpp>
+
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+
+/// \class DualView
+/// \brief A View on the device of its memory space together with a host
+///   mirror of it.
+///
+/// Users mark the side they write with modify_host() or modify_device() and
+/// call sync_host() or sync_device() before reading a side. Each call to
+/// modify increments the counter of its side past that of the other side;
+/// a sync copies only if the counter of the other side is ahead and then
+/// makes both counters equal. The counters are shared by all copies of the
+/// DualView.
+///
+/// If the device View is accessible from the host, the host View is the
+/// device View itself and synchronizing never copies. A DualView built from
+/// a device View and a separately allocated host View copies between them
+/// even if both are in host memory.
+///
+/// Both kinds of calls are reported to tools through the syncDualView and
+/// modifyDualView hooks.
+template <class DataType, class... Properties>
+class DualView : public ViewTraits<DataType, Properties...> {
+  template <class, class...>
+  friend class DualView;
+
+ public:
+  using traits = ViewTraits<DataType, Properties...>;
+
+  using t_dev  = View<typename traits::data_type, Properties...>;
+  using t_host = typename t_dev::HostMirror;
+
+  using t_dev_const  = typename t_dev::const_type;
+  using t_host_const = typename t_host::const_type;
+
+  using host_mirror_space = typename traits::host_mirror_space;
+
+  /// \brief Whether create_mirror_view returns the device View itself.
+  static constexpr bool impl_dualview_is_single_device =
+      std::is_same_v<typename t_dev::device_type, typename t_host::device_type>;
+
+  t_dev d_view;
+  t_host h_view;
+
+ private:
+  // The modification counters of the host (0) and of the device (1) side.
+  using t_modified_flags = View<unsigned int[2], LayoutLeft, HostSpace>;
+  t_modified_flags modified_flags;
+
+  template <class Device>
+  static constexpr bool impl_is_device_side() {
+    return !impl_dualview_is_single_device &&
+           std::is_same_v<typename Device::memory_space,
+                          typename traits::memory_space>;
+  }
+
+ public:
+  //----------------------------------------
+  // Construction
+
+  DualView() = default;
+
+  /// \brief Allocates the device View and, unless it is host accessible,
+  ///   a host mirror; both start out in sync.
+  explicit DualView(std::string const& label,
+                    size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                    size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                    size_t n2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                    size_t n3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                    size_t n4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                    size_t n5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                    size_t n6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                    size_t n7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG)
+      : d_view(label, n0, n1, n2, n3, n4, n5, n6, n7),
+        h_view(create_mirror_view(d_view)),
+        modified_flags("DualView::modified_flags") {}
+
+  template <class... P>
+  explicit DualView(Impl::ViewCtorProp<P...> const& arg_prop,
+                    typename traits::array_layout const& layout)
+      : d_view(arg_prop, layout),
+        h_view(create_mirror_view(d_view)),
+        modified_flags("DualView::modified_flags") {}
+
+  /// \brief Pairs a device View with its existing host mirror.
+  DualView(t_dev const& arg_d_view, t_host const& arg_h_view)
+      : d_view(arg_d_view),
+        h_view(arg_h_view),
+        modified_flags("DualView::modified_flags") {
+    for (unsigned r = 0; r < t_dev::rank(); ++r) {
+      if (d_view.extent(r) != h_view.extent(r)) {
+        Kokkos::Impl::throw_runtime_exception(
+            "Kokkos::DualView: the extents of the device and host Views "
+            "differ");
+      }
+    }
+  }
+
+  /// \brief Pairs a device View with a new mirror; the device side is
+  ///   marked as modified.
+  explicit DualView(t_dev const& arg_d_view)
+      : d_view(arg_d_view),
+        h_view(create_mirror_view(d_view)),
+        modified_flags("DualView::modified_flags") {
+    if (d_view.data() != h_view.data()) modified_flags(1) = 1;
+  }
+
+  /// \brief Shares the Views and the counters of another DualView, e.g. to
+  ///   view it as const.
+  template <class SD, class... SP>
+  DualView(DualView<SD, SP...> const& src)
+      : d_view(src.d_view),
+        h_view(src.h_view),
+        modified_flags(src.modified_flags) {}
+
+  //----------------------------------------
+  // Access
+
+  t_host const& view_host() const { return h_view; }
+  t_dev const& view_device() const { return d_view; }
+
+  /// \brief The View whose memory space is that of \c Device.
+  template <class Device>
+  auto const& view() const {
+    if constexpr (impl_is_device_side<Device>()) {
+      return d_view;
+    } else {
+      static_assert(
+          std::is_same_v<typename Device::memory_space,
+                         typename t_host::memory_space> ||
+              std::is_same_v<typename Device::memory_space,
+                             typename t_dev::memory_space>,
+          "Kokkos::DualView::view: Device is neither side of the DualView");
+      return h_view;
+    }
+  }
+
+  template <typename iType>
+  constexpr std::enable_if_t<std::is_integral_v<iType>, size_t> extent(
+      iType const& r) const {
+    return d_view.extent(r);
+  }
+
+  template <typename iType>
+  constexpr std::enable_if_t<std::is_integral_v<iType>, int> extent_int(
+      iType const& r) const {
+    return d_view.extent_int(r);
+  }
+
+  template <typename iType>
+  void stride(iType* s) const {
+    d_view.stride(s);
+  }
+
+  size_t span() const { return d_view.span(); }
+  bool span_is_contiguous() const { return d_view.span_is_contiguous(); }
+  bool is_allocated() const {
+    return d_view.is_allocated() && h_view.is_allocated();
+  }
+  std::string label() const { return d_view.label(); }
+
+  //----------------------------------------
+  // Modification tracking
+
+  /// \brief Whether the host side is stale, i.e. sync_host() would copy.
+  bool need_sync_host() const {
+    return modified_flags.data() && modified_flags(1) > modified_flags(0);
+  }
+
+  /// \brief Whether the device side is stale, i.e. sync_device() would copy.
+  bool need_sync_device() const {
+    return modified_flags.data() && modified_flags(0) > modified_flags(1);
+  }
+
+  template <class Device>
+  bool need_sync() const {
+    return impl_is_device_side<Device>() ? need_sync_device()
+                                         : need_sync_host();
+  }
+
+  void modify_host() { impl_modify(0); }
+  void modify_device() { impl_modify(1); }
+
+  template <class Device>
+  void modify() {
+    impl_modify(impl_is_device_side<Device>() ? 1 : 0);
+  }
+
+  /// \brief Forgets all modifications, so that neither side is stale.
+  void clear_sync_state() {
+    if (modified_flags.data()) modified_flags(0) = modified_flags(1) = 0;
+  }
+
+  //----------------------------------------
+  // Synchronization
+
+  /// \brief Copies the device View to the host View if the host side is
+  ///   stale.
+  void sync_host() {
+    if (need_sync_host()) {
+      impl_copy(h_view, d_view);
+      impl_synced(false);
+    }
+  }
+
+  /// \brief Copies the host View to the device View if the device side is
+  ///   stale.
+  void sync_device() {
+    if (need_sync_device()) {
+      impl_copy(d_view, h_view);
+      impl_synced(true);
+    }
+  }
+
+  /// \brief As sync_host(), but the copy is enqueued on \c exec and the
+  ///   host View may only be read once \c exec has been fenced.
+  template <class ExecSpace>
+  std::enable_if_t<is_execution_space_v<ExecSpace>> sync_host(
+      ExecSpace const& exec) {
+    if (need_sync_host()) {
+      impl_copy(h_view, d_view, exec);
+      impl_synced(false);
+    }
+  }
+
+  /// \brief As sync_device(), but the copy is enqueued on \c exec.
+  template <class ExecSpace>
+  std::enable_if_t<is_execution_space_v<ExecSpace>> sync_device(
+      ExecSpace const& exec) {
+    if (need_sync_device()) {
+      impl_copy(d_view, h_view, exec);
+      impl_synced(true);
+    }
+  }
+
+  template <class Device>
+  void sync() {
+    if constexpr (impl_is_device_side<Device>()) {
+      sync_device();
+    } else {
+      sync_host();
+    }
+  }
+
+  template <class Device, class ExecSpace>
+  std::enable_if_t<is_execution_space_v<ExecSpace>> sync(
+      ExecSpace const& exec) {
+    if constexpr (impl_is_device_side<Device>()) {
+      sync_device(exec);
+    } else {
+      sync_host(exec);
+    }
+  }
+
+ private:
+  unsigned int impl_latest() const {
+    return modified_flags(0) > modified_flags(1) ? modified_flags(0)
+                                                 : modified_flags(1);
+  }
+
+  void impl_modify(int side) {
+    if (!modified_flags.data()) return;
+    modified_flags(side) = impl_latest() + 1;
+    if (Kokkos::Tools::profileLibraryLoaded()) {
+      Kokkos::Tools::modifyDualView(
+          d_view.label(),
+          side ? static_cast<void const*>(d_view.data())
+               : static_cast<void const*>(h_view.data()),
+          side == 1);
+    }
+  }
+
+  void impl_synced(bool to_device) {
+    modified_flags(0) = modified_flags(1) = impl_latest();
+    if (Kokkos::Tools::profileLibraryLoaded()) {
+      Kokkos::Tools::syncDualView(
+          d_view.label(),
+          to_device ? static_cast<void const*>(d_view.data())
+                    : static_cast<void const*>(h_view.data()),
+          to_device);
+    }
+  }
+
+  // Only the counters change when both sides are the same View.
+  template <class Dst, class Src, class... ExecSpace>
+  static void impl_copy(Dst const& dst, Src const& src,
+                        ExecSpace const&... exec) {
+    if constexpr (impl_dualview_is_single_device) {
+      if (dst.data() == src.data()) return;
+    }
+    if constexpr (std::is_const_v<typename traits::value_type>) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::DualView: cannot sync a DualView of const data");
+    } else if (dst.data() != src.data()) {
+      Kokkos::deep_copy(exec..., dst, src);
+    }
+  }
+};
+
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_DUALVIEW
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_DUALVIEW
+#endif
+#endif
@@ -0,0 +1,676 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_DynRankView.hpp
+/// \brief Declaration and definition of Kokkos::DynRankView.
+///
+/// A DynRankView is a View whose rank, between 0 and 8, is chosen when it is
+/// constructed. It stores its data through a rank-8 View whose extents
+/// beyond the rank are one. Indexing a DynRankView therefore pays for the
+/// index arithmetic of all eight dimensions; kernels should instead go
+/// through Kokkos::Experimental::visit_static_rank, which hands them a View
+/// of the actual rank over the same allocation.
+
+#ifndef KOKKOS_DYNRANKVIEW_HPP
+#define KOKKOS_DYNRANKVIEW_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_DYNRANKVIEW
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Kokkos {
+
+template <typename DataType, class... Properties>
+class DynRankView;
+
+template <class>
+struct is_dyn_rank_view : public std::false_type {};
+
+template <class D, class... P>
+struct is_dyn_rank_view<DynRankView<D, P...>> : public std::true_type {};
+
+template <class D, class... P>
+struct is_dyn_rank_view<const DynRankView<D, P...>> : public std::true_type {};
+
+template <class T>
+inline constexpr bool is_dyn_rank_view_v = is_dyn_rank_view<T>::value;
+
+namespace Impl {
+
+struct DynRankViewTag {};
+
+template <unsigned N, class T, class... P>
+KOKKOS_FUNCTION View<typename RankDataType<T, N>::type, P...>
+as_view_of_rank_n(DynRankView<T, P...> const& v);
+
+// The number of leading extents of the layout that are set.
+template <class Layout>
+KOKKOS_INLINE_FUNCTION unsigned dyn_rank_view_rank(Layout const& layout) {
+  unsigned rank = 0;
+  while (rank < ARRAY_LAYOUT_MAX_RANK &&
+         layout.dimension[rank] != KOKKOS_IMPL_CTOR_DEFAULT_ARG) {
+    ++rank;
+  }
+  return rank;
+}
+
+// The layout of the first `rank` dimensions of `layout`, with the extents of
+// the remaining dimensions set to `fill`.
+template <class Layout>
+KOKKOS_INLINE_FUNCTION Layout dyn_rank_view_truncate(Layout layout,
+                                                     unsigned rank,
+                                                     size_t fill) {
+  for (unsigned r = rank; r < ARRAY_LAYOUT_MAX_RANK; ++r) {
+    layout.dimension[r] = fill;
+    if constexpr (std::is_same_v<Layout, LayoutStride>) {
+      layout.stride[r] = fill == 1 ? 1 : 0;
+    }
+  }
+  return layout;
+}
+
+// The layout of a static-rank View with the extents and strides of the View.
+template <class Layout, class ViewType>
+KOKKOS_INLINE_FUNCTION Layout dyn_rank_view_layout_of(ViewType const& view) {
+  Layout layout;
+  for (unsigned r = 0; r < ViewType::rank(); ++r) {
+    layout.dimension[r] = view.extent(r);
+    if constexpr (std::is_same_v<Layout, LayoutStride>) {
+      layout.stride[r] = view.stride(r);
+    }
+  }
+  return layout;
+}
+
+/// \brief Makes a View of one rank refer to the allocation of a View of
+///   another rank, with the destination layout given explicitly.
+///
+/// The extents the ranks do not share must be one. Padded LayoutLeft and
+/// LayoutRight Views keep the stride of their padded dimension in the
+/// offset, which the layout cannot express, so it is passed separately.
+template <>
+class ViewMapping<DynRankViewTag> {
+ public:
+  template <class DstView, class SrcView>
+  KOKKOS_INLINE_FUNCTION static void assign(
+      DstView& dst, SrcView const& src,
+      typename DstView::array_layout const& layout, size_t padded_stride) {
+    using dst_traits  = typename DstView::traits;
+    using src_traits  = typename SrcView::traits;
+    using offset_type = typename DstView::map_type::offset_type;
+    static_assert(
+        std::is_same_v<typename dst_traits::value_type,
+                       typename src_traits::value_type> ||
+            std::is_same_v<typename dst_traits::value_type,
+                           typename src_traits::const_value_type>,
+        "Kokkos::DynRankView: incompatible value types");
+    static_assert(MemorySpaceAccess<typename dst_traits::memory_space,
+                                    typename src_traits::memory_space>::
+                      assignable,
+                  "Kokkos::DynRankView: incompatible memory spaces");
+
+    using layout_type = typename dst_traits::array_layout;
+    offset_type offset(std::integral_constant<unsigned, 0>(), layout);
+    if constexpr (!std::is_same_v<layout_type, LayoutStride> &&
+                  1 < dst_traits::rank && 0 < dst_traits::rank_dynamic) {
+      offset.m_stride = padded_stride;
+    }
+    dst.m_track.assign(src);
+    dst.m_map.m_impl_handle =
+        ViewDataHandle<dst_traits>::assign(src.data(), src.impl_track());
+    dst.m_map.m_impl_offset = offset;
+  }
+};
+
+// The stride of the padded dimension of a LayoutLeft or LayoutRight View.
+template <class ViewType>
+KOKKOS_INLINE_FUNCTION size_t dyn_rank_view_padded_stride(
+    ViewType const& view) {
+  using layout = typename ViewType::array_layout;
+  if constexpr (ViewType::rank() < 2) {
+    return std::is_same_v<layout, LayoutLeft> && ViewType::rank() == 1
+               ? view.extent(0)
+               : 1;
+  } else if constexpr (std::is_same_v<layout, LayoutLeft>) {
+    return view.stride(1);
+  } else {
+    return view.stride(0);
+  }
+}
+
+template <class StorageView>
+struct DynRankViewOfStorage {
+  using traits = typename StorageView::traits;
+  using type =
+      DynRankView<typename traits::value_type, typename traits::array_layout,
+                  typename traits::device_type, typename traits::memory_traits>;
+};
+
+}  // namespace Impl
+
+/// \brief A View whose rank is a runtime value between 0 and 8.
+///
+/// \tparam DataType The value type, without any pointer or array extents.
+/// \tparam Properties The layout, memory space and memory traits, as for
+///   View. LayoutLeft, LayoutRight and LayoutStride are supported.
+template <typename DataType, class... Properties>
+class DynRankView : public ViewTraits<DataType, Properties...> {
+  static_assert(ViewTraits<DataType, Properties...>::rank == 0,
+                "Kokkos::DynRankView takes the value type without extents");
+
+ public:
+  using traits = ViewTraits<DataType, Properties...>;
+
+  /// \brief The rank-8 View the data is accessed through.
+  using view_type =
+      View<typename Impl::RankDataType<DataType, 8>::type, Properties...>;
+
+  /// \brief The View of rank N over the same allocation.
+  template <unsigned N>
+  using view_of_rank =
+      View<typename Impl::RankDataType<DataType, N>::type, Properties...>;
+
+  using reference_type = typename view_type::reference_type;
+  using pointer_type   = typename view_type::pointer_type;
+
+  using array_type =
+      DynRankView<typename traits::scalar_array_type,
+                  typename traits::array_layout, typename traits::device_type,
+                  typename traits::memory_traits>;
+  using const_type =
+      DynRankView<typename traits::const_data_type,
+                  typename traits::array_layout, typename traits::device_type,
+                  typename traits::memory_traits>;
+  using non_const_type =
+      DynRankView<typename traits::non_const_data_type,
+                  typename traits::array_layout, typename traits::device_type,
+                  typename traits::memory_traits>;
+  using HostMirror =
+      typename Impl::DynRankViewOfStorage<typename view_type::HostMirror>::type;
+
+ private:
+  template <class, class...>
+  friend class DynRankView;
+
+  view_type m_view;
+  unsigned m_rank = 0;
+
+ public:
+  //----------------------------------------
+  // Rank, extents and strides
+
+  KOKKOS_FUNCTION constexpr unsigned rank() const noexcept { return m_rank; }
+
+  template <typename iType>
+  KOKKOS_FUNCTION constexpr std::enable_if_t<std::is_integral_v<iType>, size_t>
+  extent(iType const& r) const noexcept {
+    return size_t(r) < 8 ? m_view.extent(r) : 1;
+  }
+
+  template <typename iType>
+  KOKKOS_FUNCTION constexpr std::enable_if_t<std::is_integral_v<iType>, int>
+  extent_int(iType const& r) const noexcept {
+    return static_cast<int>(extent(r));
+  }
+
+  template <typename iType>
+  KOKKOS_FUNCTION constexpr std::enable_if_t<std::is_integral_v<iType>, size_t>
+  stride(iType const& r) const {
+    return m_view.stride(r);
+  }
+
+  template <typename iType>
+  KOKKOS_FUNCTION void stride(iType* const s) const {
+    m_view.stride(s);
+  }
+
+  /// \brief The layout with the extents of the first rank() dimensions.
+  KOKKOS_FUNCTION typename traits::array_layout layout() const {
+    return Impl::dyn_rank_view_truncate(m_view.layout(), m_rank,
+                                        KOKKOS_IMPL_CTOR_DEFAULT_ARG);
+  }
+
+  KOKKOS_FUNCTION constexpr size_t size() const { return m_view.size(); }
+  KOKKOS_FUNCTION constexpr size_t span() const { return m_view.span(); }
+  KOKKOS_FUNCTION bool span_is_contiguous() const {
+    return m_view.span_is_contiguous();
+  }
+  KOKKOS_FUNCTION constexpr pointer_type data() const { return m_view.data(); }
+  KOKKOS_FUNCTION constexpr bool is_allocated() const {
+    return m_view.is_allocated();
+  }
+
+  std::string label() const { return m_view.label(); }
+  KOKKOS_FUNCTION int use_count() const { return m_view.use_count(); }
+
+  /// \brief The rank-8 View the data is accessed through.
+  KOKKOS_FUNCTION view_type const& impl_storage() const { return m_view; }
+
+  //----------------------------------------
+  // Element access
+
+  /// \brief The element at the given indices; omitted trailing indices are
+  ///   zero. Bounds-checked builds require one index per dimension.
+  template <typename... Is>
+  KOKKOS_FORCEINLINE_FUNCTION reference_type operator()(Is... indices) const {
+    static_assert(sizeof...(Is) <= 8,
+                  "Kokkos::DynRankView takes at most 8 indices");
+#ifdef KOKKOS_ENABLE_DEBUG_BOUNDS_CHECK
+    if (sizeof...(Is) != m_rank) {
+      Kokkos::abort(
+          "Kokkos::DynRankView: the number of indices does not match the "
+          "rank");
+    }
+#endif
+    return access(std::make_index_sequence<8 - sizeof...(Is)>(), indices...);
+  }
+
+  template <typename iType>
+  KOKKOS_FORCEINLINE_FUNCTION
+      std::enable_if_t<std::is_integral_v<iType>, reference_type>
+      operator[](iType const& i) const {
+    return (*this)(i);
+  }
+
+ private:
+  template <std::size_t... Zeros, typename... Is>
+  KOKKOS_FORCEINLINE_FUNCTION reference_type
+  access(std::index_sequence<Zeros...>, Is... indices) const {
+    return m_view(indices..., (void(Zeros), 0)...);
+  }
+
+ public:
+  //----------------------------------------
+  // Construction
+
+  DynRankView() = default;
+
+  /// \brief Allocates a View of the rank given by the number of extents.
+  template <class... P>
+  explicit DynRankView(Impl::ViewCtorProp<P...> const& arg_prop,
+                       typename traits::array_layout const& layout)
+      : m_view(arg_prop,
+               Impl::dyn_rank_view_truncate(
+                   layout, Impl::dyn_rank_view_rank(layout), 1)),
+        m_rank(Impl::dyn_rank_view_rank(layout)) {}
+
+  explicit DynRankView(std::string const& label,
+                       typename traits::array_layout const& layout)
+      : DynRankView(view_alloc(label), layout) {}
+
+  explicit DynRankView(std::string const& label,
+                       size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG)
+      : DynRankView(view_alloc(label), typename traits::array_layout(
+                                           n0, n1, n2, n3, n4, n5, n6, n7)) {
+    static_assert(!std::is_same_v<typename traits::array_layout, LayoutStride>,
+                  "Kokkos::DynRankView: LayoutStride requires a layout");
+  }
+
+  /// \brief Wraps unmanaged memory.
+  KOKKOS_FUNCTION
+  explicit DynRankView(pointer_type ptr,
+                       typename traits::array_layout const& layout)
+      : m_view(ptr, Impl::dyn_rank_view_truncate(
+                        layout, Impl::dyn_rank_view_rank(layout), 1)),
+        m_rank(Impl::dyn_rank_view_rank(layout)) {}
+
+  KOKKOS_FUNCTION
+  explicit DynRankView(pointer_type ptr,
+                       size_t n0 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n1 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n2 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n3 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n4 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n5 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n6 = KOKKOS_IMPL_CTOR_DEFAULT_ARG,
+                       size_t n7 = KOKKOS_IMPL_CTOR_DEFAULT_ARG)
+      : DynRankView(ptr, typename traits::array_layout(n0, n1, n2, n3, n4, n5,
+                                                       n6, n7)) {
+    static_assert(!std::is_same_v<typename traits::array_layout, LayoutStride>,
+                  "Kokkos::DynRankView: LayoutStride requires a layout");
+  }
+
+  /// \brief Views the first \c rank dimensions of the rank-8 View, whose
+  ///   other extents must be one.
+  KOKKOS_FUNCTION DynRankView(view_type const& storage, unsigned rank)
+      : m_view(storage), m_rank(rank) {}
+
+  /// \brief Views the same data as another DynRankView, e.g. as const.
+  template <class RT, class... RP>
+  KOKKOS_FUNCTION DynRankView(DynRankView<RT, RP...> const& rhs)
+      : m_view(rhs.m_view), m_rank(rhs.m_rank) {}
+
+  /// \brief Views the same data as a View of static rank.
+  template <class RT, class... RP>
+  KOKKOS_FUNCTION DynRankView(View<RT, RP...> const& rhs)
+      : m_rank(View<RT, RP...>::rank()) {
+    using src_layout = typename View<RT, RP...>::array_layout;
+    using dst_layout = typename traits::array_layout;
+    static_assert(std::is_same_v<src_layout, dst_layout> ||
+                      (std::is_same_v<dst_layout, LayoutStride> &&
+                       (std::is_same_v<src_layout, LayoutLeft> ||
+                        std::is_same_v<src_layout, LayoutRight>)),
+                  "Kokkos::DynRankView: incompatible layouts");
+    size_t padded_stride = 0;
+    if constexpr (!std::is_same_v<dst_layout, LayoutStride>) {
+      padded_stride = Impl::dyn_rank_view_padded_stride(rhs);
+    }
+    Impl::ViewMapping<Impl::DynRankViewTag>::assign(
+        m_view, rhs,
+        Impl::dyn_rank_view_truncate(
+            Impl::dyn_rank_view_layout_of<dst_layout>(rhs), m_rank, 1),
+        padded_stride);
+  }
+
+  /// \brief The View of static rank over the same data; aborts if the rank
+  ///   of the View differs.
+  template <class RT, class... RP>
+  KOKKOS_FUNCTION operator View<RT, RP...>() const {
+    return View<RT, RP...>(
+        Impl::as_view_of_rank_n<View<RT, RP...>::rank()>(*this));
+  }
+};
+
+namespace Impl {
+
+/// \brief The View of rank N over the data of the DynRankView, which must
+///   have rank N.
+template <unsigned N, class T, class... P>
+KOKKOS_FUNCTION View<typename RankDataType<T, N>::type, P...>
+as_view_of_rank_n(DynRankView<T, P...> const& v) {
+  using view_type = View<typename RankDataType<T, N>::type, P...>;
+  using layout    = typename view_type::array_layout;
+  if (v.rank() != N) {
+    Kokkos::abort(
+        "Kokkos::DynRankView: converting to a View of a different rank");
+  }
+  view_type result;
+  auto const& storage = v.impl_storage();
+  size_t padded_stride = 0;
+  if constexpr (!std::is_same_v<layout, LayoutStride>) {
+    padded_stride = dyn_rank_view_padded_stride(storage);
+  }
+  ViewMapping<DynRankViewTag>::assign(
+      result, storage,
+      dyn_rank_view_truncate(storage.layout(), N,
+                             KOKKOS_IMPL_CTOR_DEFAULT_ARG),
+      padded_stride);
+  return result;
+}
+
+// Calls f with std::integral_constant<unsigned, rank>.
+template <class Function>
+decltype(auto) dyn_rank_view_dispatch(unsigned rank, Function&& f) {
+  switch (rank) {
+    case 0: return f(std::integral_constant<unsigned, 0>());
+    case 1: return f(std::integral_constant<unsigned, 1>());
+    case 2: return f(std::integral_constant<unsigned, 2>());
+    case 3: return f(std::integral_constant<unsigned, 3>());
+    case 4: return f(std::integral_constant<unsigned, 4>());
+    case 5: return f(std::integral_constant<unsigned, 5>());
+    case 6: return f(std::integral_constant<unsigned, 6>());
+    case 7: return f(std::integral_constant<unsigned, 7>());
+    default: return f(std::integral_constant<unsigned, 8>());
+  }
+}
+
+template <typename Function, typename T, typename... P>
+void apply_to_view_of_static_rank(Function&& f, DynRankView<T, P...> a) {
+  dyn_rank_view_dispatch(a.rank(), [&](auto rank) {
+    f(as_view_of_rank_n<decltype(rank)::value>(a));
+  });
+}
+
+template <class SrcView>
+void dyn_rank_view_check_rank(unsigned dst_rank, SrcView const& src,
+                              char const* function) {
+  if (dst_rank != src.rank()) {
+    Kokkos::Impl::throw_runtime_exception(
+        std::string(function) +
+        ": the ranks of the destination and the source differ");
+  }
+}
+
+}  // namespace Impl
+
+namespace Experimental {
+
+/// \brief Calls \c f with the View of the actual rank of the DynRankView
+///   and returns its result.
+///
+/// \c f is instantiated for every rank from 0 to 8, so kernels launched from
+/// it index with the arithmetic of the actual rank.
+template <class Function, class T, class... P>
+decltype(auto) visit_static_rank(Function&& f, DynRankView<T, P...> const& v) {
+  return Kokkos::Impl::dyn_rank_view_dispatch(
+      v.rank(), [&](auto rank) -> decltype(auto) {
+        return f(Kokkos::Impl::as_view_of_rank_n<decltype(rank)::value>(v));
+      });
+}
+
+}  // namespace Experimental
+
+//----------------------------------------------------------------------------
+// Subviews
+
+/// \brief The subview of the DynRankView, which takes one argument per
+///   dimension; its rank is the number of ranges among them.
+template <class T, class... P, class... Args>
+auto subdynrankview(DynRankView<T, P...> const& v, Args const&... args) {
+  constexpr unsigned rank = sizeof...(Args);
+  static_assert(rank <= 8, "Kokkos::subdynrankview takes at most 8 arguments");
+  if (v.rank() != rank) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::subdynrankview: the number of arguments must equal the rank");
+  }
+  if constexpr (rank == 0) {
+    return v;
+  } else {
+    auto sub = Kokkos::subview(Impl::as_view_of_rank_n<rank>(v), args...);
+    using sub_type = decltype(sub);
+    return DynRankView<typename sub_type::value_type,
+                       typename sub_type::array_layout,
+                       typename sub_type::device_type,
+                       typename sub_type::memory_traits>(sub);
+  }
+}
+
+template <class T, class... P, class... Args>
+auto subview(DynRankView<T, P...> const& v, Args const&... args) {
+  return subdynrankview(v, args...);
+}
+
+//----------------------------------------------------------------------------
+// Deep copies go through Views of the actual rank, so they take the same
+// contiguous and rank-specialized paths as deep copies of static-rank Views.
+
+template <class DT, class... DP, class ST, class... SP>
+void deep_copy(DynRankView<DT, DP...> const& dst,
+               DynRankView<ST, SP...> const& src) {
+  Impl::dyn_rank_view_check_rank(dst.rank(), src, "Kokkos::deep_copy");
+  Impl::dyn_rank_view_dispatch(dst.rank(), [&](auto rank) {
+    constexpr unsigned r = decltype(rank)::value;
+    Kokkos::deep_copy(Impl::as_view_of_rank_n<r>(dst),
+                      Impl::as_view_of_rank_n<r>(src));
+  });
+}
+
+template <class ExecSpace, class DT, class... DP, class ST, class... SP>
+std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>> deep_copy(
+    ExecSpace const& exec, DynRankView<DT, DP...> const& dst,
+    DynRankView<ST, SP...> const& src) {
+  Impl::dyn_rank_view_check_rank(dst.rank(), src, "Kokkos::deep_copy");
+  Impl::dyn_rank_view_dispatch(dst.rank(), [&](auto rank) {
+    constexpr unsigned r = decltype(rank)::value;
+    Kokkos::deep_copy(exec, Impl::as_view_of_rank_n<r>(dst),
+                      Impl::as_view_of_rank_n<r>(src));
+  });
+}
+
+template <class DT, class... DP, class ST, class... SP>
+void deep_copy(DynRankView<DT, DP...> const& dst,
+               View<ST, SP...> const& src) {
+  Impl::dyn_rank_view_check_rank(dst.rank(), src, "Kokkos::deep_copy");
+  Kokkos::deep_copy(Impl::as_view_of_rank_n<View<ST, SP...>::rank()>(dst),
+                    src);
+}
+
+template <class ExecSpace, class DT, class... DP, class ST, class... SP>
+std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>> deep_copy(
+    ExecSpace const& exec, DynRankView<DT, DP...> const& dst,
+    View<ST, SP...> const& src) {
+  Impl::dyn_rank_view_check_rank(dst.rank(), src, "Kokkos::deep_copy");
+  Kokkos::deep_copy(exec,
+                    Impl::as_view_of_rank_n<View<ST, SP...>::rank()>(dst), src);
+}
+
+template <class DT, class... DP, class ST, class... SP>
+void deep_copy(View<DT, DP...> const& dst,
+               DynRankView<ST, SP...> const& src) {
+  Impl::dyn_rank_view_check_rank(dst.rank(), src, "Kokkos::deep_copy");
+  Kokkos::deep_copy(dst,
+                    Impl::as_view_of_rank_n<View<DT, DP...>::rank()>(src));
+}
+
+template <class ExecSpace, class DT, class... DP, class ST, class... SP>
+std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>> deep_copy(
+    ExecSpace const& exec, View<DT, DP...> const& dst,
+    DynRankView<ST, SP...> const& src) {
+  Impl::dyn_rank_view_check_rank(dst.rank(), src, "Kokkos::deep_copy");
+  Kokkos::deep_copy(exec, dst,
+                    Impl::as_view_of_rank_n<View<DT, DP...>::rank()>(src));
+}
+
+template <class DT, class... DP>
+void deep_copy(DynRankView<DT, DP...> const& dst,
+               typename ViewTraits<DT, DP...>::const_value_type& value) {
+  Impl::dyn_rank_view_dispatch(dst.rank(), [&](auto rank) {
+    Kokkos::deep_copy(Impl::as_view_of_rank_n<decltype(rank)::value>(dst),
+                      value);
+  });
+}
+
+template <class ExecSpace, class DT, class... DP>
+std::enable_if_t<Kokkos::is_execution_space_v<ExecSpace>> deep_copy(
+    ExecSpace const& exec, DynRankView<DT, DP...> const& dst,
+    typename ViewTraits<DT, DP...>::const_value_type& value) {
+  Impl::dyn_rank_view_dispatch(dst.rank(), [&](auto rank) {
+    Kokkos::deep_copy(
+        exec, Impl::as_view_of_rank_n<decltype(rank)::value>(dst), value);
+  });
+}
+
+template <class ST, class... SP>
+void deep_copy(typename ViewTraits<ST, SP...>::non_const_value_type& dst,
+               DynRankView<ST, SP...> const& src) {
+  Kokkos::deep_copy(dst, Impl::as_view_of_rank_n<0>(src));
+}
+
+//----------------------------------------------------------------------------
+// Mirrors are mirrors of the rank-8 View with the rank carried over.
+
+template <class T, class... P>
+typename DynRankView<T, P...>::HostMirror create_mirror(
+    DynRankView<T, P...> const& v) {
+  return {Kokkos::create_mirror(v.impl_storage()), v.rank()};
+}
+
+template <class T, class... P>
+typename DynRankView<T, P...>::HostMirror create_mirror(
+    Kokkos::Impl::WithoutInitializing_t wi, DynRankView<T, P...> const& v) {
+  return {Kokkos::create_mirror(wi, v.impl_storage()), v.rank()};
+}
+
+template <class Space, class T, class... P,
+          typename Enable = std::enable_if_t<Kokkos::is_space<Space>::value>>
+auto create_mirror(Space const& space, DynRankView<T, P...> const& v) {
+  auto storage = Kokkos::create_mirror(space, v.impl_storage());
+  return typename Impl::DynRankViewOfStorage<decltype(storage)>::type(
+      storage, v.rank());
+}
+
+template <class Space, class T, class... P,
+          typename Enable = std::enable_if_t<Kokkos::is_space<Space>::value>>
+auto create_mirror(Kokkos::Impl::WithoutInitializing_t wi, Space const& space,
+                   DynRankView<T, P...> const& v) {
+  auto storage = Kokkos::create_mirror(wi, space, v.impl_storage());
+  return typename Impl::DynRankViewOfStorage<decltype(storage)>::type(
+      storage, v.rank());
+}
+
+/// \brief The DynRankView itself if it is host accessible, a host mirror
+///   otherwise.
+template <class T, class... P>
+typename DynRankView<T, P...>::HostMirror create_mirror_view(
+    DynRankView<T, P...> const& v) {
+  return {Kokkos::create_mirror_view(v.impl_storage()), v.rank()};
+}
+
+template <class T, class... P>
+typename DynRankView<T, P...>::HostMirror create_mirror_view(
+    Kokkos::Impl::WithoutInitializing_t wi, DynRankView<T, P...> const& v) {
+  return {Kokkos::create_mirror_view(wi, v.impl_storage()), v.rank()};
+}
+
+template <class Space, class T, class... P,
+          typename Enable = std::enable_if_t<Kokkos::is_space<Space>::value>>
+auto create_mirror_view(Space const& space, DynRankView<T, P...> const& v) {
+  auto storage = Kokkos::create_mirror_view(space, v.impl_storage());
+  return typename Impl::DynRankViewOfStorage<decltype(storage)>::type(
+      storage, v.rank());
+}
+
+template <class Space, class T, class... P,
+          typename Enable = std::enable_if_t<Kokkos::is_space<Space>::value>>
+auto create_mirror_view(Kokkos::Impl::WithoutInitializing_t wi,
+                        Space const& space, DynRankView<T, P...> const& v) {
+  auto storage = Kokkos::create_mirror_view(wi, space, v.impl_storage());
+  return typename Impl::DynRankViewOfStorage<decltype(storage)>::type(
+      storage, v.rank());
+}
+
+template <class Space, class T, class... P,
+          typename Enable = std::enable_if_t<Kokkos::is_space<Space>::value>>
+auto create_mirror_view_and_copy(Space const& space,
+                                 DynRankView<T, P...> const& v,
+                                 std::string const& name = "") {
+  auto storage =
+      Kokkos::create_mirror_view_and_copy(space, v.impl_storage(), name);
+  return typename Impl::DynRankViewOfStorage<decltype(storage)>::type(
+      storage, v.rank());
+}
+
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_DYNRANKVIEW
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_DYNRANKVIEW
+#endif
+#endif
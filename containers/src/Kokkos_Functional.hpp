@@ -0,0 +1,151 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_Functional.hpp
+/// \brief Hash and equality functors for plain-old-data keys, as used by
+///   Kokkos::UnorderedMap.
+
+#ifndef KOKKOS_FUNCTIONAL_HPP
+#define KOKKOS_FUNCTIONAL_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_FUNCTIONAL
+#endif
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Impl {
+
+KOKKOS_FORCEINLINE_FUNCTION
+std::uint32_t rotl32(std::uint32_t x, int r) {
+  return (x << r) | (x >> (32 - r));
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+std::uint32_t fmix32(std::uint32_t h) {
+  h ^= h >> 16;
+  h *= 0x85ebca6b;
+  h ^= h >> 13;
+  h *= 0xc2b2ae35;
+  h ^= h >> 16;
+  return h;
+}
+
+// MurmurHash3_x86_32 by Austin Appleby (public domain). The key is read one
+// byte at a time so that it may have any alignment.
+KOKKOS_INLINE_FUNCTION
+std::uint32_t murmur_hash3_x86_32(void const* key, int len,
+                                  std::uint32_t seed) {
+  auto const* data  = static_cast<unsigned char const*>(key);
+  int const nblocks = len / 4;
+
+  std::uint32_t h1           = seed;
+  constexpr std::uint32_t c1 = 0xcc9e2d51;
+  constexpr std::uint32_t c2 = 0x1b873593;
+
+  for (int i = 0; i < nblocks; ++i) {
+    std::uint32_t k1 = std::uint32_t(data[4 * i]) |
+                       std::uint32_t(data[4 * i + 1]) << 8 |
+                       std::uint32_t(data[4 * i + 2]) << 16 |
+                       std::uint32_t(data[4 * i + 3]) << 24;
+    k1 *= c1;
+    k1 = rotl32(k1, 15);
+    k1 *= c2;
+
+    h1 ^= k1;
+    h1 = rotl32(h1, 13);
+    h1 = h1 * 5 + 0xe6546b64;
+  }
+
+  unsigned char const* tail = data + nblocks * 4;
+  std::uint32_t k1          = 0;
+  switch (len & 3) {
+    case 3:
+      k1 ^= std::uint32_t(tail[2]) << 16;
+      [[fallthrough]];
+    case 2:
+      k1 ^= std::uint32_t(tail[1]) << 8;
+      [[fallthrough]];
+    case 1:
+      k1 ^= tail[0];
+      k1 *= c1;
+      k1 = rotl32(k1, 15);
+      k1 *= c2;
+      h1 ^= k1;
+  }
+
+  h1 ^= std::uint32_t(len);
+  return fmix32(h1);
+}
+
+}  // namespace Impl
+
+/// \brief Hashes the object representation of a trivially copyable key.
+template <class T>
+struct pod_hash {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Kokkos::pod_hash requires a trivially copyable key");
+
+  using argument_type        = T;
+  using first_argument_type  = T;
+  using second_argument_type = std::uint32_t;
+  using result_type          = std::uint32_t;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  std::uint32_t operator()(T const& t) const {
+    return Impl::murmur_hash3_x86_32(&t, sizeof(T), 0);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  std::uint32_t operator()(T const& t, std::uint32_t seed) const {
+    return Impl::murmur_hash3_x86_32(&t, sizeof(T), seed);
+  }
+};
+
+/// \brief Compares the object representations of two trivially copyable keys,
+///   which keeps equality consistent with pod_hash.
+template <class T>
+struct pod_equal_to {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "Kokkos::pod_equal_to requires a trivially copyable key");
+
+  using first_argument_type  = T;
+  using second_argument_type = T;
+  using result_type          = bool;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  bool operator()(T const& a, T const& b) const {
+    auto const* pa = reinterpret_cast<unsigned char const*>(&a);
+    auto const* pb = reinterpret_cast<unsigned char const*>(&b);
+    for (std::size_t i = 0; i < sizeof(T); ++i) {
+      if (pa[i] != pb[i]) return false;
+    }
+    return true;
+  }
+};
+
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_FUNCTIONAL
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_FUNCTIONAL
+#endif
+#endif
@@ -0,0 +1,498 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_ScatterView.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::ScatterView.
+///
+/// A ScatterView collects contributions that many threads make to arbitrary
+/// entries of a View, as in finite-element assembly or histograms, without
+/// the caller having to pick between atomics and per-thread copies.
+
+#ifndef KOKKOS_SCATTER_VIEW_HPP
+#define KOKKOS_SCATTER_VIEW_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_SCATTERVIEW
+#endif
+
+#include <Kokkos_Core.hpp>
+
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+// How contributions combine with each other and with the original values.
+struct ScatterSum {};
+struct ScatterProd {};
+struct ScatterMax {};
+struct ScatterMin {};
+
+// Whether each thread contributes to a private copy of the View.
+struct ScatterNonDuplicated {};
+struct ScatterDuplicated {};
+
+// Whether contributions to shared storage use atomic operations.
+struct ScatterNonAtomic {};
+struct ScatterAtomic {};
+
+/// \brief Upper bound in bytes for the private copies of one ScatterView.
+///
+/// A duplicated ScatterView whose copies would exceed the limit contributes
+/// atomically to the original View instead. The default limit is half of the
+/// physical memory that is free when the ScatterView is created.
+void set_scatter_view_duplication_limit(std::size_t bytes);
+void reset_scatter_view_duplication_limit();
+std::size_t scatter_view_duplication_limit();
+
+namespace Impl {
+
+// Host backends run few, long-lived threads for which private copies are
+// cheap and atomics under contention are not; devices run too many threads
+// for copies and have fast atomics.
+template <class ExecSpace>
+struct DefaultDuplication {
+  using type =
+      std::conditional_t<SpaceAccessibility<ExecSpace, HostSpace>::accessible,
+                         ScatterDuplicated, ScatterNonDuplicated>;
+};
+
+template <class ExecSpace, class Duplication>
+struct DefaultContribution {
+  using type =
+      std::conditional_t<std::is_same_v<Duplication, ScatterDuplicated>,
+                         ScatterNonAtomic, ScatterAtomic>;
+};
+
+#ifdef KOKKOS_ENABLE_SERIAL
+template <>
+struct DefaultDuplication<Kokkos::Serial> {
+  using type = ScatterNonDuplicated;
+};
+
+template <class Duplication>
+struct DefaultContribution<Kokkos::Serial, Duplication> {
+  using type = ScatterNonAtomic;
+};
+#endif
+
+// The atomic counterpart of each operation. The identities and the
+// non-atomic joins are those of the matching reducer.
+template <class Op, class ValueType, class Space>
+struct ScatterOpTraits;
+
+template <class ValueType, class Space>
+struct ScatterOpTraits<ScatterSum, ValueType, Space> {
+  using reducer_type = Kokkos::Sum<ValueType, Space>;
+  KOKKOS_FORCEINLINE_FUNCTION static void atomic_join(ValueType* dest,
+                                                      ValueType const& src) {
+    Kokkos::atomic_add(dest, src);
+  }
+};
+
+template <class ValueType, class Space>
+struct ScatterOpTraits<ScatterProd, ValueType, Space> {
+  using reducer_type = Kokkos::Prod<ValueType, Space>;
+  KOKKOS_FORCEINLINE_FUNCTION static void atomic_join(ValueType* dest,
+                                                      ValueType const& src) {
+    Kokkos::atomic_mul(dest, src);
+  }
+};
+
+template <class ValueType, class Space>
+struct ScatterOpTraits<ScatterMax, ValueType, Space> {
+  using reducer_type = Kokkos::Max<ValueType, Space>;
+  KOKKOS_FORCEINLINE_FUNCTION static void atomic_join(ValueType* dest,
+                                                      ValueType const& src) {
+    Kokkos::atomic_max(dest, src);
+  }
+};
+
+template <class ValueType, class Space>
+struct ScatterOpTraits<ScatterMin, ValueType, Space> {
+  using reducer_type = Kokkos::Min<ValueType, Space>;
+  KOKKOS_FORCEINLINE_FUNCTION static void atomic_join(ValueType* dest,
+                                                      ValueType const& src) {
+    Kokkos::atomic_min(dest, src);
+  }
+};
+
+template <class Op, class ValueType, class Space>
+struct ScatterOp : ScatterOpTraits<Op, ValueType, Space> {
+  using reducer_type =
+      typename ScatterOpTraits<Op, ValueType, Space>::reducer_type;
+
+  // Reducers only read their result View in final(), so an empty one does.
+  KOKKOS_FORCEINLINE_FUNCTION static reducer_type reducer() {
+    return reducer_type(typename reducer_type::result_view_type());
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static void init(ValueType& value) {
+    reducer().init(value);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static void join(ValueType& dest,
+                                               ValueType const& src) {
+    reducer().join(dest, src);
+  }
+};
+
+// Stands in for a UniqueToken where no thread ids are needed.
+struct ScatterNoToken {
+  ScatterNoToken() = default;
+  template <class T>
+  KOKKOS_FUNCTION explicit ScatterNoToken(T const&) {}
+  KOKKOS_FUNCTION int value() const { return 0; }
+};
+
+template <class ExecSpace, class ValueType, class Op>
+struct ScatterViewReset {
+  ValueType* m_data;
+
+  KOKKOS_FUNCTION void operator()(std::size_t i) const { Op::init(m_data[i]); }
+};
+
+// Joins the copies of each entry, copy by copy, into the destination.
+template <class ExecSpace, class ValueType, class Op>
+struct ScatterViewContribute {
+  ValueType const* m_copies;
+  std::size_t m_count;
+  std::size_t m_stride;
+  ValueType* m_dest;
+
+  KOKKOS_FUNCTION void operator()(std::size_t i) const {
+    ValueType value = m_copies[i];
+    for (std::size_t c = 1; c < m_count; ++c) {
+      Op::join(value, m_copies[c * m_stride + i]);
+    }
+    Op::join(m_dest[i], value);
+  }
+};
+
+}  // namespace Impl
+
+/// \brief Reference to one entry of a ScatterView that only accepts
+/// contributions.
+template <class ValueType, class Op, class Space>
+class ScatterValue {
+  using op_type = Impl::ScatterOp<Op, ValueType, Space>;
+
+ public:
+  KOKKOS_FORCEINLINE_FUNCTION ScatterValue(ValueType& value, bool atomic)
+      : m_value(value), m_atomic(atomic) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION void update(ValueType const& rhs) const {
+    if (m_atomic) {
+      op_type::atomic_join(&m_value, rhs);
+    } else {
+      op_type::join(m_value, rhs);
+    }
+  }
+
+  template <class O = Op>
+  KOKKOS_FORCEINLINE_FUNCTION std::enable_if_t<std::is_same_v<O, ScatterSum>>
+  operator+=(ValueType const& rhs) const {
+    update(rhs);
+  }
+  template <class O = Op>
+  KOKKOS_FORCEINLINE_FUNCTION std::enable_if_t<std::is_same_v<O, ScatterSum>>
+  operator-=(ValueType const& rhs) const {
+    update(-rhs);
+  }
+  template <class O = Op>
+  KOKKOS_FORCEINLINE_FUNCTION std::enable_if_t<std::is_same_v<O, ScatterProd>>
+  operator*=(ValueType const& rhs) const {
+    update(rhs);
+  }
+  template <class O = Op>
+  KOKKOS_FORCEINLINE_FUNCTION std::enable_if_t<std::is_same_v<O, ScatterProd>>
+  operator/=(ValueType const& rhs) const {
+    update(ValueType(1) / rhs);
+  }
+
+ private:
+  ValueType& m_value;
+  bool m_atomic;
+};
+
+template <class ScatterViewType>
+class ScatterAccess;
+
+/// \class ScatterView
+/// \brief Accumulates contributions to the entries of a View.
+///
+/// Contributions go through an access object obtained inside the kernel:
+/// \code
+///   auto access = scatter.access();
+///   access(bin(i)) += weight(i);
+/// \endcode
+/// and reach the original View once contribute() is called.
+///
+/// With ScatterDuplicated each thread accumulates into a private copy that
+/// starts out at the identity of Op, and contribute() joins the copies into
+/// the destination in parallel. The copies are skipped, and contributions go
+/// atomically to the original View, when the execution space runs a single
+/// thread, when the original View is not contiguous, or when the copies would
+/// exceed scatter_view_duplication_limit(). With ScatterNonDuplicated all
+/// contributions go to the original View, atomically if Contribution is
+/// ScatterAtomic.
+///
+/// Private copies are indexed by the global UniqueToken of the execution
+/// space; kernels running concurrently on different instances must not
+/// share a duplicated ScatterView unless Contribution is ScatterAtomic.
+template <class DataType,
+          class Layout     = Kokkos::DefaultExecutionSpace::array_layout,
+          class DeviceType = Kokkos::DefaultExecutionSpace,
+          class Op         = ScatterSum,
+          class Duplication =
+              typename Impl::DefaultDuplication<
+                  typename DeviceType::execution_space>::type,
+          class Contribution = typename Impl::DefaultContribution<
+              typename DeviceType::execution_space, Duplication>::type>
+class ScatterView {
+ public:
+  using execution_space = typename DeviceType::execution_space;
+  using memory_space    = typename DeviceType::memory_space;
+  using device_type     = Kokkos::Device<execution_space, memory_space>;
+  using original_view_type = Kokkos::View<DataType, Layout, device_type>;
+  using original_value_type =
+      typename original_view_type::non_const_value_type;
+  using unmanaged_view_type =
+      Kokkos::View<DataType, Layout, device_type,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using value_type  = ScatterValue<original_value_type, Op, memory_space>;
+  using access_type = ScatterAccess<ScatterView>;
+
+  static constexpr bool is_duplicated =
+      std::is_same_v<Duplication, ScatterDuplicated>;
+  static constexpr bool is_atomic = std::is_same_v<Contribution, ScatterAtomic>;
+
+  static_assert(!is_duplicated ||
+                    SpaceAccessibility<execution_space, HostSpace>::accessible,
+                "Kokkos::ScatterView: ScatterDuplicated is only supported on "
+                "host execution spaces");
+
+ private:
+  using op_type = Impl::ScatterOp<Op, original_value_type, memory_space>;
+  using token_type =
+      std::conditional_t<is_duplicated,
+                         UniqueToken<execution_space, UniqueTokenScope::Global>,
+                         Impl::ScatterNoToken>;
+  using copies_view_type =
+      Kokkos::View<original_value_type**, Kokkos::LayoutRight, device_type>;
+
+  friend access_type;
+
+ public:
+  ScatterView() = default;
+
+  template <class RT, class... RP>
+  ScatterView(View<RT, RP...> const& original_view)
+      : ScatterView(execution_space(), original_view) {}
+
+  template <class RT, class... RP>
+  ScatterView(execution_space const& space,
+              View<RT, RP...> const& original_view)
+      : m_original(original_view) {
+    setup(space);
+  }
+
+  template <class... Dims>
+  ScatterView(std::string const& name, Dims... dims)
+      : m_original(name, dims...) {
+    setup(execution_space());
+  }
+
+  KOKKOS_FUNCTION access_type access() const { return access_type(*this); }
+
+  original_view_type subview() const { return m_original; }
+
+  KOKKOS_FUNCTION bool is_allocated() const {
+    return m_original.is_allocated();
+  }
+
+  /// Whether contributions go to private copies rather than to the original.
+  bool duplicates() const { return m_copies.extent(0) > 0; }
+
+  /// Joins the contributions into dest, which must be contiguous and have the
+  /// extents and layout of the original View. Without private copies the
+  /// contributions are already in the original View, and contributing into
+  /// another View joins the whole original into it.
+  void contribute_into(original_view_type const& dest) const {
+    contribute_into(execution_space(), dest);
+  }
+
+  void contribute_into(execution_space const& space,
+                       original_view_type const& dest) const {
+    using functor_type =
+        Impl::ScatterViewContribute<execution_space, original_value_type,
+                                    op_type>;
+    if (!duplicates() && dest.data() == m_original.data()) return;
+    if (!dest.span_is_contiguous() || !m_original.span_is_contiguous() ||
+        dest.size() != m_original.size()) {
+      Kokkos::Impl::throw_runtime_exception(
+          "Kokkos::ScatterView::contribute_into: the destination must be "
+          "contiguous and match the extents of the original View");
+    }
+    std::size_t const count  = duplicates() ? m_copies.extent(0) : 1;
+    std::size_t const stride = duplicates() ? m_copies.extent(1) : 0;
+    original_value_type const* copies =
+        duplicates() ? m_copies.data() : m_original.data();
+    Kokkos::parallel_for(
+        "Kokkos::ScatterView::ReduceDuplicates",
+        RangePolicy<execution_space>(space, 0, m_original.size()),
+        functor_type{copies, count, stride, dest.data()});
+  }
+
+  /// Sets the private copies back to the identity of Op so that a new round
+  /// of contributions can start after contribute(). Does nothing when the
+  /// contributions go straight to the original View.
+  void reset(execution_space const& space = execution_space()) {
+    using functor_type =
+        Impl::ScatterViewReset<execution_space, original_value_type, op_type>;
+    if (!duplicates()) return;
+    Kokkos::parallel_for(
+        "Kokkos::ScatterView::ResetDuplicates",
+        RangePolicy<execution_space>(space, 0, m_copies.size()),
+        functor_type{m_copies.data()});
+  }
+
+ private:
+  void setup(execution_space const& space) {
+    if constexpr (is_duplicated) {
+      m_token                  = token_type(space);
+      std::size_t const count  = m_token.size();
+      std::size_t const span   = m_original.span();
+      bool const fits =
+          count * span <= scatter_view_duplication_limit() /
+                              sizeof(original_value_type);
+      if (count > 1 && m_original.span_is_contiguous() && fits) {
+        m_copies = copies_view_type(
+            view_alloc(WithoutInitializing, space,
+                       m_original.label() + "_duplicates"),
+            count, span);
+        reset(space);
+      } else {
+        m_atomic = count > 1;
+      }
+    }
+  }
+
+  // Where the holder of the given token contributes.
+  KOKKOS_FUNCTION unmanaged_view_type impl_storage(int token) const {
+    if constexpr (is_duplicated) {
+      if (m_copies.extent(0) > 0) {
+        return unmanaged_view_type(m_copies.data() + token * m_copies.extent(1),
+                                   m_original.layout());
+      }
+    }
+    (void)token;
+    return m_original;
+  }
+
+  original_view_type m_original;
+  copies_view_type m_copies;
+  token_type m_token;
+  bool m_atomic = is_atomic;
+};
+
+/// \brief The per-thread handle through which kernels contribute to a
+/// ScatterView.
+template <class ScatterViewType>
+class ScatterAccess {
+  using view_type     = typename ScatterViewType::unmanaged_view_type;
+  using acquired_type = std::conditional_t<
+      ScatterViewType::is_duplicated,
+      AcquireUniqueToken<typename ScatterViewType::execution_space,
+                         UniqueTokenScope::Global>,
+      Impl::ScatterNoToken>;
+
+ public:
+  using value_type = typename ScatterViewType::value_type;
+
+  KOKKOS_FUNCTION explicit ScatterAccess(ScatterViewType const& scatter_view)
+      : m_acquired(scatter_view.m_token),
+        m_view(scatter_view.impl_storage(m_acquired.value())),
+        m_atomic(scatter_view.m_atomic) {}
+
+  template <class... Args>
+  KOKKOS_FORCEINLINE_FUNCTION value_type operator()(Args... args) const {
+    return value_type(m_view(args...), atomic());
+  }
+
+  template <class Arg>
+  KOKKOS_FORCEINLINE_FUNCTION value_type operator[](Arg arg) const {
+    return value_type(m_view[arg], atomic());
+  }
+
+ private:
+  // Lets the compiler drop the runtime check when the choice is static.
+  KOKKOS_FORCEINLINE_FUNCTION bool atomic() const {
+    if constexpr (ScatterViewType::is_atomic) {
+      return true;
+    } else if constexpr (!ScatterViewType::is_duplicated) {
+      return false;
+    } else {
+      return m_atomic;
+    }
+  }
+
+  acquired_type m_acquired;
+  view_type m_view;
+  bool m_atomic;
+};
+
+template <class Op = ScatterSum, class RT, class... RP>
+ScatterView<typename View<RT, RP...>::non_const_data_type,
+            typename View<RT, RP...>::array_layout,
+            typename View<RT, RP...>::device_type, Op>
+create_scatter_view(View<RT, RP...> const& original_view) {
+  return original_view;
+}
+
+template <class Op, class Duplication, class Contribution, class RT,
+          class... RP>
+ScatterView<typename View<RT, RP...>::non_const_data_type,
+            typename View<RT, RP...>::array_layout,
+            typename View<RT, RP...>::device_type, Op, Duplication,
+            Contribution>
+create_scatter_view(Op, Duplication, Contribution,
+                    View<RT, RP...> const& original_view) {
+  return original_view;
+}
+
+template <class DT1, class... VP, class DT2, class LY, class DV, class OP,
+          class DU, class CO>
+void contribute(View<DT1, VP...> const& dest,
+                ScatterView<DT2, LY, DV, OP, DU, CO> const& src) {
+  src.contribute_into(dest);
+}
+
+template <class ExecSpace, class DT1, class... VP, class DT2, class LY,
+          class DV, class OP, class DU, class CO>
+void contribute(ExecSpace const& space, View<DT1, VP...> const& dest,
+                ScatterView<DT2, LY, DV, OP, DU, CO> const& src) {
+  src.contribute_into(space, dest);
+}
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_SCATTERVIEW
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_SCATTERVIEW
+#endif
+#endif
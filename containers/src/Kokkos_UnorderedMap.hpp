@@ -0,0 +1,421 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_UnorderedMap.hpp
+/// \brief Declaration and definition of Kokkos::UnorderedMap.
+///
+/// UnorderedMap is a fixed-capacity hash map whose insert, find and erase may
+/// be called concurrently from inside parallel kernels without locks. When an
+/// insert finds the map full it fails and is counted, so that the caller can
+/// rehash to a larger capacity and retry the failed work.
+
+#ifndef KOKKOS_UNORDERED_MAP_HPP
+#define KOKKOS_UNORDERED_MAP_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_UNORDEREDMAP
+#endif
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_Functional.hpp>
+#include <impl/Kokkos_ConcurrentBitset.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+
+namespace Kokkos {
+
+enum : unsigned { UnorderedMapInvalidIndex = ~0u };
+
+/// \brief The outcome of UnorderedMap::insert.
+///
+/// Exactly one of success(), existing() and failed() is true. For the first
+/// two, index() is the position of the key in the map.
+class UnorderedMapInsertResult {
+ public:
+  enum class Status : std::uint32_t { success, existing, failed };
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  UnorderedMapInsertResult() = default;
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  UnorderedMapInsertResult(Status status, std::uint32_t index)
+      : m_index(index), m_status(status) {}
+
+  /// The key was not in the map and has been inserted.
+  KOKKOS_FORCEINLINE_FUNCTION
+  bool success() const { return m_status == Status::success; }
+
+  /// The key was already in the map, whose value is left unchanged.
+  KOKKOS_FORCEINLINE_FUNCTION
+  bool existing() const { return m_status == Status::existing; }
+
+  /// The map was full.
+  KOKKOS_FORCEINLINE_FUNCTION
+  bool failed() const { return m_status == Status::failed; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  std::uint32_t index() const { return m_index; }
+
+ private:
+  std::uint32_t m_index = UnorderedMapInvalidIndex;
+  Status m_status       = Status::failed;
+};
+
+namespace Impl {
+
+/// Smallest tabulated prime no smaller than \c size, used as the number of
+/// hash buckets for a map of capacity \c size.
+std::uint32_t find_hash_size(std::uint32_t size);
+
+}  // namespace Impl
+
+/// \class UnorderedMap
+/// \brief Lock-free, fixed-capacity hash map for host execution spaces.
+///
+/// Every bucket holds a singly linked list of entry indices. The entries are
+/// claimed from Kokkos::Impl::concurrent_bitset, which also keeps the count of
+/// claimed entries, and are appended to the tail of their list with a
+/// compare-and-swap, so that concurrent readers never see a half-written
+/// entry. An entry is claimed only once the whole list has been searched for
+/// the key, hence an insert of a key that is already present never fails.
+///
+/// Erasing marks the entry; its storage is reclaimed by the next rehash or
+/// clear. Like the other containers, copies of an UnorderedMap share their
+/// storage, so a map captured by value in a kernel updates the original.
+///
+/// insert, find, exists, erase and the *_at accessors may be called
+/// concurrently from kernels. size, rehash and clear are host functions and
+/// must not run concurrently with kernels that use the map.
+template <class Key, class Value,
+          class Device  = Kokkos::DefaultHostExecutionSpace,
+          class Hasher  = pod_hash<std::remove_const_t<Key>>,
+          class EqualTo = pod_equal_to<std::remove_const_t<Key>>>
+class UnorderedMap {
+ public:
+  using key_type        = std::remove_const_t<Key>;
+  using value_type      = std::remove_const_t<Value>;
+  using size_type       = std::uint32_t;
+  using device_type     = typename Device::device_type;
+  using execution_space = typename device_type::execution_space;
+  using memory_space    = typename device_type::memory_space;
+  using hasher_type     = Hasher;
+  using equal_to_type   = EqualTo;
+  using insert_result   = UnorderedMapInsertResult;
+
+  static_assert(std::is_trivially_copyable_v<value_type>,
+                "Kokkos::UnorderedMap requires a trivially copyable value");
+  static_assert(
+      Kokkos::SpaceAccessibility<Kokkos::HostSpace, memory_space>::accessible,
+      "Kokkos::UnorderedMap: only host-accessible memory spaces are "
+      "supported");
+
+  static constexpr size_type invalid_index = UnorderedMapInvalidIndex;
+
+ private:
+  using bitset = Kokkos::Impl::concurrent_bitset;
+
+  // A single concurrent_bitset holds at most bitset::max_bit_count entries.
+  // Larger maps are split into segments of that size and an insert starts in
+  // the segment picked by the hash of the key.
+  static constexpr size_type segment_size = bitset::max_bit_count;
+
+  template <class T>
+  using view_type = Kokkos::View<T, device_type>;
+
+ public:
+  /// \brief Allocates a map that holds at least \c capacity_hint entries.
+  explicit UnorderedMap(size_type capacity_hint = 0, hasher_type hasher = {},
+                        equal_to_type equal_to = {})
+      : m_hasher(hasher), m_equal_to(equal_to) {
+    allocate(capacity_hint);
+  }
+
+  //----------------------------------------------------------------------------
+  // Functions that may be called concurrently from kernels.
+
+  /// \brief Inserts the key with the value unless the key is present.
+  KOKKOS_INLINE_FUNCTION
+  insert_result insert(key_type const& key,
+                       value_type const& value = value_type()) const {
+    using status = insert_result::Status;
+    if (m_capacity == 0) {
+      Kokkos::atomic_increment(&m_scalars(failed_insert_scalar));
+      return insert_result(status::failed, invalid_index);
+    }
+
+    size_type const hash = m_hasher(key);
+    size_type* link      = &m_hash_lists(hash % m_hash_lists.extent(0));
+    size_type claimed    = invalid_index;
+
+    while (true) {
+      size_type const current =
+          Kokkos::Impl::atomic_load(link, desul::MemoryOrderAcquire());
+      if (current != invalid_index) {
+        if (m_equal_to(m_keys(current), key) && !erased_at(current)) {
+          if (claimed != invalid_index) release(claimed);
+          return insert_result(status::existing, current);
+        }
+        link = &m_next_index(current);
+        continue;
+      }
+
+      // End of the list: claim an entry, fill it and try to link it here.
+      if (claimed == invalid_index) {
+        claimed = claim(hash);
+        if (claimed == invalid_index) {
+          Kokkos::atomic_increment(&m_scalars(failed_insert_scalar));
+          return insert_result(status::failed, invalid_index);
+        }
+        m_keys(claimed)       = key;
+        m_values(claimed)     = value;
+        m_next_index(claimed) = invalid_index;
+      }
+      size_type expected = invalid_index;
+      if (Kokkos::Impl::atomic_compare_exchange_strong(
+              link, expected, claimed, desul::MemoryOrderAcqRel(),
+              desul::MemoryOrderAcquire())) {
+        return insert_result(status::success, claimed);
+      }
+      // Another entry was appended first. It may hold the same key, so keep
+      // searching from it.
+    }
+  }
+
+  /// \brief Index of the key, or invalid_index if it is not in the map.
+  KOKKOS_INLINE_FUNCTION
+  size_type find(key_type const& key) const {
+    if (m_capacity == 0) return invalid_index;
+    size_type current = Kokkos::Impl::atomic_load(
+        &m_hash_lists(m_hasher(key) % m_hash_lists.extent(0)),
+        desul::MemoryOrderAcquire());
+    while (current != invalid_index) {
+      if (m_equal_to(m_keys(current), key) && !erased_at(current)) {
+        return current;
+      }
+      current = Kokkos::Impl::atomic_load(&m_next_index(current),
+                                          desul::MemoryOrderAcquire());
+    }
+    return invalid_index;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  bool exists(key_type const& key) const {
+    return find(key) != invalid_index;
+  }
+
+  /// \brief Removes the key. Returns false if it was not in the map or if a
+  ///   concurrent erase removed it first.
+  KOKKOS_INLINE_FUNCTION
+  bool erase(key_type const& key) const {
+    size_type const index = find(key);
+    if (index == invalid_index) return false;
+    std::uint32_t const mask = 1u << (index & 31);
+    if (Kokkos::atomic_fetch_or(&m_erased(index >> 5), mask) & mask) {
+      return false;
+    }
+    Kokkos::atomic_increment(&m_scalars(erased_scalar));
+    return true;
+  }
+
+  /// \brief Whether the entry at \c index holds a key. Only meaningful while
+  ///   no insert is in flight.
+  KOKKOS_INLINE_FUNCTION
+  bool valid_at(size_type index) const {
+    if (m_capacity <= index) return false;
+    size_type const segment = index / segment_size;
+    size_type const bit     = index % segment_size;
+    std::uint32_t const word =
+        m_bitsets(segment * m_segment_stride + 1 + (bit >> 5));
+    return (word & (1u << (bit & 31))) && !erased_at(index);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  key_type const& key_at(size_type index) const { return m_keys(index); }
+
+  /// \brief The value of the entry at \c index. Concurrent updates of the
+  ///   same value, e.g. to aggregate per key, have to be atomic.
+  KOKKOS_FORCEINLINE_FUNCTION
+  value_type& value_at(size_type index) const { return m_values(index); }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_type capacity() const { return m_capacity; }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_type hash_capacity() const { return m_hash_lists.extent(0); }
+
+  //----------------------------------------------------------------------------
+  // Host functions.
+
+  bool is_allocated() const { return m_keys.is_allocated(); }
+
+  /// \brief The number of keys in the map.
+  size_type size() const {
+    Kokkos::fence("Kokkos::UnorderedMap::size: fence before reading counts");
+    size_type claimed = 0;
+    for (size_type s = 0; s < m_segments; ++s) {
+      claimed += m_bitsets(s * m_segment_stride) & bitset::state_used_mask;
+    }
+    return claimed - m_scalars(erased_scalar);
+  }
+
+  /// \brief Whether an insert failed since the map was allocated, rehashed,
+  ///   cleared or the flag was reset.
+  bool failed_insert() const { return failed_insert_count() != 0; }
+
+  /// \brief The number of inserts that failed because the map was full.
+  size_type failed_insert_count() const {
+    Kokkos::fence(
+        "Kokkos::UnorderedMap::failed_insert_count: fence before reading the "
+        "count");
+    return m_scalars(failed_insert_scalar);
+  }
+
+  void reset_failed_insert_flag() {
+    Kokkos::fence(
+        "Kokkos::UnorderedMap::reset_failed_insert_flag: fence before "
+        "resetting the count");
+    m_scalars(failed_insert_scalar) = 0;
+  }
+
+  /// \brief Removes every key, keeping the capacity, and resets the failed
+  ///   insert count.
+  void clear() {
+    Kokkos::deep_copy(m_hash_lists, invalid_index);
+    Kokkos::deep_copy(m_bitsets, 0u);
+    Kokkos::deep_copy(m_erased, 0u);
+    Kokkos::deep_copy(m_scalars, 0u);
+  }
+
+  /// \brief Moves the keys into a map of capacity at least
+  ///   max(requested_capacity, size()) in one parallel pass. This also
+  ///   reclaims the entries of erased keys and resets the failed insert count.
+  ///   Returns false, leaving the map unchanged, if the new map could not hold
+  ///   every key.
+  bool rehash(size_type requested_capacity = 0) {
+    size_type const live = m_capacity ? size() : 0;
+    UnorderedMap rehashed(std::max(requested_capacity, live), m_hasher,
+                          m_equal_to);
+    if (live != 0) {
+      UnorderedMap const source = *this;
+      Kokkos::parallel_for(
+          "Kokkos::UnorderedMap::rehash",
+          Kokkos::RangePolicy<execution_space>(0, m_capacity),
+          KOKKOS_LAMBDA(size_type i) {
+            if (source.valid_at(i)) {
+              rehashed.insert(source.key_at(i), source.value_at(i));
+            }
+          });
+      if (rehashed.failed_insert()) return false;
+    }
+    *this = rehashed;
+    return true;
+  }
+
+ private:
+  enum : int { failed_insert_scalar = 0, erased_scalar = 1 };
+
+  void allocate(size_type capacity_hint) {
+    // Whole words of the bitsets, which also keeps the capacity below the
+    // invalid index.
+    size_type const capacity =
+        std::min<std::uint64_t>((std::uint64_t(capacity_hint) + 31) & ~31ull,
+                                invalid_index & ~31u);
+    m_capacity = capacity;
+    m_segments = capacity ? (capacity - 1) / segment_size + 1 : 0;
+    m_segment_stride =
+        bitset::buffer_bound(std::min<size_type>(capacity, segment_size));
+    m_hash_lists = view_type<size_type*>(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                           "Kokkos::UnorderedMap::hash_lists"),
+        capacity ? Impl::find_hash_size(capacity) : 0);
+    Kokkos::deep_copy(m_hash_lists, invalid_index);
+    m_next_index = view_type<size_type*>(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                           "Kokkos::UnorderedMap::next_index"),
+        capacity);
+    m_keys = view_type<key_type*>(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                           "Kokkos::UnorderedMap::keys"),
+        capacity);
+    m_values = view_type<value_type*>(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing,
+                           "Kokkos::UnorderedMap::values"),
+        capacity);
+    m_bitsets = view_type<std::uint32_t*>("Kokkos::UnorderedMap::bitsets",
+                                          m_segments * m_segment_stride);
+    m_erased = view_type<std::uint32_t*>("Kokkos::UnorderedMap::erased",
+                                         capacity / 32);
+    m_scalars = view_type<size_type[2]>("Kokkos::UnorderedMap::scalars");
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  bool erased_at(size_type index) const {
+    return m_erased(index >> 5) & (1u << (index & 31));
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION
+  size_type segment_bound(size_type segment) const {
+    size_type const begin = segment * segment_size;
+    return m_capacity - begin < segment_size ? m_capacity - begin
+                                             : segment_size;
+  }
+
+  // Claims a free entry, starting in the segment and at the position picked
+  // by the hash so that concurrent inserts spread over the bitsets.
+  KOKKOS_INLINE_FUNCTION
+  size_type claim(size_type hash) const {
+    size_type segment = hash % m_segments;
+    for (size_type tries = 0; tries < m_segments; ++tries) {
+      size_type const bound = segment_bound(segment);
+      auto const result     = bitset::acquire_bounded(
+          &m_bitsets(segment * m_segment_stride), bound, hash % bound);
+      if (0 <= result.first) return segment * segment_size + result.first;
+      segment = segment + 1 < m_segments ? segment + 1 : 0;
+    }
+    return invalid_index;
+  }
+
+  // Returns an entry that was claimed but never linked into a list.
+  KOKKOS_INLINE_FUNCTION
+  void release(size_type index) const {
+    size_type const segment = index / segment_size;
+    bitset::release(&m_bitsets(segment * m_segment_stride),
+                    index % segment_size);
+  }
+
+  hasher_type m_hasher;
+  equal_to_type m_equal_to;
+  size_type m_capacity       = 0;
+  size_type m_segments       = 0;
+  size_type m_segment_stride = 0;
+  view_type<size_type*> m_hash_lists;
+  view_type<size_type*> m_next_index;
+  view_type<key_type*> m_keys;
+  view_type<value_type*> m_values;
+  view_type<std::uint32_t*> m_bitsets;
+  view_type<std::uint32_t*> m_erased;
+  view_type<size_type[2]> m_scalars;
+};
+
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_UNORDEREDMAP
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_UNORDEREDMAP
+#endif
+#endif
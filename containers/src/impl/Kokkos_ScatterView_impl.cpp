@@ -0,0 +1,66 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <Kokkos_ScatterView.hpp>
+
+#include <atomic>
+#include <limits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr std::size_t use_default_limit =
+    std::numeric_limits<std::size_t>::max();
+
+std::atomic<std::size_t> scatter_view_duplication_limit_bytes{
+    use_default_limit};
+
+// Half of the physical memory that is currently free, so that duplicating one
+// ScatterView never pushes the node into swap. Unlimited where the operating
+// system does not report it.
+std::size_t default_duplication_limit() {
+#if defined(_SC_AVPHYS_PAGES) && defined(_SC_PAGESIZE)
+  long const pages     = sysconf(_SC_AVPHYS_PAGES);
+  long const page_size = sysconf(_SC_PAGESIZE);
+  if (pages > 0 && page_size > 0) {
+    return std::size_t(pages) / 2 * std::size_t(page_size);
+  }
+#endif
+  return std::numeric_limits<std::size_t>::max();
+}
+
+}  // namespace
+
+void Kokkos::Experimental::set_scatter_view_duplication_limit(
+    std::size_t bytes) {
+  scatter_view_duplication_limit_bytes = bytes;
+}
+
+void Kokkos::Experimental::reset_scatter_view_duplication_limit() {
+  scatter_view_duplication_limit_bytes = use_default_limit;
+}
+
+std::size_t Kokkos::Experimental::scatter_view_duplication_limit() {
+  std::size_t const bytes = scatter_view_duplication_limit_bytes;
+  return bytes != use_default_limit ? bytes : default_duplication_limit();
+}
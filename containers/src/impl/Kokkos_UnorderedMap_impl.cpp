@@ -0,0 +1,61 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <Kokkos_UnorderedMap.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace {
+
+// The smallest prime no smaller than 2^(k/4) for k = 20, ..., 127, followed
+// by the largest 32-bit prime. Consecutive entries differ by about 19%, which
+// bounds how far the number of buckets overshoots the capacity.
+constexpr std::uint32_t hash_sizes[] = {
+    37u,         41u,         47u,         59u,         67u,
+    79u,         97u,         109u,        131u,        157u,
+    191u,        223u,        257u,        307u,        367u,
+    431u,        521u,        613u,        727u,        863u,
+    1031u,       1223u,       1451u,       1723u,       2053u,
+    2437u,       2897u,       3449u,       4099u,       4871u,
+    5801u,       6899u,       8209u,       9743u,       11587u,
+    13781u,      16411u,      19489u,      23173u,      27581u,
+    32771u,      38971u,      46349u,      55109u,      65537u,
+    77951u,      92683u,      110221u,     131101u,     155887u,
+    185369u,     220447u,     262147u,     311747u,     370759u,
+    440893u,     524309u,     623521u,     741457u,     881779u,
+    1048583u,    1246997u,    1482919u,    1763491u,    2097169u,
+    2493949u,    2965847u,    3526987u,    4194319u,    4987901u,
+    5931649u,    7053971u,    8388617u,    9975803u,    11863289u,
+    14107921u,   16777259u,   19951597u,   23726569u,   28215809u,
+    33554467u,   39903197u,   47453149u,   56431657u,   67108879u,
+    79806341u,   94906297u,   112863217u,  134217757u,  159612679u,
+    189812533u,  225726419u,  268435459u,  319225391u,  379625083u,
+    451452839u,  536870923u,  638450719u,  759250133u,  902905657u,
+    1073741827u, 1276901429u, 1518500279u, 1805811341u, 2147483659u,
+    2553802871u, 3037000507u, 3611622607u, 4294967291u};
+
+}  // namespace
+
+std::uint32_t Kokkos::Impl::find_hash_size(std::uint32_t size) {
+  auto const found =
+      std::lower_bound(std::begin(hash_sizes), std::end(hash_sizes), size);
+  return found != std::end(hash_sizes) ? *found : std::end(hash_sizes)[-1];
+}
@@ -0,0 +1,146 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_DualView.hpp>
+
+namespace Test {
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+
+namespace {
+int sync_events     = 0;
+int modify_events   = 0;
+int deep_copy_calls = 0;
+
+void count_sync(char const*, void const*, bool) { ++sync_events; }
+void count_modify(char const*, void const*, bool) { ++modify_events; }
+void count_deep_copy(Kokkos::Tools::SpaceHandle, char const*, void const*,
+                     Kokkos::Tools::SpaceHandle, char const*, void const*,
+                     uint64_t) {
+  ++deep_copy_calls;
+}
+
+struct CountingTools {
+  CountingTools() {
+    sync_events = modify_events = deep_copy_calls = 0;
+    Kokkos::Tools::Experimental::set_dual_view_sync_callback(count_sync);
+    Kokkos::Tools::Experimental::set_dual_view_modify_callback(count_modify);
+    Kokkos::Tools::Experimental::set_begin_deep_copy_callback(
+        count_deep_copy);
+  }
+  ~CountingTools() {
+    Kokkos::Tools::Experimental::set_dual_view_sync_callback(nullptr);
+    Kokkos::Tools::Experimental::set_dual_view_modify_callback(nullptr);
+    Kokkos::Tools::Experimental::set_begin_deep_copy_callback(nullptr);
+  }
+};
+}  // namespace
+
+// A host-accessible DualView tracks modifications but never copies.
+TEST(containers, dual_view_single_space) {
+  CountingTools tools;
+  Kokkos::DualView<int*, ExecSpace> dv("dv", 10);
+  static_assert(decltype(dv)::impl_dualview_is_single_device);
+  EXPECT_EQ(dv.h_view.data(), dv.d_view.data());
+  EXPECT_EQ(dv.label(), "dv");
+
+  dv.modify_device();
+  EXPECT_TRUE(dv.need_sync_host());
+  EXPECT_FALSE(dv.need_sync_device());
+  dv.sync_host();
+  EXPECT_FALSE(dv.need_sync_host());
+  dv.modify<ExecSpace>();
+  dv.sync_device(ExecSpace());
+  EXPECT_EQ(sync_events, 2);
+  EXPECT_EQ(modify_events, 2);
+  EXPECT_EQ(deep_copy_calls, 0);
+}
+
+// A DualView whose device View is not the host mirror, as for a device
+// memory space.
+using split_dual_view = Kokkos::DualView<double**, Kokkos::LayoutLeft>;
+
+split_dual_view make_split(int n0, int n1) {
+  Kokkos::View<double**, Kokkos::LayoutLeft> d_view("split", n0, n1);
+  auto h_view = Kokkos::create_mirror(d_view);
+  return split_dual_view(d_view, h_view);
+}
+
+TEST(containers, dual_view_sync_only_when_stale) {
+  CountingTools tools;
+  auto dv = make_split(4, 3);
+  ASSERT_NE(dv.h_view.data(), dv.d_view.data());
+
+  // Nothing was modified yet.
+  dv.sync_device();
+  dv.sync_host();
+  EXPECT_EQ(deep_copy_calls, 0);
+
+  dv.modify_host();
+  dv.h_view(3, 2) = 1.5;
+  EXPECT_TRUE(dv.need_sync_device());
+  dv.sync_device();
+  EXPECT_EQ(dv.d_view(3, 2), 1.5);
+  EXPECT_EQ(deep_copy_calls, 1);
+  dv.sync_device();
+  dv.sync_host();
+  EXPECT_EQ(deep_copy_calls, 1);
+
+  // Copies share the counters.
+  auto copy = dv;
+  copy.modify_device();
+  Kokkos::deep_copy(copy.d_view, 2.0);
+  EXPECT_TRUE(dv.need_sync_host());
+  dv.sync_host(ExecSpace());
+  ExecSpace().fence();
+  EXPECT_EQ(dv.h_view(0, 0), 2.0);
+  EXPECT_FALSE(copy.need_sync_host());
+
+  // Modifying both sides without a sync keeps the last one.
+  dv.modify_device();
+  dv.modify_host();
+  EXPECT_TRUE(dv.need_sync_device());
+  EXPECT_FALSE(dv.need_sync_host());
+  dv.clear_sync_state();
+  EXPECT_FALSE(dv.need_sync_device());
+
+  EXPECT_EQ(modify_events, 4);
+  EXPECT_EQ(sync_events, 2);
+
+  Kokkos::DualView<const double**, Kokkos::LayoutLeft> const_dv = dv;
+  EXPECT_EQ(const_dv.h_view(0, 0), 2.0);
+  dv.modify_host();
+  EXPECT_TRUE(const_dv.need_sync_device());
+  EXPECT_THROW(const_dv.sync_device(), std::runtime_error);
+}
+
+TEST(containers, dual_view_from_device_view) {
+  Kokkos::View<int*, ExecSpace> d_view("d_view", 5);
+  Kokkos::DualView<int*, ExecSpace> dv(d_view);
+  EXPECT_EQ(dv.view<ExecSpace>().data(), d_view.data());
+  EXPECT_EQ(dv.view_host().data(), d_view.data());
+  EXPECT_FALSE(dv.need_sync_host());
+
+  EXPECT_THROW(split_dual_view(Kokkos::View<double**, Kokkos::LayoutLeft>(
+                                   "d", 2, 3),
+                               split_dual_view::t_host("h", 3, 2)),
+               std::runtime_error);
+}
+
+}  // namespace Test
@@ -0,0 +1,195 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_DynRankView.hpp>
+
+namespace Test {
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+
+TEST(containers, dyn_rank_view_ranks) {
+  Kokkos::DynRankView<int, ExecSpace> v0("v0");
+  EXPECT_EQ(v0.rank(), 0u);
+  EXPECT_EQ(v0.size(), 1u);
+  v0() = 5;
+  EXPECT_EQ(v0(), 5);
+
+  Kokkos::DynRankView<int, ExecSpace> v3("v3", 2, 3, 4);
+  EXPECT_EQ(v3.rank(), 3u);
+  EXPECT_EQ(v3.label(), "v3");
+  EXPECT_EQ(v3.size(), 24u);
+  EXPECT_EQ(v3.extent(1), 3u);
+  EXPECT_EQ(v3.extent(3), 1u);
+  EXPECT_EQ(v3.layout().dimension[2], 4u);
+  EXPECT_EQ(v3.layout().dimension[3], KOKKOS_IMPL_CTOR_DEFAULT_ARG);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j)
+      for (int k = 0; k < 4; ++k) v3(i, j, k) = 100 * i + 10 * j + k;
+  EXPECT_EQ(v3(1, 2, 3), 123);
+  EXPECT_EQ(v3.data()[v3.stride(0) + 2 * v3.stride(1) + 3 * v3.stride(2)],
+            123);
+
+  Kokkos::DynRankView<double, ExecSpace> v8("v8", 2, 1, 2, 1, 2, 1, 2, 3);
+  EXPECT_EQ(v8.rank(), 8u);
+  EXPECT_EQ(v8.size(), 48u);
+  v8(1, 0, 1, 0, 1, 0, 1, 2) = 1.5;
+  EXPECT_EQ(v8(1, 0, 1, 0, 1, 0, 1, 2), 1.5);
+
+  Kokkos::DynRankView<const int, ExecSpace> c = v3;
+  EXPECT_EQ(c(1, 0, 2), 102);
+  EXPECT_EQ(c.use_count(), v3.use_count());
+}
+
+TEST(containers, dyn_rank_view_conversions) {
+  // A padded LayoutLeft View keeps its padding in the DynRankView.
+  Kokkos::View<int**, Kokkos::LayoutLeft, ExecSpace> padded(
+      Kokkos::view_alloc("padded", Kokkos::AllowPadding), 5, 7);
+  for (int i = 0; i < 5; ++i)
+    for (int j = 0; j < 7; ++j) padded(i, j) = 10 * i + j;
+  Kokkos::DynRankView<int, Kokkos::LayoutLeft, ExecSpace> d = padded;
+  EXPECT_EQ(d.rank(), 2u);
+  EXPECT_EQ(d.stride(1), padded.stride(1));
+  EXPECT_EQ(d.data(), padded.data());
+  for (int i = 0; i < 5; ++i)
+    for (int j = 0; j < 7; ++j) ASSERT_EQ(d(i, j), 10 * i + j);
+
+  Kokkos::View<int**, Kokkos::LayoutLeft, ExecSpace> back = d;
+  EXPECT_EQ(back.stride(1), padded.stride(1));
+  EXPECT_EQ(back(4, 6), 46);
+
+  // LayoutRight Views of every rank convert to LayoutStride DynRankViews.
+  Kokkos::View<int***, ExecSpace> right("right", 2, 3, 4);
+  right(1, 2, 3) = 7;
+  Kokkos::DynRankView<int, Kokkos::LayoutStride, ExecSpace> strided = right;
+  EXPECT_EQ(strided.rank(), 3u);
+  EXPECT_EQ(strided(1, 2, 3), 7);
+  EXPECT_EQ(strided.stride(0), right.stride(0));
+
+  Kokkos::View<int*, ExecSpace> one("one", 4);
+  Kokkos::DynRankView<int, ExecSpace> d1 = one;
+  d1(3) = 9;
+  EXPECT_EQ(one(3), 9);
+  EXPECT_EQ(d1[3], 9);
+
+  Kokkos::View<int, ExecSpace> scalar("scalar");
+  Kokkos::DynRankView<int, ExecSpace> d0 = scalar;
+  d0() = 3;
+  EXPECT_EQ(scalar(), 3);
+}
+
+struct CountRank {
+  template <class ViewType>
+  unsigned operator()(ViewType const& v) const {
+    static_assert(Kokkos::is_view_v<ViewType>);
+    int sum = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<ExecSpace>(0, v.span()),
+        KOKKOS_LAMBDA(int i, int& local) { local += v.data()[i]; }, sum);
+    return ViewType::rank() + 10 * sum;
+  }
+};
+
+TEST(containers, dyn_rank_view_visit) {
+  for (unsigned rank = 0; rank <= 8; ++rank) {
+    Kokkos::LayoutRight layout;
+    for (unsigned r = 0; r < rank; ++r) layout.dimension[r] = 2;
+    Kokkos::DynRankView<int, ExecSpace> v("v", layout);
+    ASSERT_EQ(v.rank(), rank);
+    Kokkos::deep_copy(v, 1);
+    EXPECT_EQ(Kokkos::Experimental::visit_static_rank(CountRank(), v),
+              rank + 10 * (1u << rank));
+  }
+
+  Kokkos::DynRankView<int, ExecSpace> v2("v2", 3, 3);
+  unsigned seen = 9;
+  Kokkos::Impl::apply_to_view_of_static_rank(
+      [&](auto const& view) { seen = view.rank(); }, v2);
+  EXPECT_EQ(seen, 2u);
+}
+
+TEST(containers, dyn_rank_view_deep_copy) {
+  Kokkos::DynRankView<double, ExecSpace> a("a", 4, 5);
+  Kokkos::DynRankView<double, Kokkos::LayoutLeft, ExecSpace> b("b", 4, 5);
+  Kokkos::View<double**, ExecSpace> c("c", 4, 5);
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 5; ++j) a(i, j) = i + 0.5 * j;
+
+  Kokkos::deep_copy(b, a);
+  Kokkos::deep_copy(ExecSpace(), c, b);
+  ExecSpace().fence();
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 5; ++j) ASSERT_EQ(c(i, j), i + 0.5 * j);
+
+  Kokkos::deep_copy(a, 0.0);
+  Kokkos::deep_copy(a, c);
+  EXPECT_EQ(a(3, 4), 5.0);
+
+  Kokkos::DynRankView<double, ExecSpace> s("s");
+  Kokkos::deep_copy(s, 2.5);
+  double value = 0;
+  Kokkos::deep_copy(value, s);
+  EXPECT_EQ(value, 2.5);
+
+  Kokkos::DynRankView<double, ExecSpace> wrong("wrong", 20);
+  EXPECT_THROW(Kokkos::deep_copy(wrong, a), std::runtime_error);
+  EXPECT_THROW(Kokkos::deep_copy(wrong, c), std::runtime_error);
+}
+
+TEST(containers, dyn_rank_view_subview) {
+  Kokkos::DynRankView<int, ExecSpace> v("v", 4, 5, 6);
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 5; ++j)
+      for (int k = 0; k < 6; ++k) v(i, j, k) = 100 * i + 10 * j + k;
+
+  auto plane = Kokkos::subview(v, 2, Kokkos::ALL, Kokkos::pair(1, 4));
+  EXPECT_EQ(plane.rank(), 2u);
+  EXPECT_EQ(plane.extent(0), 5u);
+  EXPECT_EQ(plane.extent(1), 3u);
+  EXPECT_EQ(plane(3, 2), 233);
+
+  auto point = Kokkos::subdynrankview(v, 1, 2, 3);
+  EXPECT_EQ(point.rank(), 0u);
+  EXPECT_EQ(point(), 123);
+
+  EXPECT_THROW(Kokkos::subview(v, 1, 2), std::runtime_error);
+}
+
+TEST(containers, dyn_rank_view_mirrors) {
+  Kokkos::DynRankView<int, ExecSpace> v("v", 3, 2);
+  v(2, 1) = 4;
+
+  auto view = Kokkos::create_mirror_view(v);
+  EXPECT_EQ(view.data(), v.data());
+  EXPECT_EQ(view.rank(), 2u);
+
+  auto mirror = Kokkos::create_mirror(v);
+  EXPECT_NE(mirror.data(), v.data());
+  EXPECT_EQ(mirror.rank(), 2u);
+  EXPECT_EQ(mirror.extent(0), 3u);
+  Kokkos::deep_copy(mirror, v);
+  EXPECT_EQ(mirror(2, 1), 4);
+
+  auto copy = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+  EXPECT_EQ(copy.data(), v.data());
+  auto uninitialized =
+      Kokkos::create_mirror(Kokkos::WithoutInitializing, ExecSpace(), v);
+  EXPECT_EQ(uninitialized.rank(), 2u);
+}
+
+}  // namespace Test
@@ -0,0 +1,180 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_ScatterView.hpp>
+
+#include <vector>
+
+namespace Test {
+
+using Kokkos::Experimental::ScatterAtomic;
+using Kokkos::Experimental::ScatterDuplicated;
+using Kokkos::Experimental::ScatterMax;
+using Kokkos::Experimental::ScatterMin;
+using Kokkos::Experimental::ScatterNonAtomic;
+using Kokkos::Experimental::ScatterNonDuplicated;
+using Kokkos::Experimental::ScatterProd;
+using Kokkos::Experimental::ScatterSum;
+using Kokkos::Experimental::ScatterView;
+
+constexpr int scatter_items = 10000;
+constexpr int scatter_bins  = 37;
+
+// Item i lands in bin (7 i) % bins with weight 1 + i % 3, so every bin sees
+// many contributions from different threads.
+template <class ExecSpace, class Duplication, class Contribution>
+void check_scatter_sum() {
+  using view_type = Kokkos::View<long*, ExecSpace>;
+  using scatter_type =
+      ScatterView<long*, typename view_type::array_layout, ExecSpace,
+                  ScatterSum, Duplication, Contribution>;
+  view_type bins("bins", scatter_bins);
+  Kokkos::deep_copy(bins, 5);
+  scatter_type scatter(bins);
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<ExecSpace>(0, scatter_items), KOKKOS_LAMBDA(int i) {
+          auto access = scatter.access();
+          access((7 * i) % scatter_bins) += 1 + i % 3;
+          access(0) -= 1;
+        });
+    Kokkos::Experimental::contribute(bins, scatter);
+    scatter.reset();
+  }
+  auto const host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bins);
+  std::vector<long> expected(scatter_bins, 5);
+  for (int repeat = 0; repeat < 2; ++repeat) {
+    for (int i = 0; i < scatter_items; ++i) {
+      expected[(7 * i) % scatter_bins] += 1 + i % 3;
+      expected[0] -= 1;
+    }
+  }
+  for (int b = 0; b < scatter_bins; ++b) {
+    EXPECT_EQ(host(b), expected[b]) << b;
+  }
+}
+
+template <class ExecSpace, class Op>
+void check_scatter_op(long initial, long expected_first,
+                      long expected_other) {
+  using view_type = Kokkos::View<long*, ExecSpace>;
+  view_type bins("bins", 4);
+  Kokkos::deep_copy(bins, initial);
+  auto scatter = Kokkos::Experimental::create_scatter_view<Op>(bins);
+  // Bin 0 receives the values 1..18 and the other bins 2, six times each.
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, 18), KOKKOS_LAMBDA(int i) {
+        auto access = scatter.access();
+        access(0).update(i + 1);
+        access(1 + i % 3).update(2);
+      });
+  Kokkos::Experimental::contribute(bins, scatter);
+  auto const host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), bins);
+  EXPECT_EQ(host(0), expected_first);
+  for (int b = 1; b < 4; ++b) EXPECT_EQ(host(b), expected_other) << b;
+}
+
+template <class ExecSpace>
+void check_scatter_rank2() {
+  using view_type = Kokkos::View<double**, Kokkos::LayoutLeft, ExecSpace>;
+  view_type values("values", 5, 3);
+  auto scatter = Kokkos::Experimental::create_scatter_view(values);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, 1500), KOKKOS_LAMBDA(int i) {
+        auto access = scatter.access();
+        access(i % 5, i % 3) += 0.5;
+      });
+  view_type other("other", 5, 3);
+  Kokkos::deep_copy(other, 1.0);
+  Kokkos::Experimental::contribute(other, scatter);
+  auto const host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), other);
+  for (int i = 0; i < 5; ++i) {
+    for (int j = 0; j < 3; ++j) EXPECT_EQ(host(i, j), 1.0 + 50.0);
+  }
+}
+
+// A strided subview cannot be duplicated; contributions go straight to it.
+template <class ExecSpace>
+void check_scatter_strided() {
+  Kokkos::View<int**, Kokkos::LayoutRight, ExecSpace> values("values", 8, 2);
+  auto column = Kokkos::subview(values, Kokkos::ALL, 1);
+  ScatterView<int*, Kokkos::LayoutStride, ExecSpace> scatter(column);
+  EXPECT_FALSE(scatter.duplicates());
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, 800), KOKKOS_LAMBDA(int i) {
+        auto access = scatter.access();
+        access(i % 8) += 1;
+      });
+  Kokkos::Experimental::contribute(column, scatter);
+  auto const host =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), values);
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(host(i, 0), 0);
+    EXPECT_EQ(host(i, 1), 100);
+  }
+}
+
+template <class ExecSpace>
+void check_scatter_view() {
+  check_scatter_sum<ExecSpace, ScatterNonDuplicated, ScatterAtomic>();
+  check_scatter_sum<
+      ExecSpace,
+      typename Kokkos::Experimental::Impl::DefaultDuplication<ExecSpace>::type,
+      typename Kokkos::Experimental::Impl::DefaultContribution<
+          ExecSpace, typename Kokkos::Experimental::Impl::DefaultDuplication<
+                         ExecSpace>::type>::type>();
+  check_scatter_op<ExecSpace, ScatterMax>(3, 18, 3);
+  check_scatter_op<ExecSpace, ScatterMin>(3, 1, 2);
+  check_scatter_op<ExecSpace, ScatterProd>(1, 6402373705728000, 64);
+  check_scatter_rank2<ExecSpace>();
+  check_scatter_strided<ExecSpace>();
+}
+
+TEST(containers, scatter_view) {
+  check_scatter_view<Kokkos::DefaultExecutionSpace>();
+  check_scatter_view<Kokkos::DefaultHostExecutionSpace>();
+}
+
+TEST(containers, scatter_view_duplicated) {
+  using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+  check_scatter_sum<ExecSpace, ScatterDuplicated, ScatterNonAtomic>();
+  check_scatter_sum<ExecSpace, ScatterDuplicated, ScatterAtomic>();
+
+  Kokkos::View<long*, ExecSpace> bins("bins", 16);
+  ScatterView<long*, Kokkos::LayoutRight, ExecSpace, ScatterSum,
+              ScatterDuplicated>
+      scatter(bins);
+  EXPECT_EQ(scatter.duplicates(), ExecSpace().concurrency() > 1);
+
+  // Without room for the copies the contributions go to the original View.
+  Kokkos::Experimental::set_scatter_view_duplication_limit(1);
+  EXPECT_EQ(Kokkos::Experimental::scatter_view_duplication_limit(), 1u);
+  ScatterView<long*, Kokkos::LayoutRight, ExecSpace, ScatterSum,
+              ScatterDuplicated>
+      fallback(bins);
+  EXPECT_FALSE(fallback.duplicates());
+  check_scatter_sum<ExecSpace, ScatterDuplicated, ScatterNonAtomic>();
+  Kokkos::Experimental::reset_scatter_view_duplication_limit();
+  EXPECT_GT(Kokkos::Experimental::scatter_view_duplication_limit(), 1u);
+}
+
+}  // namespace Test
@@ -0,0 +1,190 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_UnorderedMap.hpp>
+
+#include <cstdint>
+
+namespace Test {
+
+using ExecSpace = Kokkos::DefaultHostExecutionSpace;
+using map_type  = Kokkos::UnorderedMap<std::int64_t, std::int64_t, ExecSpace>;
+
+// Key i % distinct with value i, so every key is inserted many times
+// concurrently and the value of the first successful insert wins.
+int insert_keys(map_type const& map, int count, int distinct) {
+  int failed = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecSpace>(0, count),
+      KOKKOS_LAMBDA(int i, int& local_failed) {
+        auto const result = map.insert(i % distinct, i);
+        if (result.failed()) ++local_failed;
+      },
+      failed);
+  return failed;
+}
+
+TEST(containers, unordered_map_insert_find) {
+  constexpr int distinct = 5000;
+  map_type map(distinct);
+  EXPECT_GE(map.capacity(), unsigned(distinct));
+  EXPECT_GE(map.hash_capacity(), map.capacity());
+  EXPECT_EQ(insert_keys(map, 20 * distinct, distinct), 0);
+  EXPECT_EQ(map.size(), unsigned(distinct));
+  EXPECT_FALSE(map.failed_insert());
+
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecSpace>(0, 2 * distinct),
+      KOKKOS_LAMBDA(int key, int& local_errors) {
+        auto const index = map.find(key);
+        if (key < distinct) {
+          if (index == map_type::invalid_index || !map.valid_at(index) ||
+              map.key_at(index) != key ||
+              map.value_at(index) % distinct != key) {
+            ++local_errors;
+          }
+        } else if (index != map_type::invalid_index || map.exists(key)) {
+          ++local_errors;
+        }
+      },
+      errors);
+  EXPECT_EQ(errors, 0);
+
+  auto const existing = map.insert(7, -1);
+  EXPECT_TRUE(existing.existing());
+  EXPECT_EQ(existing.index(), map.find(7));
+  EXPECT_NE(map.value_at(existing.index()), -1);
+}
+
+TEST(containers, unordered_map_aggregate) {
+  constexpr int distinct = 1000;
+  constexpr int count    = 100000;
+  map_type map(distinct);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecSpace>(0, count), KOKKOS_LAMBDA(int i) {
+        auto const result = map.insert(i % distinct, 0);
+        Kokkos::atomic_add(&map.value_at(result.index()), std::int64_t(1));
+      });
+  Kokkos::fence();
+  EXPECT_EQ(map.size(), unsigned(distinct));
+  for (int key = 0; key < distinct; ++key) {
+    ASSERT_EQ(map.value_at(map.find(key)), count / distinct) << key;
+  }
+}
+
+TEST(containers, unordered_map_failed_insert_and_rehash) {
+  constexpr int distinct = 10000;
+  map_type map(1000);
+  int const failed = insert_keys(map, distinct, distinct);
+  EXPECT_GT(failed, 0);
+  EXPECT_TRUE(map.failed_insert());
+  EXPECT_EQ(map.failed_insert_count(), unsigned(failed));
+  EXPECT_EQ(map.size(), map.capacity());
+
+  // The keys that made it into the map survive the rehash, and retrying the
+  // whole insert then only adds the missing ones.
+  auto const inserted = map.size();
+  ASSERT_TRUE(map.rehash(distinct));
+  EXPECT_FALSE(map.failed_insert());
+  EXPECT_EQ(map.size(), inserted);
+  EXPECT_EQ(insert_keys(map, distinct, distinct), 0);
+  EXPECT_EQ(map.size(), unsigned(distinct));
+  for (int key = 0; key < distinct; ++key) {
+    auto const index = map.find(key);
+    ASSERT_NE(index, map_type::invalid_index) << key;
+    ASSERT_EQ(map.value_at(index), key);
+  }
+
+  map.reset_failed_insert_flag();
+  EXPECT_EQ(map.failed_insert_count(), 0u);
+
+  map_type empty;
+  EXPECT_EQ(empty.capacity(), 0u);
+  EXPECT_TRUE(empty.insert(1, 1).failed());
+  EXPECT_TRUE(empty.failed_insert());
+  EXPECT_FALSE(empty.exists(1));
+  ASSERT_TRUE(empty.rehash(10));
+  EXPECT_TRUE(empty.insert(1, 1).success());
+}
+
+TEST(containers, unordered_map_erase) {
+  constexpr int distinct = 4000;
+  map_type map(distinct);
+  EXPECT_EQ(insert_keys(map, distinct, distinct), 0);
+
+  int erased = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecSpace>(0, 2 * distinct),
+      KOKKOS_LAMBDA(int i, int& local_erased) {
+        // Every even key is erased twice; only one of the two succeeds.
+        if (map.erase(2 * (i % (distinct / 2)))) ++local_erased;
+      },
+      erased);
+  EXPECT_EQ(erased, distinct / 2);
+  EXPECT_EQ(map.size(), unsigned(distinct / 2));
+  for (int key = 0; key < distinct; ++key) {
+    ASSERT_EQ(map.exists(key), key % 2 == 1) << key;
+  }
+  EXPECT_FALSE(map.erase(0));
+
+  // Erased entries keep their storage until the map is rehashed.
+  EXPECT_GT(insert_keys(map, 3 * distinct, 3 * distinct), 0);
+  map.clear();
+  EXPECT_EQ(map.size(), 0u);
+  EXPECT_FALSE(map.failed_insert());
+  EXPECT_EQ(insert_keys(map, distinct, distinct), 0);
+  for (int key = 0; key < distinct; key += 2) map.erase(key);
+  ASSERT_TRUE(map.rehash());
+  EXPECT_EQ(map.size(), unsigned(distinct / 2));
+  EXPECT_LT(map.capacity(), unsigned(distinct));
+  ASSERT_TRUE(map.rehash(distinct));
+  EXPECT_EQ(insert_keys(map, distinct, distinct), 0);
+  EXPECT_EQ(map.size(), unsigned(distinct));
+  EXPECT_EQ(map.value_at(map.find(2)), 2);
+}
+
+// Maps larger than one concurrent_bitset are split into segments.
+TEST(containers, unordered_map_segments) {
+  using segmented_map_type =
+      Kokkos::UnorderedMap<std::uint32_t, char, ExecSpace>;
+  constexpr std::uint32_t bitset_size =
+      Kokkos::Impl::concurrent_bitset::max_bit_count;
+  segmented_map_type map(bitset_size + 1);
+  EXPECT_EQ(map.capacity(), bitset_size + 32);
+
+  constexpr int count = 10000;
+  int high            = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecSpace>(0, count),
+      KOKKOS_LAMBDA(int i, int& local_high) {
+        auto const result = map.insert(i, char(i % 100));
+        if (result.success() && bitset_size <= result.index()) ++local_high;
+      },
+      high);
+  EXPECT_GT(high, 0);
+  EXPECT_EQ(map.size(), unsigned(count));
+  for (int key = 0; key < count; ++key) {
+    auto const index = map.find(key);
+    ASSERT_TRUE(map.valid_at(index)) << key;
+    ASSERT_EQ(map.value_at(index), char(key % 100)) << key;
+  }
+}
+
+}  // namespace Test
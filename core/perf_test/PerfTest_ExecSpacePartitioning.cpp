@@ -18,6 +18,8 @@
 #include <benchmark/benchmark.h>
 #include "PerfTest_Category.hpp"
 
+#include <thread>
+
 namespace Test {
 
 namespace {
@@ -696,4 +698,66 @@ BENCHMARK(OverlapTeamPolicy)
     ->ArgNames({"N", "M", "R"})
     ->Args({20, 1'000'000, 10});
 
+#if defined(KOKKOS_ENABLE_THREADS) || defined(KOKKOS_ENABLE_OPENMP)
+// Host backends run a partition's kernels on the submitting thread plus the
+// workers it borrowed, so overlap requires one host thread per partition.
+static void OverlapHostThreads(benchmark::State& state) {
+  int N = state.range(0);
+  int M = state.range(1);
+  int R = state.range(2);
+
+  TEST_EXECSPACE space;
+  if (!std::is_same<TEST_EXECSPACE, Kokkos::DefaultHostExecutionSpace>::value ||
+      space.concurrency() < 2) {
+    state.SkipWithError("needs a host execution space with two threads");
+    return;
+  }
+  std::vector<TEST_EXECSPACE> execution_space_instances =
+      Kokkos::Experimental::partition_space(space, 1, 1);
+  TEST_EXECSPACE space1 = execution_space_instances[0];
+  TEST_EXECSPACE space2 = execution_space_instances[1];
+
+  for (auto _ : state) {
+    Kokkos::View<double**, TEST_EXECSPACE> a1("A1", N, M);
+    Kokkos::View<double**, TEST_EXECSPACE> a2("A2", N, M);
+    Kokkos::fence();
+
+    Kokkos::Timer timer;
+    Kokkos::parallel_for("default_exec::overlap_host_threads::kernel0",
+                         Kokkos::RangePolicy<TEST_EXECSPACE>(space, 0, N),
+                         FunctorRange(M, R, a1));
+    Kokkos::parallel_for("default_exec::overlap_host_threads::kernel1",
+                         Kokkos::RangePolicy<TEST_EXECSPACE>(space, 0, N),
+                         FunctorRange(M, R, a2));
+    space.fence();
+    double time_sequential = timer.seconds();
+
+    timer.reset();
+    std::thread t1([&]() {
+      Kokkos::parallel_for("default_exec::overlap_host_threads::kernel2",
+                           Kokkos::RangePolicy<TEST_EXECSPACE>(space1, 0, N),
+                           FunctorRange(M, R, a1));
+      space1.fence();
+    });
+    std::thread t2([&]() {
+      Kokkos::parallel_for("default_exec::overlap_host_threads::kernel3",
+                           Kokkos::RangePolicy<TEST_EXECSPACE>(space2, 0, N),
+                           FunctorRange(M, R, a2));
+      space2.fence();
+    });
+    t1.join();
+    t2.join();
+    double time_partitioned = timer.seconds();
+
+    state.counters["Time Sequential"]  = benchmark::Counter(time_sequential);
+    state.counters["Time Partitioned"] = benchmark::Counter(time_partitioned);
+  }
+}
+
+BENCHMARK(OverlapHostThreads)
+    ->ArgNames({"N", "M", "R"})
+    ->Args({2'000, 10'000, 10})
+    ->UseRealTime();
+#endif
+
 }  // namespace Test
@@ -399,3 +399,105 @@ BENCHMARK(Test_Atomic<unsigned long long int>)->Arg(LOOP)->Iterations(10);
 BENCHMARK(Test_Atomic<float>)->Arg(LOOP)->Iterations(10);
 BENCHMARK(Test_Atomic<double>)->Arg(LOOP)->Iterations(10);
 BENCHMARK(Test_Atomic<int>)->Arg(LOOP)->Iterations(10);
+
+//---------------------------------------------------
+//--------------non-native atomic_add----------------
+//---------------------------------------------------
+
+// Types without a native atomic instruction. On x86-64 host backends 16 byte
+// types use cmpxchg16b when the compiler targets CX16 (e.g. -mcx16), anything
+// else goes through the striped desul lock array.
+struct Double2 {
+  double x = 0;
+  double y = 0;
+
+  Double2() = default;
+  KOKKOS_FUNCTION Double2(double v) : x(v), y(v) {}
+  KOKKOS_FUNCTION Double2 operator+(const Double2& other) const {
+    Double2 sum;
+    sum.x = x + other.x;
+    sum.y = y + other.y;
+    return sum;
+  }
+};
+
+struct Double3 {
+  double x = 0;
+  double y = 0;
+  double z = 0;
+
+  Double3() = default;
+  KOKKOS_FUNCTION Double3(double v) : x(v), y(v), z(v) {}
+  KOKKOS_FUNCTION Double3 operator+(const Double3& other) const {
+    Double3 sum;
+    sum.x = x + other.x;
+    sum.y = y + other.y;
+    sum.z = z + other.z;
+    return sum;
+  }
+};
+
+inline double first_component(const Kokkos::complex<double>& val) {
+  return val.real();
+}
+inline double first_component(const Double2& val) { return val.x; }
+inline double first_component(const Double3& val) { return val.x; }
+
+template <class T>
+struct AddSpreadFunctor {
+  Kokkos::View<T*, exec_space> data;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(int i) const {
+    Kokkos::atomic_add(&data(i % data.extent(0)), T(1));
+  }
+};
+
+// Every thread adds into one of 'targets' consecutive elements, so for small
+// numbers of targets the atomics contend on a single address and for larger
+// numbers neighbouring elements are updated concurrently.
+template <class T>
+static void Test_Atomic_Add_Spread(benchmark::State& state) {
+  const int loop    = state.range(0);
+  const int targets = state.range(1);
+
+  Kokkos::View<T*, exec_space> data("Data", targets);
+  AddSpreadFunctor<T> f_add{data};
+
+  for (auto _ : state) {
+    Kokkos::deep_copy(data, T(0));
+    exec_space().fence();
+
+    Kokkos::Timer timer;
+    Kokkos::parallel_for(Kokkos::RangePolicy<exec_space>(0, loop), f_add);
+    exec_space().fence();
+    state.SetIterationTime(timer.seconds());
+  }
+
+  auto h_data = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), data);
+  double sum  = 0;
+  for (int i = 0; i < targets; ++i) sum += first_component(h_data(i));
+
+  state.counters["Passed"]       = benchmark::Counter(sum == loop);
+  state.counters["Size of type"] = benchmark::Counter(sizeof(T));
+  state.counters[KokkosBenchmark::benchmark_fom("Mops/s")] =
+      benchmark::Counter(loop / 1e6,
+                         benchmark::Counter::kIsIterationInvariantRate);
+}
+
+static void Atomic_Add_Spread_Args(benchmark::internal::Benchmark* b) {
+  for (int targets : {1, 64, 1024}) b->Args({1'000'000, targets});
+}
+
+BENCHMARK(Test_Atomic_Add_Spread<Kokkos::complex<double>>)
+    ->Apply(Atomic_Add_Spread_Args)
+    ->UseManualTime()
+    ->Iterations(10);
+BENCHMARK(Test_Atomic_Add_Spread<Double2>)
+    ->Apply(Atomic_Add_Spread_Args)
+    ->UseManualTime()
+    ->Iterations(10);
+BENCHMARK(Test_Atomic_Add_Spread<Double3>)
+    ->Apply(Atomic_Add_Spread_Args)
+    ->UseManualTime()
+    ->Iterations(10);
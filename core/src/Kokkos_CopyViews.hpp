@@ -2958,6 +2958,107 @@ bool size_mismatch(const ViewType& view, unsigned int max_extent,
   return false;
 }
 
+// Views can only be resized in place along the dimension whose stride is
+// largest: the first one for LayoutRight and the last one for LayoutLeft.
+// Elements keep their offsets only if that dimension is the one changing.
+template <typename ViewType>
+constexpr unsigned view_growth_dimension() {
+  return std::is_same<typename ViewType::array_layout,
+                      Kokkos::LayoutLeft>::value
+             ? ViewType::rank() - 1
+             : 0;
+}
+
+template <typename ViewType>
+constexpr bool view_can_grow_in_place() {
+  using value_type = typename ViewType::value_type;
+  return ViewType::rank() > 0 &&
+         view_growth_dimension<ViewType>() < ViewType::rank_dynamic &&
+         std::is_trivially_copyable<value_type>::value &&
+         (std::is_same<typename ViewType::array_layout,
+                       Kokkos::LayoutLeft>::value ||
+          std::is_same<typename ViewType::array_layout,
+                       Kokkos::LayoutRight>::value);
+}
+
+// The number of elements the allocation of the view holds from its first
+// element on.
+template <typename ViewType>
+size_t view_allocated_span(const ViewType& view) {
+  auto* const record = view.impl_track().template get_record<void>();
+  if (record == nullptr || view.data() == nullptr) return view.span();
+  const size_t offset = reinterpret_cast<const char*>(view.data()) -
+                        static_cast<const char*>(record->data());
+  return (record->size() - offset) / sizeof(typename ViewType::value_type);
+}
+
+// The number of elements of the other dimensions per index of the growth
+// dimension.
+template <typename ViewType>
+size_t view_growth_stride(const ViewType& view) {
+  size_t stride = 1;
+  for (unsigned r = 0; r < ViewType::rank(); ++r) {
+    if (r != view_growth_dimension<ViewType>()) stride *= view.extent(r);
+  }
+  return stride;
+}
+
+// A view of the allocation of `view` with the given layout, which must not
+// be padded and must fit into the allocation.
+template <typename ViewType>
+ViewType view_reshape(const ViewType& view,
+                      const typename ViewType::array_layout& layout) {
+  return ViewType(view.impl_track(), ViewType(view.data(), layout).impl_map());
+}
+
+/** \brief  Resizes the view without reallocating if only its growth
+ *  dimension changes, the view is the only one referencing its allocation
+ *  and the allocation is large enough. Returns whether it did.
+ */
+template <typename ViewType, class... ViewCtorArgs>
+bool view_resize_in_place(const ViewCtorProp<ViewCtorArgs...>& arg_prop,
+                          ViewType& v, const size_t n0, const size_t n1,
+                          const size_t n2, const size_t n3, const size_t n4,
+                          const size_t n5, const size_t n6, const size_t n7) {
+  using alloc_prop_input = ViewCtorProp<ViewCtorArgs...>;
+  using value_type       = typename ViewType::value_type;
+
+  if constexpr (!view_can_grow_in_place<ViewType>() ||
+                alloc_prop_input::allow_padding) {
+    return false;
+  } else {
+    if (v.use_count() != 1 || !v.span_is_contiguous()) return false;
+
+    const ViewType reshaped(v.data(), n0, n1, n2, n3, n4, n5, n6, n7);
+    for (unsigned r = 0; r < ViewType::rank(); ++r) {
+      if (r != view_growth_dimension<ViewType>() &&
+          reshaped.extent(r) != v.extent(r)) {
+        return false;
+      }
+    }
+    const size_t old_span = v.span();
+    const size_t new_span = reshaped.span();
+    if (new_span > view_allocated_span(v)) return false;
+
+    v = view_reshape(v, reshaped.layout());
+
+    if (alloc_prop_input::initialize && new_span > old_span) {
+      Kokkos::View<value_type*, typename ViewType::memory_space,
+                   Kokkos::MemoryUnmanaged>
+          tail(v.data() + old_span, new_span - old_span);
+      if constexpr (alloc_prop_input::has_execution_space) {
+        Kokkos::deep_copy(get_property<ExecutionSpaceTag>(arg_prop), tail,
+                          value_type());
+      } else {
+        typename ViewType::execution_space exec;
+        Kokkos::deep_copy(exec, tail, value_type());
+        exec.fence("Kokkos::resize(View)");
+      }
+    }
+    return true;
+  }
+}
+
 }  // namespace Impl
 
 /** \brief  Resize a view with copying old data to new data at the corresponding
@@ -2987,17 +3088,13 @@ impl_resize(const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
                 "The view constructor arguments passed to Kokkos::resize must "
                 "not include a memory space instance!");
 
-  // TODO (mfh 27 Jun 2017) If the old View has enough space but just
-  // different dimensions (e.g., if the product of the dimensions,
-  // including extra space for alignment, will not change), then
-  // consider just reusing storage.  For now, Kokkos always
-  // reallocates if any of the dimensions change, even if the old View
-  // has enough space.
-
   const size_t new_extents[8] = {n0, n1, n2, n3, n4, n5, n6, n7};
   const bool sizeMismatch = Impl::size_mismatch(v, v.rank_dynamic, new_extents);
 
-  if (sizeMismatch) {
+  // Views that only change their growth dimension reuse their allocation if
+  // it is large enough, see Kokkos::Experimental::reserve.
+  if (sizeMismatch && !Impl::view_resize_in_place(arg_prop, v, n0, n1, n2, n3,
+                                                  n4, n5, n6, n7)) {
     auto prop_copy = Impl::with_properties_if_unset(
         arg_prop, typename view_type::execution_space{}, v.label());
 
@@ -3008,7 +3105,7 @@ impl_resize(const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
           v_resized, v, Impl::get_property<Impl::ExecutionSpaceTag>(prop_copy));
     else {
       Kokkos::Impl::ViewRemap<view_type, view_type>(v_resized, v);
-      Kokkos::fence("Kokkos::resize(View)");
+      typename view_type::execution_space().fence("Kokkos::resize(View)");
     }
 
     v = v_resized;
@@ -3107,7 +3204,7 @@ impl_resize(const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
           v_resized, v, Impl::get_property<Impl::ExecutionSpaceTag>(arg_prop));
     else {
       Kokkos::Impl::ViewRemap<view_type, view_type>(v_resized, v);
-      Kokkos::fence("Kokkos::resize(View)");
+      typename view_type::execution_space().fence("Kokkos::resize(View)");
     }
 
     v = v_resized;
@@ -3153,7 +3250,7 @@ impl_resize(const Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
         v_resized, v, Impl::get_property<Impl::ExecutionSpaceTag>(arg_prop));
   else {
     Kokkos::Impl::ViewRemap<view_type, view_type>(v_resized, v);
-    Kokkos::fence("Kokkos::resize(View)");
+    typename view_type::execution_space().fence("Kokkos::resize(View)");
   }
 
   v = v_resized;
@@ -3186,6 +3283,94 @@ inline void resize(Kokkos::View<T, P...>& v,
   impl_resize(Impl::ViewCtorProp<>{}, v, layout);
 }
 
+namespace Experimental {
+
+/** \brief  The extent the growth dimension of the view can be resized to
+ *  without reallocating: the first dimension for LayoutRight and the last one
+ *  for LayoutLeft.
+ */
+template <class T, class... P>
+inline std::enable_if_t<
+    Kokkos::Impl::view_can_grow_in_place<Kokkos::View<T, P...>>(), size_t>
+capacity(const Kokkos::View<T, P...>& v) {
+  using view_type   = Kokkos::View<T, P...>;
+  const size_t step = Kokkos::Impl::view_growth_stride(v);
+  return step == 0 || !v.span_is_contiguous()
+             ? v.extent(Kokkos::Impl::view_growth_dimension<view_type>())
+             : Kokkos::Impl::view_allocated_span(v) / step;
+}
+
+/** \brief  Makes the capacity of the view at least n, keeping its extents
+ *  and contents.
+ *
+ *  A reallocation at least doubles the capacity, so that growing a view by
+ *  calling reserve and resize with increasing extents reallocates only a
+ *  logarithmic number of times. Kokkos::resize then changes the growth
+ *  dimension in place, as long as the view is the only one referencing its
+ *  allocation.
+ */
+template <class T, class... P, class... ViewCtorArgs>
+inline std::enable_if_t<
+    Kokkos::Impl::view_can_grow_in_place<Kokkos::View<T, P...>>()>
+reserve(const Kokkos::Impl::ViewCtorProp<ViewCtorArgs...>& arg_prop,
+        Kokkos::View<T, P...>& v, size_t n) {
+  using view_type        = Kokkos::View<T, P...>;
+  using alloc_prop_input = Kokkos::Impl::ViewCtorProp<ViewCtorArgs...>;
+
+  static_assert(Kokkos::ViewTraits<T, P...>::is_managed,
+                "Can only reserve managed views");
+  static_assert(!alloc_prop_input::has_label,
+                "The view constructor arguments passed to "
+                "Kokkos::Experimental::reserve must not include a label!");
+  static_assert(!alloc_prop_input::has_pointer,
+                "The view constructor arguments passed to "
+                "Kokkos::Experimental::reserve must not include a pointer!");
+  static_assert(!alloc_prop_input::has_memory_space,
+                "The view constructor arguments passed to "
+                "Kokkos::Experimental::reserve must not include a memory "
+                "space instance!");
+  static_assert(!alloc_prop_input::allow_padding,
+                "Kokkos::Experimental::reserve does not support padding!");
+
+  const size_t old_capacity = capacity(v);
+  if (n <= old_capacity) return;
+  if (n < 2 * old_capacity) n = 2 * old_capacity;
+
+  auto layout = v.layout();
+  layout.dimension[Kokkos::Impl::view_growth_dimension<view_type>()] = n;
+  auto prop_copy = Kokkos::Impl::with_properties_if_unset(
+      arg_prop, typename view_type::execution_space{}, v.label());
+  view_type v_reserved =
+      Kokkos::Impl::view_reshape(view_type(prop_copy, layout), v.layout());
+
+  if constexpr (alloc_prop_input::has_execution_space) {
+    Kokkos::deep_copy(
+        Kokkos::Impl::get_property<Kokkos::Impl::ExecutionSpaceTag>(prop_copy),
+        v_reserved, v);
+  } else {
+    Kokkos::deep_copy(v_reserved, v);
+  }
+  v = v_reserved;
+}
+
+template <class T, class... P>
+inline std::enable_if_t<
+    Kokkos::Impl::view_can_grow_in_place<Kokkos::View<T, P...>>()>
+reserve(Kokkos::View<T, P...>& v, size_t n) {
+  reserve(Kokkos::Impl::ViewCtorProp<>{}, v, n);
+}
+
+template <class I, class T, class... P>
+inline std::enable_if_t<
+    (Kokkos::Impl::is_view_ctor_property<I>::value ||
+     Kokkos::is_execution_space<I>::value) &&
+    Kokkos::Impl::view_can_grow_in_place<Kokkos::View<T, P...>>()>
+reserve(const I& arg_prop, Kokkos::View<T, P...>& v, size_t n) {
+  reserve(Kokkos::view_alloc(arg_prop), v, n);
+}
+
+}  // namespace Experimental
+
 /** \brief  Resize a view with discarding old data. */
 template <class T, class... P, class... ViewCtorArgs>
 inline std::enable_if_t<
@@ -133,6 +133,12 @@ void push_finalize_hook(std::function<void()> f);
 
 void fence(const std::string& name /*= "Kokkos::fence: Unnamed Global Fence"*/);
 
+namespace Experimental {
+/// \brief The number of global fences, i.e. calls of Kokkos::fence() by the
+///   user or by Kokkos itself, since the program started.
+[[nodiscard]] size_t global_fence_count() noexcept;
+}  // namespace Experimental
+
 /** \brief Print "Bill of Materials" */
 void print_configuration(std::ostream& os, bool verbose = false);
 
@@ -291,6 +297,7 @@ std::vector<ExecSpace> partition_space(ExecSpace const& space,
 
 #include <Kokkos_Crs.hpp>
 #include <Kokkos_WorkGraphPolicy.hpp>
+#include <Kokkos_Event.hpp>
 // Including this in Kokkos_Parallel_Reduce.hpp led to a circular dependency
 // because Kokkos::Sum is used in Kokkos_Combined_Reducer.hpp and the default.
 // The real answer is to finally break up Kokkos_Parallel_Reduce.hpp into
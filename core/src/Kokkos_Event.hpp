@@ -0,0 +1,131 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file Kokkos_Event.hpp
+/// \brief Declaration and definition of Kokkos::Experimental::Event.
+
+#ifndef KOKKOS_EVENT_HPP
+#define KOKKOS_EVENT_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_EVENT
+#endif
+
+#include <Kokkos_Core_fwd.hpp>
+#include <Kokkos_Concepts.hpp>
+#include <impl/Kokkos_HostInstanceCompletion.hpp>
+
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace Kokkos {
+namespace Experimental {
+
+/// \class Event
+/// \brief Marks the work submitted to an execution space instance up to some
+///   point, so that the calling thread or other instances can wait for it.
+///
+/// Waiting for an event only synchronizes with the instance it was recorded
+/// on, in contrast to Kokkos::fence() which waits for every instance of every
+/// enabled execution space. An event that was never recorded is complete.
+///
+/// Instances of OpenMP and Threads count the kernels launched on them and
+/// those that completed. On these, recording an event only reads a counter,
+/// and an instance waiting for an event is not blocked at all: its next
+/// kernel starts as soon as the recorded kernels completed. For other
+/// backends, waiting for an event fences the instance it was recorded on.
+template <class ExecutionSpace = DefaultExecutionSpace>
+class Event {
+  static_assert(is_execution_space_v<ExecutionSpace>,
+                "Kokkos::Experimental::Event requires an execution space");
+
+  using completion_type = Kokkos::Impl::HostInstanceCompletion;
+  template <class Space>
+  using completion_of = Kokkos::Impl::ExecSpaceCompletion<Space>;
+
+ public:
+  using execution_space = ExecutionSpace;
+
+  Event() = default;
+
+  /// \brief Records all work submitted to \c exec so far.
+  explicit Event(execution_space const& exec) { record(exec); }
+
+  /// \brief Records all work submitted to \c exec so far, replacing what was
+  ///   recorded before.
+  void record(execution_space const& exec) {
+    m_exec       = exec;
+    m_completion = completion_of<execution_space>::get(exec);
+    m_ticket     = m_completion ? m_completion->last_launched() : 0;
+  }
+
+  bool is_recorded() const { return m_exec.has_value(); }
+
+  /// \brief Whether the recorded work completed.
+  ///
+  /// For backends that do not track the completion of their kernels this
+  /// fences the instance.
+  bool query() const {
+    if (!m_exec) return true;
+    if (m_completion) return m_completion->is_complete(m_ticket);
+    m_exec->fence("Kokkos::Experimental::Event::query");
+    return true;
+  }
+
+  /// \brief Blocks until the recorded work completed.
+  void wait(std::string const& name =
+                "Kokkos::Experimental::Event::wait: Unnamed Event Wait") const {
+    if (!m_exec) return;
+    if (m_completion) {
+      m_completion->wait(m_ticket);
+    } else {
+      m_exec->fence(name);
+    }
+  }
+
+  /// \brief Makes the work submitted to \c exec from now on wait until the
+  ///   recorded work completed, without blocking the calling thread.
+  ///
+  /// Blocks the calling thread as wait() if either instance does not track
+  /// the completion of its kernels.
+  template <class OtherExecutionSpace>
+  std::enable_if_t<is_execution_space_v<OtherExecutionSpace>> wait(
+      OtherExecutionSpace const& exec) const {
+    if (!m_exec) return;
+    completion_type* const waiting =
+        completion_of<OtherExecutionSpace>::get(exec);
+    if (m_completion && waiting) {
+      waiting->add_dependency(*m_completion, m_ticket);
+    } else {
+      wait("Kokkos::Experimental::Event::wait: wait on an instance");
+    }
+  }
+
+ private:
+  std::optional<execution_space> m_exec;
+  completion_type* m_completion = nullptr;
+  typename completion_type::ticket_type m_ticket = 0;
+};
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_EVENT
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_EVENT
+#endif
+#endif
@@ -35,6 +35,7 @@ static_assert(false,
 
 #include <impl/Kokkos_Traits.hpp>
 #include <impl/Kokkos_FunctorAnalysis.hpp>
+#include <impl/Kokkos_HostSubmissionQueue.hpp>
 
 #include <cstddef>
 #include <type_traits>
@@ -141,7 +142,7 @@ inline void parallel_for(const std::string& str, const ExecPolicy& policy,
   Impl::ParallelFor<FunctorType, ExecPolicy> closure(functor, inner_policy);
   Kokkos::Impl::shared_allocation_tracking_enable();
 
-  closure.execute();
+  Impl::launch_closure(inner_policy.space(), closure);
 
   Kokkos::Tools::Impl::end_parallel_for(inner_policy, functor, str, kpID);
 }
@@ -357,7 +358,7 @@ inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
                                                            inner_policy);
   Kokkos::Impl::shared_allocation_tracking_enable();
 
-  closure.execute();
+  Impl::launch_closure(inner_policy.space(), closure);
 
   Kokkos::Tools::Impl::end_parallel_scan(inner_policy, functor, str, kpID);
 }
@@ -403,14 +404,14 @@ inline void parallel_scan(const std::string& str, const ExecutionPolicy& policy,
                                 typename ReturnType::value_type>
         closure(functor, inner_policy, return_value);
     Kokkos::Impl::shared_allocation_tracking_enable();
-    closure.execute();
+    Impl::launch_closure(inner_policy.space(), closure);
   } else {
     Kokkos::Impl::shared_allocation_tracking_disable();
     Kokkos::View<ReturnType, Kokkos::HostSpace> view(&return_value);
     Impl::ParallelScanWithTotal<FunctorType, ExecutionPolicy, ReturnType>
         closure(functor, inner_policy, view);
     Kokkos::Impl::shared_allocation_tracking_enable();
-    closure.execute();
+    Impl::launch_closure(inner_policy.space(), closure);
   }
 
   Kokkos::Tools::Impl::end_parallel_scan(inner_policy, functor, str, kpID);
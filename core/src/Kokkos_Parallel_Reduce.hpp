@@ -1514,7 +1514,8 @@ struct ParallelReduceAdaptor {
         closure(functor_reducer, inner_policy,
                 return_value_adapter::return_value(return_value, functor));
     Kokkos::Impl::shared_allocation_tracking_enable();
-    closure.execute();
+
+    Impl::launch_closure(inner_policy.space(), closure);
 
     Kokkos::Tools::Impl::end_parallel_reduce<PassedReducerType>(
         inner_policy, functor, label, kpID);
@@ -1770,6 +1770,27 @@ KOKKOS_DEPRECATED KOKKOS_INLINE_FUNCTION auto subview(const View<D, P...>& src,
 template <class V, class... Args>
 using Subview = decltype(subview(std::declval<V>(), std::declval<Args>()...));
 
+namespace Experimental {
+
+/** \brief  Unmanaged View of the same data, layout and device as \c src.
+ *
+ *  Copying the result does not touch the reference count of the allocation,
+ *  which makes it cheap to capture by value into functors and lambdas.  The
+ *  caller must keep a managed View alive while the result is in use.
+ */
+template <class D, class... P>
+KOKKOS_INLINE_FUNCTION auto as_unmanaged(const View<D, P...>& src) {
+  using traits = ViewTraits<D, P...>;
+  using unmanaged_type =
+      View<typename traits::data_type, typename traits::array_layout,
+           typename traits::device_type, typename traits::hooks_policy,
+           Kokkos::MemoryTraits<traits::memory_traits::impl_value |
+                                Kokkos::Unmanaged>>;
+  return unmanaged_type(src);
+}
+
+}  // namespace Experimental
+
 } /* namespace Kokkos */
 
 //----------------------------------------------------------------------------
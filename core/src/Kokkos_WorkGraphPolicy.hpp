@@ -23,6 +23,7 @@ static_assert(false,
 #define KOKKOS_WORKGRAPHPOLICY_HPP
 
 #include <impl/Kokkos_AnalyzePolicy.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
 #include <Kokkos_Crs.hpp>
 
 namespace Kokkos {
@@ -219,6 +220,278 @@ class WorkGraphPolicy : public Kokkos::Impl::PolicyTraits<Properties...> {
 
 }  // namespace Kokkos
 
+namespace Kokkos {
+namespace Experimental {
+
+/**\brief  Executes the nodes of a directed acyclic graph on a host execution
+ *         space, each after all of its predecessors, like WorkGraphPolicy.
+ *
+ *  Row w of the graph lists the nodes that wait for node w. Every worker
+ *  thread owns a ready stack; the nodes it makes ready go onto its own stack,
+ *  so that successors tend to run on the thread that produced their inputs.
+ *  Workers take batches from their own stack and, when it is empty, steal
+ *  smaller batches from the stacks of the nearest workers. The stacks are
+ *  linked through one next index per node, so the memory used does not grow
+ *  with the number of workers.
+ *
+ *  Indices are 64-bit unless an index type is given. The predecessor counts
+ *  are computed once: every parallel_for with the same policy runs the whole
+ *  graph again.
+ */
+template <class... Properties>
+class ScalableWorkGraphPolicy
+    : public Kokkos::Impl::PolicyTraits<Properties...> {
+ public:
+  using execution_policy = ScalableWorkGraphPolicy<Properties...>;
+  using self_type        = ScalableWorkGraphPolicy<Properties...>;
+  using traits           = Kokkos::Impl::PolicyTraits<Properties...>;
+  using index_type       = std::make_signed_t<typename traits::index_type>;
+  using member_type      = index_type;
+  using execution_space  = typename traits::execution_space;
+  using memory_space     = typename execution_space::memory_space;
+  using graph_type = Kokkos::Crs<index_type, execution_space, void, index_type>;
+
+  static_assert(SpaceAccessibility<HostSpace, memory_space>::accessible,
+                "Kokkos::Experimental::ScalableWorkGraphPolicy requires a host "
+                "execution space");
+
+  static constexpr index_type END_TOKEN = -1;
+
+  // The number of nodes a worker takes from its own stack at once; steals
+  // take a quarter of it.
+  static constexpr int batch_size = 16;
+
+ private:
+  using indices_type = Kokkos::View<index_type*, memory_space>;
+
+  // The heads of the ready stacks are a cache line apart.
+  static constexpr int head_stride = 64 / sizeof(index_type);
+
+  graph_type m_graph;
+  execution_space m_space;
+  int m_num_queues;
+  indices_type m_in_degree;  // the number of predecessors of each node
+  indices_type m_count;      // the predecessors yet to complete
+  indices_type m_next;       // the node below each node in its ready stack
+  indices_type m_heads;      // the top of each ready stack
+  indices_type m_completed;  // the number of completed nodes
+
+  // Pushes the chain first -> ... -> last, linked through m_next, onto
+  // ready stack q.
+  void push_chain(const int q, const index_type first,
+                  const index_type last) const noexcept {
+    index_type* const head = &m_heads[q * head_stride];
+    for (index_type h = Kokkos::atomic_load(head);;) {
+      m_next[last] = h;
+      Kokkos::memory_fence();
+      const index_type old = Kokkos::atomic_compare_exchange(head, h, first);
+      if (old == h) return;
+      h = old;
+    }
+  }
+
+  /**\brief  Pops up to n nodes from ready stack q and returns their number.
+   *
+   *  Each node is pushed once per execution, so a head that is unchanged
+   *  still tops the chain read below it.
+   */
+  int pop_batch(const int q, index_type* const work,
+                const int n) const noexcept {
+    index_type* const head = &m_heads[q * head_stride];
+    for (index_type h = Kokkos::atomic_load(head); h != END_TOKEN;) {
+      int count       = 0;
+      index_type next = h;
+      do {
+        work[count++] = next;
+        next          = Kokkos::atomic_load(&m_next[next]);
+      } while (count < n && next != END_TOKEN);
+      const index_type old = Kokkos::atomic_compare_exchange(head, h, next);
+      if (old == h) {
+        Kokkos::memory_fence();
+        return count;
+      }
+      h = old;
+    }
+    return 0;
+  }
+
+  // Releases the successors of w and pushes those that become ready onto
+  // ready stack q as one chain.
+  void complete(const int q, const index_type w) const noexcept {
+    // Make sure the completed work function's memory accesses are flushed.
+    Kokkos::memory_fence();
+
+    index_type first = END_TOKEN;
+    index_type last  = END_TOKEN;
+    const index_type end = m_graph.row_map(w + 1);
+    for (index_type i = m_graph.row_map(w); i < end; ++i) {
+      const index_type j = m_graph.entries(i);
+      if (1 == Kokkos::atomic_fetch_add(&m_count[j], index_type(-1))) {
+        if (last == END_TOKEN) last = j;
+        m_next[j] = first;
+        first     = j;
+      }
+    }
+    if (first != END_TOKEN) push_chain(q, first, last);
+  }
+
+ public:
+  struct TagCount {};
+  struct TagReset {};
+
+  void operator()(const TagCount, const index_type i) const noexcept {
+    Kokkos::atomic_increment(&m_in_degree[m_graph.entries(i)]);
+  }
+
+  /**\brief  Resets the predecessor counts of the q-th block of nodes and
+   *         makes its nodes without predecessors the ready stack q, in
+   *         index order.
+   */
+  void operator()(const TagReset, const int q) const noexcept {
+    const std::int64_t n = m_graph.numRows();
+    const index_type begin(n * q / m_num_queues);
+    const index_type end(n * (q + 1) / m_num_queues);
+
+    index_type top = END_TOKEN;
+    for (index_type w = end; begin < w--;) {
+      m_count[w] = m_in_degree[w];
+      if (m_in_degree[w] == 0) {
+        m_next[w] = top;
+        top       = w;
+      }
+    }
+    m_heads[q * head_stride] = top;
+    if (q == 0) m_completed[0] = 0;
+  }
+
+  execution_space space() const { return m_space; }
+
+  int impl_num_queues() const { return m_num_queues; }
+
+  void impl_reset() const {
+    using policy_type = RangePolicy<execution_space, IndexType<int>, TagReset>;
+    using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
+    const closure_type closure(
+        *this, policy_type(m_space, 0, m_num_queues, ChunkSize(1)));
+    closure.execute();
+    m_space.fence(
+        "Kokkos::Experimental::ScalableWorkGraphPolicy: fence after resetting "
+        "the ready stacks");
+  }
+
+  /**\brief  Runs nodes, preferring ready stack q, until all nodes of the
+   *         graph have completed.
+   */
+  template <class Function>
+  void impl_run_worker(const int q, const Function& run) const noexcept {
+    const index_type n = m_graph.numRows();
+    index_type work[batch_size];
+    uint32_t idle = 0;
+    for (;;) {
+      int count = pop_batch(q, work, batch_size);
+      // Steal from the nearest workers first: q + 1, q - 1, q + 2, ...
+      for (int d = 1; count == 0 && d < m_num_queues; ++d) {
+        const int offset = d % 2 ? (d + 1) / 2 : -(d / 2);
+        count = pop_batch((q + offset + m_num_queues) % m_num_queues, work,
+                          batch_size / 4);
+      }
+      if (count == 0) {
+        if (Kokkos::atomic_load(&m_completed[0]) == n) return;
+        Kokkos::Impl::host_thread_yield(++idle, Kokkos::Impl::WaitMode::ACTIVE);
+        continue;
+      }
+      idle = 0;
+      for (int k = 0; k < count; ++k) {
+        run(work[k]);
+        complete(q, work[k]);
+      }
+      Kokkos::atomic_add(&m_completed[0], index_type(count));
+    }
+  }
+
+  ScalableWorkGraphPolicy(const graph_type& arg_graph)
+      : ScalableWorkGraphPolicy(execution_space(), arg_graph) {}
+
+  ScalableWorkGraphPolicy(const execution_space& arg_space,
+                          const graph_type& arg_graph)
+      : m_graph(arg_graph),
+        m_space(arg_space),
+        m_num_queues(arg_space.concurrency()),
+        m_in_degree("Kokkos::ScalableWorkGraphPolicy::in_degree",
+                    arg_graph.numRows()),
+        m_count(view_alloc("Kokkos::ScalableWorkGraphPolicy::count",
+                           WithoutInitializing),
+                arg_graph.numRows()),
+        m_next(view_alloc("Kokkos::ScalableWorkGraphPolicy::next",
+                          WithoutInitializing),
+               arg_graph.numRows()),
+        m_heads(view_alloc("Kokkos::ScalableWorkGraphPolicy::heads",
+                           WithoutInitializing),
+                m_num_queues * head_stride),
+        m_completed("Kokkos::ScalableWorkGraphPolicy::completed", 1) {
+    using policy_type  = RangePolicy<execution_space, IndexType<index_type>,
+                                    TagCount>;
+    using closure_type = Kokkos::Impl::ParallelFor<self_type, policy_type>;
+    const closure_type closure(
+        *this, policy_type(m_space, 0, m_graph.entries.extent(0)));
+    closure.execute();
+    m_space.fence(
+        "Kokkos::Experimental::ScalableWorkGraphPolicy: fence after counting "
+        "predecessors");
+  }
+};
+
+}  // namespace Experimental
+
+namespace Impl {
+
+template <class FunctorType, class... Traits, class ExecutionSpace>
+class ParallelFor<FunctorType,
+                  Kokkos::Experimental::ScalableWorkGraphPolicy<Traits...>,
+                  ExecutionSpace> {
+ private:
+  using Policy = Kokkos::Experimental::ScalableWorkGraphPolicy<Traits...>;
+  using WorkTag    = typename Policy::work_tag;
+  using index_type = typename Policy::index_type;
+
+  Policy m_policy;
+  FunctorType m_functor;
+
+  // Each iteration is one worker, which returns once the graph completed.
+  struct Worker {
+    Policy m_policy;
+    FunctorType m_functor;
+
+    void operator()(const int q) const noexcept {
+      m_policy.impl_run_worker(q, [this](const index_type w) {
+        if constexpr (std::is_void<WorkTag>::value) {
+          m_functor(w);
+        } else {
+          m_functor(WorkTag{}, w);
+        }
+      });
+    }
+  };
+
+ public:
+  inline void execute() const {
+    using worker_policy =
+        RangePolicy<ExecutionSpace, Schedule<Static>, IndexType<int>>;
+    m_policy.impl_reset();
+    const ParallelFor<Worker, worker_policy> closure(
+        Worker{m_policy, m_functor},
+        worker_policy(m_policy.space(), 0, m_policy.impl_num_queues(),
+                      ChunkSize(1)));
+    closure.execute();
+  }
+
+  inline ParallelFor(const FunctorType& arg_functor, const Policy& arg_policy)
+      : m_policy(arg_policy), m_functor(arg_functor) {}
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
 #ifdef KOKKOS_ENABLE_SERIAL
 #include "Serial/Kokkos_Serial_WorkGraphPolicy.hpp"
 #endif
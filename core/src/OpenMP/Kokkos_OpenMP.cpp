@@ -50,7 +50,12 @@ int OpenMP::impl_get_current_max_threads() noexcept {
 
 void OpenMP::impl_initialize(InitializationSettings const &settings) {
   Impl::OpenMPInternal::singleton().initialize(
-      settings.has_num_threads() ? settings.get_num_threads() : -1);
+      settings.has_num_threads() ? settings.get_num_threads() : -1,
+      settings.has_bind_threads()
+          ? Impl::host_thread_binding_from_string(settings.get_bind_threads())
+          : Impl::HostThreadBinding::none,
+      settings.has_lazy_initialization() &&
+          settings.get_lazy_initialization());
 }
 
 void OpenMP::impl_finalize() { Impl::OpenMPInternal::singleton().finalize(); }
@@ -73,8 +78,44 @@ int OpenMP::concurrency() const { return impl_thread_pool_size(); }
 #endif
 
 void OpenMP::fence(const std::string &name) const {
+  // Unless queued, kernels are dispatched synchronously, then only wait for
+  // the events other instances have to reach before the next kernel on this
+  // one.
   Kokkos::Tools::Experimental::Impl::profile_fence_event<Kokkos::OpenMP>(
-      name, Kokkos::Tools::Experimental::Impl::DirectFenceIDHandle{1}, []() {});
+      name, Kokkos::Tools::Experimental::Impl::DirectFenceIDHandle{1}, [&]() {
+        Impl::OpenMPInternal *const instance = impl_internal_space_instance();
+        if (Impl::HostSubmissionQueue *const queue =
+                instance->submission_queue()) {
+          queue->fence();
+        }
+        instance->completion()->wait_for_dependencies();
+      });
+}
+
+bool OpenMP::is_asynchronous(OpenMP const &instance) noexcept {
+  return instance.impl_internal_space_instance()->submission_queue() !=
+         nullptr;
+}
+
+void Experimental::set_async_dispatch(OpenMP const &instance, bool enable) {
+  instance.impl_internal_space_instance()->set_async_dispatch(enable);
+}
+
+void Experimental::reserve_team_scratch(OpenMP const &instance,
+                                        size_t level0_bytes,
+                                        size_t level1_bytes) {
+  instance.fence(
+      "Kokkos::Experimental::reserve_team_scratch: fence before resizing "
+      "scratch");
+  instance.impl_internal_space_instance()->reserve_team_scratch(level0_bytes,
+                                                                level1_bytes);
+}
+
+void Experimental::shrink_team_scratch(OpenMP const &instance) {
+  instance.fence(
+      "Kokkos::Experimental::shrink_team_scratch: fence before releasing "
+      "scratch");
+  instance.impl_internal_space_instance()->shrink_team_scratch();
 }
 
 bool OpenMP::impl_is_initialized() noexcept {
@@ -42,6 +42,7 @@ static_assert(false,
 #include <impl/Kokkos_HostSharedPtr.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
 #include <impl/Kokkos_InitializationSettings.hpp>
+#include <impl/Kokkos_HostSubmissionQueue.hpp>
 
 #include <omp.h>
 
@@ -102,7 +103,7 @@ class OpenMP {
   /// a parallel algorithm
   ///
   /// This always returns false on OpenMP
-  inline static bool is_asynchronous(OpenMP const& = OpenMP()) noexcept;
+  static bool is_asynchronous(OpenMP const& = OpenMP()) noexcept;
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_3
   /// \brief Partition the default instance and call 'f' on each new 'master'
@@ -183,11 +184,7 @@ inline void OpenMP::impl_static_fence(std::string const& name) {
       name,
       Kokkos::Tools::Experimental::SpecialSynchronizationCases::
           GlobalDeviceSynchronization,
-      []() {});
-}
-
-inline bool OpenMP::is_asynchronous(OpenMP const& /*instance*/) noexcept {
-  return false;
+      []() { Impl::HostSubmissionQueue::fence_all(); });
 }
 
 inline int OpenMP::impl_thread_pool_size(int depth) const {
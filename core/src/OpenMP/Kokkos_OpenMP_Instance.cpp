@@ -25,15 +25,31 @@
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_ExecSpaceManager.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <cstring>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <mutex>
 #include <sstream>
 #include <thread>
+#include <utility>
 
 namespace Kokkos {
 namespace Impl {
 
+namespace {
+
+// Starts the threads of a lazily initialized backend, run by the first
+// kernel. The flag spares the kernels after it the mutex.
+std::atomic<bool> g_thread_pool_deferred{false};
+std::mutex g_deferred_start_mutex;
+std::function<void()> g_deferred_start;
+
+}  // namespace
+
 void OpenMPInternal::acquire_lock() {
   while (1 == desul::atomic_compare_exchange(&m_pool_mutex, 0, 1,
                                              desul::MemoryOrderAcquire(),
@@ -131,18 +147,12 @@ void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
                                         size_t team_reduce_bytes,
                                         size_t team_shared_bytes,
                                         size_t thread_local_bytes) {
-  const size_t member_bytes =
-      sizeof(int64_t) *
-      HostThreadTeamData::align_to_int64(sizeof(HostThreadTeamData));
-
   HostThreadTeamData *root = m_pool[0];
 
   const size_t old_pool_reduce  = root ? root->pool_reduce_bytes() : 0;
   const size_t old_team_reduce  = root ? root->team_reduce_bytes() : 0;
   const size_t old_team_shared  = root ? root->team_shared_bytes() : 0;
   const size_t old_thread_local = root ? root->thread_local_bytes() : 0;
-  const size_t old_alloc_bytes =
-      root ? (member_bytes + root->scratch_bytes()) : 0;
 
   // Allocate if any of the old allocation is tool small:
 
@@ -165,46 +175,115 @@ void OpenMPInternal::resize_thread_data(size_t pool_reduce_bytes,
       thread_local_bytes = old_thread_local;
     }
 
-    const size_t alloc_bytes =
-        member_bytes +
-        HostThreadTeamData::scratch_size(pool_reduce_bytes, team_reduce_bytes,
-                                         team_shared_bytes, thread_local_bytes);
+    allocate_thread_data(pool_reduce_bytes, team_reduce_bytes,
+                         team_shared_bytes, thread_local_bytes);
+  }
+}
 
-    OpenMP::memory_space space;
+void OpenMPInternal::allocate_thread_data(size_t pool_reduce_bytes,
+                                          size_t team_reduce_bytes,
+                                          size_t team_shared_bytes,
+                                          size_t thread_local_bytes) {
+  // The threads touch their data first, they have to be bound before
+  start_deferred_thread_pool();
 
-    memory_fence();
+  const size_t member_bytes =
+      sizeof(int64_t) *
+      HostThreadTeamData::align_to_int64(sizeof(HostThreadTeamData));
 
-    for (int rank = 0; rank < m_pool_size; ++rank) {
-      if (nullptr != m_pool[rank]) {
-        m_pool[rank]->disband_pool();
+  HostThreadTeamData *root = m_pool[0];
 
-        space.deallocate(m_pool[rank], old_alloc_bytes);
-      }
+  const size_t old_alloc_bytes =
+      root ? (member_bytes + root->scratch_bytes()) : 0;
+
+  const size_t alloc_bytes =
+      member_bytes +
+      HostThreadTeamData::scratch_size(pool_reduce_bytes, team_reduce_bytes,
+                                       team_shared_bytes, thread_local_bytes);
+
+  OpenMP::memory_space space;
 
-      void *ptr = nullptr;
-      try {
-        ptr = space.allocate(alloc_bytes);
-      } catch (
-          Kokkos::Experimental::RawMemoryAllocationFailure const &failure) {
-        // For now, just rethrow the error message the existing way
-        Kokkos::Impl::throw_runtime_exception(failure.get_error_message());
+  memory_fence();
+
+  std::vector<char *> buffers(m_pool_size, nullptr);
+  for (int rank = 0; rank < m_pool_size; ++rank) {
+    if (nullptr != m_pool[rank]) {
+      m_pool[rank]->disband_pool();
+
+      space.deallocate(m_pool[rank], old_alloc_bytes);
+
+      m_pool[rank] = nullptr;
+    }
+
+    try {
+      buffers[rank] = static_cast<char *>(space.allocate(alloc_bytes));
+    } catch (Kokkos::Experimental::RawMemoryAllocationFailure const &failure) {
+      for (char *buffer : buffers) {
+        if (buffer) space.deallocate(buffer, alloc_bytes);
       }
+      // For now, just rethrow the error message the existing way
+      Kokkos::Impl::throw_runtime_exception(failure.get_error_message());
+    }
+  }
+
+  // Allocating is left to the calling thread, the threads only touch their
+  // own data first so that it is local to their NUMA domain. The OpenMP
+  // runtime keeps the threads of parallel regions of the same size.
+  int const pool_size = m_pool_size;
+#pragma omp parallel num_threads(pool_size)
+  {
+    for (int rank = omp_get_thread_num(); rank < pool_size;
+         rank += omp_get_num_threads()) {
+      char *const ptr = buffers[rank];
+
+      std::memset(ptr, 0, alloc_bytes);
 
       m_pool[rank] = new (ptr) HostThreadTeamData();
 
-      m_pool[rank]->scratch_assign(((char *)ptr) + member_bytes, alloc_bytes,
+      m_pool[rank]->scratch_assign(ptr + member_bytes, alloc_bytes,
                                    pool_reduce_bytes, team_reduce_bytes,
                                    team_shared_bytes, thread_local_bytes);
     }
+  }
+
+  HostThreadTeamData::organize_pool(m_pool, m_pool_size);
+}
+
+void OpenMPInternal::reserve_team_scratch(size_t level0_bytes,
+                                          size_t level1_bytes) {
+  acquire_lock();
+
+  m_reserved_team_shared = std::max(m_reserved_team_shared, level0_bytes);
+
+  // Covers the team reductions of teams as large as the pool
+  resize_thread_data(0, TEAM_REDUCE_SIZE * m_pool_size, m_reserved_team_shared,
+                     0);
+
+  // Covers level 1 scratch of teams of one thread
+  m_level1_scratch.reserve(level1_bytes, m_pool_size);
 
-    HostThreadTeamData::organize_pool(m_pool, m_pool_size);
+  release_lock();
+}
+
+void OpenMPInternal::shrink_team_scratch() {
+  acquire_lock();
+
+  HostThreadTeamData *root = m_pool[0];
+  if (root && m_reserved_team_shared < root->team_shared_bytes()) {
+    allocate_thread_data(root->pool_reduce_bytes(), root->team_reduce_bytes(),
+                         m_reserved_team_shared, root->thread_local_bytes());
   }
+  m_level1_scratch.shrink();
+
+  release_lock();
 }
 
 OpenMPInternal &OpenMPInternal::singleton() {
   static OpenMPInternal *self = nullptr;
   if (self == nullptr) {
-    self = new OpenMPInternal(get_current_max_threads());
+    // The pool size is set by initialize, querying it here would start the
+    // threads of the OpenMP runtime.
+    self = new OpenMPInternal(g_openmp_hardware_max_threads);
   }
 
   return *self;
@@ -229,7 +308,8 @@ int OpenMPInternal::get_current_max_threads() noexcept {
   return count;
 }
 
-void OpenMPInternal::initialize(int thread_count) {
+void OpenMPInternal::initialize(int thread_count, HostThreadBinding binding,
+                                bool lazy) {
   if (m_initialized) {
     Kokkos::abort(
         "Calling OpenMP::initialize after OpenMP::finalize is illegal\n");
@@ -241,7 +321,19 @@ void OpenMPInternal::initialize(int thread_count) {
   }
 
   {
-    if (Kokkos::show_warnings() && !std::getenv("OMP_PROC_BIND")) {
+    // OMP_PROC_BIND takes precedence over the native binding
+    if (binding != HostThreadBinding::none && std::getenv("OMP_PROC_BIND")) {
+      if (Kokkos::show_warnings()) {
+        std::cerr << "Kokkos::OpenMP::initialize WARNING: ignoring "
+                     "--kokkos-bind-threads="
+                  << to_string(binding) << ", OMP_PROC_BIND is set"
+                  << std::endl;
+      }
+      binding = HostThreadBinding::none;
+    }
+
+    if (Kokkos::show_warnings() && !std::getenv("OMP_PROC_BIND") &&
+        binding == HostThreadBinding::none) {
       std::cerr
           << R"WARNING(Kokkos::OpenMP::initialize WARNING: OMP_PROC_BIND environment variable not set
   In general, for best performance with OpenMP 4.0 or better set OMP_PROC_BIND=spread and OMP_PLACES=threads
@@ -257,9 +349,11 @@ void OpenMPInternal::initialize(int thread_count) {
     }
 
     // Before any other call to OMP query the maximum number of threads
-    // and save the value for re-initialization unit testing.
+    // and save the value for re-initialization unit testing. A lazy
+    // initialization does not open a parallel region to count them.
 
-    Impl::g_openmp_hardware_max_threads = get_current_max_threads();
+    Impl::g_openmp_hardware_max_threads =
+        lazy ? omp_get_max_threads() : get_current_max_threads();
 
     int process_num_threads = Impl::g_openmp_hardware_max_threads;
 
@@ -293,15 +387,20 @@ void OpenMPInternal::initialize(int thread_count) {
       omp_set_num_threads(Impl::g_openmp_hardware_max_threads);
     }
 
-// setup thread local
-#pragma omp parallel num_threads(Impl::g_openmp_hardware_max_threads)
-    { Impl::SharedAllocationRecord<void, void>::tracking_enable(); }
-
     auto &instance       = OpenMPInternal::singleton();
     instance.m_pool_size = Impl::g_openmp_hardware_max_threads;
 
-    // New, unified host thread team data:
-    {
+    if (lazy) {
+      // The kernels allocate the thread data they need
+      std::lock_guard<std::mutex> lock(g_deferred_start_mutex);
+      g_deferred_start = [binding]() {
+        OpenMPInternal::singleton().start_thread_pool(binding);
+      };
+      g_thread_pool_deferred.store(true, std::memory_order_release);
+    } else {
+      instance.start_thread_pool(binding);
+
+      // New, unified host thread team data:
       size_t pool_reduce_bytes  = 32 * thread_count;
       size_t team_reduce_bytes  = 32 * thread_count;
       size_t team_shared_bytes  = 1024 * thread_count;
@@ -332,6 +431,39 @@ void OpenMPInternal::initialize(int thread_count) {
   m_initialized = true;
 }
 
+void OpenMPInternal::start_thread_pool(HostThreadBinding binding) {
+  // Only read the topology when binding, it takes a few files per CPU.
+  // The OpenMP runtime keeps its worker threads alive between parallel
+  // regions of the same size, so pinning them once here sticks.
+  std::vector<int> placement;
+  if (binding != HostThreadBinding::none) {
+    placement = host_thread_placement(host_topology(), binding,
+                                      Impl::g_openmp_hardware_max_threads);
+  }
+
+// setup thread local
+#pragma omp parallel num_threads(Impl::g_openmp_hardware_max_threads)
+  {
+    Impl::SharedAllocationRecord<void, void>::tracking_enable();
+    if (!placement.empty()) {
+      bind_this_thread_to_cpu(placement[omp_get_thread_num()]);
+    }
+  }
+
+  m_binding = placement.empty() ? HostThreadBinding::none : binding;
+}
+
+void OpenMPInternal::start_deferred_thread_pool() {
+  if (!g_thread_pool_deferred.load(std::memory_order_acquire)) return;
+
+  std::lock_guard<std::mutex> lock(g_deferred_start_mutex);
+  if (!g_deferred_start) return;
+  Kokkos::Timer timer;
+  std::exchange(g_deferred_start, nullptr)();
+  g_thread_pool_deferred.store(false, std::memory_order_release);
+  record_startup_time("OpenMP thread pool", timer.seconds());
+}
+
 void OpenMPInternal::finalize() {
   if (omp_in_parallel()) {
     std::string msg("Kokkos::OpenMP::finalize ERROR ");
@@ -340,6 +472,10 @@ void OpenMPInternal::finalize() {
     Kokkos::Impl::throw_runtime_exception(msg);
   }
 
+  m_submission.reset();
+
+  m_level1_scratch.release();
+
   if (this == &singleton()) {
     auto const &instance = singleton();
     // Silence Cuda Warning
@@ -349,8 +485,24 @@ void OpenMPInternal::finalize() {
             : instance.m_pool_size;
     (void)nthreads;
 
-#pragma omp parallel num_threads(nthreads)
-    { Impl::SharedAllocationRecord<void, void>::tracking_disable(); }
+    const bool bound = instance.m_binding != HostThreadBinding::none;
+
+    // Without a kernel, a lazily initialized backend never started the
+    // threads of the OpenMP runtime
+    bool started = true;
+    {
+      std::lock_guard<std::mutex> lock(g_deferred_start_mutex);
+      started          = !g_deferred_start;
+      g_deferred_start = nullptr;
+      g_thread_pool_deferred.store(false, std::memory_order_release);
+    }
+
+#pragma omp parallel if (started) num_threads(nthreads)
+    {
+      Impl::SharedAllocationRecord<void, void>::tracking_disable();
+      if (bound) restore_this_thread_affinity();
+    }
+    m_binding = HostThreadBinding::none;
 
     // allow main thread to track
     Impl::SharedAllocationRecord<void, void>::tracking_enable();
@@ -363,6 +515,13 @@ void OpenMPInternal::finalize() {
   Kokkos::Profiling::finalize();
 }
 
+void OpenMPInternal::set_async_dispatch(bool enable) {
+  if (enable == static_cast<bool>(m_submission)) return;
+
+  // Destroying the queue waits for the kernels in it
+  m_submission = enable ? std::make_unique<HostSubmissionQueue>() : nullptr;
+}
+
 void OpenMPInternal::print_configuration(std::ostream &s) const {
   s << "Kokkos::OpenMP";
 
@@ -372,7 +531,14 @@ void OpenMPInternal::print_configuration(std::ostream &s) const {
     const int thread_per_core = 1;
 
     s << " thread_pool_topology[ " << numa_count << " x " << core_per_numa
-      << " x " << thread_per_core << " ]" << std::endl;
+      << " x " << thread_per_core << " ]";
+    if (m_binding != HostThreadBinding::none) {
+      s << " bind[ " << to_string(m_binding) << " ]";
+    }
+    if (g_thread_pool_deferred.load(std::memory_order_acquire)) {
+      s << " started_by_first_kernel";
+    }
+    s << std::endl;
   } else {
     s << " not initialized" << std::endl;
   }
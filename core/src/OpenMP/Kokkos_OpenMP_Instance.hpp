@@ -28,6 +28,9 @@
 
 #include <impl/Kokkos_Traits.hpp>
 #include <impl/Kokkos_HostThreadTeam.hpp>
+#include <impl/Kokkos_HostScratchArena.hpp>
+#include <impl/Kokkos_HostTopology.hpp>
+#include <impl/Kokkos_HostSubmissionQueue.hpp>
 
 #include <Kokkos_Atomic.hpp>
 
@@ -35,6 +38,8 @@
 
 #include <omp.h>
 
+#include <algorithm>
+#include <memory>
 #include <mutex>
 #include <numeric>
 #include <type_traits>
@@ -44,17 +49,6 @@
 namespace Kokkos {
 namespace Impl {
 
-inline bool execute_in_serial(OpenMP const& space = OpenMP()) {
-  return (OpenMP::in_parallel(space) &&
-          !(omp_get_nested() && (omp_get_level() == 1)));
-}
-
-}  // namespace Impl
-}  // namespace Kokkos
-
-namespace Kokkos {
-namespace Impl {
-
 class OpenMPInternal;
 
 inline int g_openmp_hardware_max_threads = 1;
@@ -68,7 +62,10 @@ class OpenMPInternal {
   OpenMPInternal(int arg_pool_size)
       : m_pool_size{arg_pool_size}, m_level{omp_get_level()}, m_pool() {}
 
-  ~OpenMPInternal() { clear_thread_data(); }
+  ~OpenMPInternal() {
+    m_submission.reset();
+    clear_thread_data();
+  }
 
   static int get_current_max_threads() noexcept;
 
@@ -78,14 +75,29 @@ class OpenMPInternal {
   int m_level;
   int m_pool_mutex = 0;
 
+  HostThreadBinding m_binding = HostThreadBinding::none;
+
+  // Team scratch the thread data keeps when shrinking
+  size_t m_reserved_team_shared = 0;
+
   HostThreadTeamData* m_pool[OpenMPTraits::MAX_THREAD_COUNT];
 
+  HostScratchArena m_level1_scratch{"Kokkos::OpenMP::level1_scratch"};
+
+  std::shared_ptr<HostInstanceCompletion> m_completion =
+      std::make_shared<HostInstanceCompletion>();
+
+  std::unique_ptr<HostSubmissionQueue> m_submission;
+
  public:
   friend class Kokkos::OpenMP;
 
   static OpenMPInternal& singleton();
 
-  void initialize(int thread_cound);
+  // A lazy initialization leaves starting the threads to the first kernel
+  void initialize(int thread_cound,
+                  HostThreadBinding binding = HostThreadBinding::none,
+                  bool lazy                 = false);
 
   void finalize();
 
@@ -104,9 +116,27 @@ class OpenMPInternal {
                                       int& partition_size);
 #endif
 
+  // Grows the thread data to at least the given sizes, it never shrinks
   void resize_thread_data(size_t pool_reduce_bytes, size_t team_reduce_bytes,
                           size_t team_shared_bytes, size_t thread_local_bytes);
 
+  // Bytes of team reduction buffer per team member of the team kernels
+  static constexpr size_t TEAM_REDUCE_SIZE = 512;
+
+  // Grows the level 1 scratch arena to one slot of level1_bytes per team of
+  // team_size threads the pool runs concurrently
+  HostScratchArena& resize_level1_scratch(size_t level1_bytes, int team_size) {
+    m_level1_scratch.resize(level1_bytes,
+                            std::max(1, m_pool_size / std::max(1, team_size)));
+    return m_level1_scratch;
+  }
+
+  // Grows the team scratch and keeps it when shrinking
+  void reserve_team_scratch(size_t level0_bytes, size_t level1_bytes);
+
+  // Releases the team scratch beyond the reservation
+  void shrink_team_scratch();
+
   HostThreadTeamData* get_thread_data() const noexcept {
     return m_pool[m_level == omp_get_level() ? 0 : omp_get_thread_num()];
   }
@@ -120,6 +150,57 @@ class OpenMPInternal {
   bool verify_is_initialized(const char* const label) const;
 
   void print_configuration(std::ostream& s) const;
+
+  // Tracks the kernels launched on this instance
+  HostInstanceCompletion* completion() const noexcept {
+    return m_completion.get();
+  }
+
+  // The queue of the kernels, if dispatched asynchronously
+  HostSubmissionQueue* submission_queue() const noexcept {
+    return m_submission.get();
+  }
+
+  void set_async_dispatch(bool enable);
+
+  // Starts the threads of a lazily initialized backend unless done already,
+  // kernels call it before opening their parallel region
+  static void start_deferred_thread_pool();
+
+ private:
+  void start_thread_pool(HostThreadBinding binding);
+
+  // Reallocates the thread data, every thread touches its own data first
+  void allocate_thread_data(size_t pool_reduce_bytes, size_t team_reduce_bytes,
+                            size_t team_shared_bytes,
+                            size_t thread_local_bytes);
+};
+
+inline bool execute_in_serial(OpenMP const& space = OpenMP()) {
+  OpenMPInternal::start_deferred_thread_pool();
+  return (OpenMP::in_parallel(space) &&
+          !(omp_get_nested() && (omp_get_level() == 1)));
+}
+
+template <>
+struct ExecSpaceCompletion<Kokkos::OpenMP> {
+  static HostInstanceCompletion* get(Kokkos::OpenMP const& exec) noexcept {
+    return exec.impl_internal_space_instance()->completion();
+  }
+};
+
+template <>
+struct ExecSpaceSubmission<Kokkos::OpenMP> {
+  static constexpr bool may_be_asynchronous = true;
+
+  static HostSubmissionQueue* get(Kokkos::OpenMP const& exec) noexcept {
+    HostSubmissionQueue* const queue =
+        exec.impl_internal_space_instance()->submission_queue();
+    // Kernels launched by a running kernel of the instance run nested
+    return queue && !queue->is_worker_thread() && !OpenMP::in_parallel(exec)
+               ? queue
+               : nullptr;
+  }
 };
 
 }  // namespace Impl
@@ -201,6 +282,26 @@ std::vector<OpenMP> partition_space(OpenMP const& main_instance,
                                     std::vector<T> const& weights) {
   return Impl::create_OpenMP_instances(main_instance, weights);
 }
+
+/// \brief Makes kernel launches on the instance return right away.
+///
+/// The kernels are run in launch order by a worker thread of the instance,
+/// which opens the OpenMP parallel regions, and fencing the instance waits
+/// for them. Must not be called while kernels are launched on the instance.
+void set_async_dispatch(OpenMP const& instance, bool enable);
+
+/// \brief Reserves the scratch memory of team kernels on the instance.
+///
+/// The sizes are per team, as TeamPolicy::scratch_size returns them. Level 1
+/// scratch is reserved for as many teams as the instance has threads. Team
+/// kernels whose level 0 and level 1 scratch fit in the reservation do not
+/// allocate when they are launched.
+void reserve_team_scratch(OpenMP const& instance, size_t level0_bytes,
+                          size_t level1_bytes);
+
+/// \brief Releases the team scratch memory that kernels grew beyond the
+/// reservation, e.g. when the instance becomes idle. Fences the instance.
+void shrink_team_scratch(OpenMP const& instance);
 }  // namespace Experimental
 
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_3
@@ -221,6 +322,8 @@ KOKKOS_DEPRECATED void OpenMP::partition_master(F const& f, int num_partitions,
 
     OpenMP::memory_space space;
 
+    Impl::OpenMPInternal::start_deferred_thread_pool();
+
 #pragma omp parallel num_threads(num_partitions)
     {
       Exec thread_local_instance(partition_size);
@@ -79,11 +79,14 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
   execute_parallel() const {
     // prevent bug in NVHPC 21.9/CUDA 11.4 (entering zero iterations loop)
     if (m_policy.begin() >= m_policy.end()) return;
-#pragma omp parallel for schedule(dynamic KOKKOS_OPENMP_OPTIONAL_CHUNK_SIZE) \
-    num_threads(m_instance->thread_pool_size())
-    KOKKOS_PRAGMA_IVDEP_IF_ENABLED
-    for (auto iwork = m_policy.begin(); iwork < m_policy.end(); ++iwork) {
-      exec_work(m_functor, iwork);
+#pragma omp parallel num_threads(m_instance->thread_pool_size())
+    {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
+#pragma omp for schedule(dynamic KOKKOS_OPENMP_OPTIONAL_CHUNK_SIZE)
+      KOKKOS_PRAGMA_IVDEP_IF_ENABLED
+      for (auto iwork = m_policy.begin(); iwork < m_policy.end(); ++iwork) {
+        exec_work(m_functor, iwork);
+      }
     }
   }
 
@@ -91,24 +94,27 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
   std::enable_if_t<!std::is_same<typename Policy::schedule_type::type,
                                  Kokkos::Dynamic>::value>
   execute_parallel() const {
+#pragma omp parallel num_threads(m_instance->thread_pool_size())
+    {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
 // Specifying an chunksize with GCC compiler leads to performance regression
 // with static schedule.
 #ifdef KOKKOS_COMPILER_GNU
-#pragma omp parallel for schedule(static) \
-    num_threads(m_instance->thread_pool_size())
+#pragma omp for schedule(static)
 #else
-#pragma omp parallel for schedule(static KOKKOS_OPENMP_OPTIONAL_CHUNK_SIZE) \
-    num_threads(m_instance->thread_pool_size())
+#pragma omp for schedule(static KOKKOS_OPENMP_OPTIONAL_CHUNK_SIZE)
 #endif
-    KOKKOS_PRAGMA_IVDEP_IF_ENABLED
-    for (auto iwork = m_policy.begin(); iwork < m_policy.end(); ++iwork) {
-      exec_work(m_functor, iwork);
+      KOKKOS_PRAGMA_IVDEP_IF_ENABLED
+      for (auto iwork = m_policy.begin(); iwork < m_policy.end(); ++iwork) {
+        exec_work(m_functor, iwork);
+      }
     }
   }
 
  public:
   inline void execute() const {
     if (execute_in_serial(m_policy.space())) {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       exec_range(m_functor, m_policy.begin(), m_policy.end());
       return;
     }
@@ -121,6 +127,7 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::OpenMP> {
                      Kokkos::Dynamic>::value;
 #pragma omp parallel num_threads(m_instance->thread_pool_size())
     {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
       data.set_work_partition(m_policy.end() - m_policy.begin(),
@@ -188,11 +195,14 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
   typename std::enable_if_t<std::is_same<typename Policy::schedule_type::type,
                                          Kokkos::Dynamic>::value>
   execute_parallel() const {
-#pragma omp parallel for schedule(dynamic, 1) \
-    num_threads(m_instance->thread_pool_size())
-    KOKKOS_PRAGMA_IVDEP_IF_ENABLED
-    for (index_type iwork = 0; iwork < m_iter.m_rp.m_num_tiles; ++iwork) {
-      m_iter(iwork);
+#pragma omp parallel num_threads(m_instance->thread_pool_size())
+    {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
+#pragma omp for schedule(dynamic, 1)
+      KOKKOS_PRAGMA_IVDEP_IF_ENABLED
+      for (index_type iwork = 0; iwork < m_iter.m_rp.m_num_tiles; ++iwork) {
+        m_iter(iwork);
+      }
     }
   }
 
@@ -200,11 +210,14 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
   typename std::enable_if<!std::is_same<typename Policy::schedule_type::type,
                                         Kokkos::Dynamic>::value>::type
   execute_parallel() const {
-#pragma omp parallel for schedule(static, 1) \
-    num_threads(m_instance->thread_pool_size())
-    KOKKOS_PRAGMA_IVDEP_IF_ENABLED
-    for (index_type iwork = 0; iwork < m_iter.m_rp.m_num_tiles; ++iwork) {
-      m_iter(iwork);
+#pragma omp parallel num_threads(m_instance->thread_pool_size())
+    {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
+#pragma omp for schedule(static, 1)
+      KOKKOS_PRAGMA_IVDEP_IF_ENABLED
+      for (index_type iwork = 0; iwork < m_iter.m_rp.m_num_tiles; ++iwork) {
+        m_iter(iwork);
+      }
     }
   }
 
@@ -212,6 +225,7 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
   inline void execute() const {
 #ifndef KOKKOS_COMPILER_INTEL
     if (execute_in_serial(m_iter.m_rp.space())) {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       exec_range(0, m_iter.m_rp.m_num_tiles);
       return;
     }
@@ -226,6 +240,7 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
 
 #pragma omp parallel num_threads(m_instance->thread_pool_size())
     {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
       data.set_work_partition(m_iter.m_rp.m_num_tiles, 1);
@@ -288,7 +303,7 @@ template <class FunctorType, class... Properties>
 class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
                   Kokkos::OpenMP> {
  private:
-  enum { TEAM_REDUCE_SIZE = 512 };
+  enum { TEAM_REDUCE_SIZE = OpenMPInternal::TEAM_REDUCE_SIZE };
 
   using Policy =
       Kokkos::Impl::TeamPolicyInternal<Kokkos::OpenMP, Properties...>;
@@ -353,10 +368,18 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
     m_instance->resize_thread_data(pool_reduce_size, team_reduce_size,
                                    team_shared_size, thread_local_size);
 
+    HostScratchArena const& level1_scratch = m_instance->resize_level1_scratch(
+        m_policy.scratch_size(1), m_policy.team_size());
+
     if (execute_in_serial(m_policy.space())) {
-      ParallelFor::template exec_team<WorkTag>(
-          m_functor, *(m_instance->get_thread_data()), 0,
-          m_policy.league_size(), m_policy.league_size());
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
+      HostThreadTeamData& data = *(m_instance->get_thread_data());
+      data.level1_scratch_assign(level1_scratch.slot(0),
+                                 level1_scratch.slot_size());
+      ParallelFor::template exec_team<WorkTag>(m_functor, data, 0,
+                                               m_policy.league_size(),
+                                               m_policy.league_size());
+      data.level1_scratch_assign(nullptr, 0);
 
       m_instance->release_lock();
 
@@ -365,11 +388,14 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
 #pragma omp parallel num_threads(m_instance->thread_pool_size())
     {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
       const int active = data.organize_team(m_policy.team_size());
 
       if (active) {
+        data.level1_scratch_assign(level1_scratch.slot(data.team_index()),
+                                   level1_scratch.slot_size());
         data.set_work_partition(
             m_policy.league_size(),
             (0 < m_policy.chunk_size() ? m_policy.chunk_size()
@@ -406,7 +432,7 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
       : m_instance(nullptr),
         m_functor(arg_functor),
         m_policy(arg_policy),
-        m_shmem_size(arg_policy.scratch_size(0) + arg_policy.scratch_size(1) +
+        m_shmem_size(arg_policy.scratch_size(0) +
                      FunctorTeamShmemSize<FunctorType>::value(
                          arg_functor, arg_policy.team_size())) {
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_3
@@ -93,6 +93,7 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
     );
 
     if (execute_in_serial(m_policy.space())) {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       const pointer_type ptr =
           m_result_ptr
               ? m_result_ptr
@@ -111,6 +112,7 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
     const int pool_size = m_instance->thread_pool_size();
 #pragma omp parallel num_threads(pool_size)
     {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
       data.set_work_partition(m_policy.end() - m_policy.begin(),
@@ -237,6 +239,7 @@ class ParallelReduce<CombinedFunctorReducerType,
 
 #ifndef KOKKOS_COMPILER_INTEL
     if (execute_in_serial(m_iter.m_rp.space())) {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       const pointer_type ptr =
           m_result_ptr
               ? m_result_ptr
@@ -263,6 +266,7 @@ class ParallelReduce<CombinedFunctorReducerType,
     const int pool_size = m_instance->thread_pool_size();
 #pragma omp parallel num_threads(pool_size)
     {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
       data.set_work_partition(m_iter.m_rp.m_num_tiles, 1);
@@ -353,7 +357,7 @@ template <class CombinedFunctorReducerType, class... Properties>
 class ParallelReduce<CombinedFunctorReducerType,
                      Kokkos::TeamPolicy<Properties...>, Kokkos::OpenMP> {
  private:
-  enum { TEAM_REDUCE_SIZE = 512 };
+  enum { TEAM_REDUCE_SIZE = OpenMPInternal::TEAM_REDUCE_SIZE };
 
   using Policy =
       Kokkos::Impl::TeamPolicyInternal<Kokkos::OpenMP, Properties...>;
@@ -428,7 +432,7 @@ class ParallelReduce<CombinedFunctorReducerType,
     const size_t pool_reduce_size = reducer.value_size();
 
     const size_t team_reduce_size  = TEAM_REDUCE_SIZE * m_policy.team_size();
-    const size_t team_shared_size  = m_shmem_size + m_policy.scratch_size(1);
+    const size_t team_shared_size  = m_shmem_size;
     const size_t thread_local_size = 0;  // Never shrinks
 
     m_instance->acquire_lock();
@@ -436,8 +440,14 @@ class ParallelReduce<CombinedFunctorReducerType,
     m_instance->resize_thread_data(pool_reduce_size, team_reduce_size,
                                    team_shared_size, thread_local_size);
 
+    HostScratchArena const& level1_scratch = m_instance->resize_level1_scratch(
+        m_policy.scratch_size(1), m_policy.team_size());
+
     if (execute_in_serial(m_policy.space())) {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       HostThreadTeamData& data = *(m_instance->get_thread_data());
+      data.level1_scratch_assign(level1_scratch.slot(0),
+                                 level1_scratch.slot_size());
       pointer_type ptr =
           m_result_ptr ? m_result_ptr : pointer_type(data.pool_reduce_local());
       reference_type update       = reducer.init(ptr);
@@ -446,6 +456,7 @@ class ParallelReduce<CombinedFunctorReducerType,
       ParallelReduce::template exec_team<WorkTag>(
           m_functor_reducer.get_functor(), data, update, league_rank_begin,
           league_rank_end, m_policy.league_size());
+      data.level1_scratch_assign(nullptr, 0);
 
       reducer.final(ptr);
 
@@ -457,11 +468,14 @@ class ParallelReduce<CombinedFunctorReducerType,
     const int pool_size = m_instance->thread_pool_size();
 #pragma omp parallel num_threads(pool_size)
     {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       HostThreadTeamData& data = *(m_instance->get_thread_data());
 
       const int active = data.organize_team(m_policy.team_size());
 
       if (active) {
+        data.level1_scratch_assign(level1_scratch.slot(data.team_index()),
+                                   level1_scratch.slot_size());
         data.set_work_partition(
             m_policy.league_size(),
             (0 < m_policy.chunk_size() ? m_policy.chunk_size()
@@ -540,7 +554,7 @@ class ParallelReduce<CombinedFunctorReducerType,
         m_policy(arg_policy),
         m_result_ptr(arg_result.data()),
         m_shmem_size(
-            arg_policy.scratch_size(0) + arg_policy.scratch_size(1) +
+            arg_policy.scratch_size(0) +
             FunctorTeamShmemSize<FunctorType>::value(
                 arg_functor_reducer.get_functor(), arg_policy.team_size())) {
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_3
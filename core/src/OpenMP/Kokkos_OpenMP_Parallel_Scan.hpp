@@ -78,6 +78,7 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
     );
 
     if (execute_in_serial(m_policy.space())) {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       typename Analysis::Reducer final_reducer(m_functor);
 
       reference_type update = final_reducer.init(
@@ -91,6 +92,7 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
 
 #pragma omp parallel num_threads(m_instance->thread_pool_size())
     {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       HostThreadTeamData& data = *(m_instance->get_thread_data());
       typename Analysis::Reducer final_reducer(m_functor);
 
@@ -211,6 +213,7 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
     );
 
     if (execute_in_serial(m_policy.space())) {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       typename Analysis::Reducer final_reducer(m_functor);
 
       reference_type update = final_reducer.init(
@@ -228,6 +231,7 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
 
 #pragma omp parallel num_threads(m_instance->thread_pool_size())
     {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       HostThreadTeamData& data = *(m_instance->get_thread_data());
       typename Analysis::Reducer final_reducer(m_functor);
 
@@ -73,6 +73,7 @@ class TaskQueueSpecialization<SimpleTaskScheduler<Kokkos::OpenMP, QueueType>> {
         execution_space().impl_internal_space_instance();
     const int pool_size = get_max_team_count(scheduler.get_execution_space());
 
+    Impl::OpenMPInternal::start_deferred_thread_pool();
     instance->acquire_lock();
 
     // TODO @tasking @new_feature DSH allow team sizes other than 1
@@ -238,6 +239,7 @@ class TaskQueueSpecializationConstrained<
         execution_space().impl_internal_space_instance();
     const int pool_size = instance->thread_pool_size();
 
+    Impl::OpenMPInternal::start_deferred_thread_pool();
     instance->acquire_lock();
 
     const int team_size = 1;       // Threads per core
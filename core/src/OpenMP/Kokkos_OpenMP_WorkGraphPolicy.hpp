@@ -51,8 +51,10 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
     // from HIP
     OpenMP exec;
     [[maybe_unused]] int pool_size = exec.impl_thread_pool_size();
+    Impl::OpenMPInternal::start_deferred_thread_pool();
 #pragma omp parallel num_threads(pool_size)
     {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
       // Spin until COMPLETED_TOKEN.
       // END_TOKEN indicates no work is currently available.
 
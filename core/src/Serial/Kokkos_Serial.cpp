@@ -26,6 +26,7 @@
 #include <impl/Kokkos_ExecSpaceManager.hpp>
 #include <impl/Kokkos_SharedAlloc.hpp>
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
 #include <sstream>
@@ -57,6 +58,8 @@ void SerialInternal::finalize() {
 
     m_thread_team_data.scratch_assign(nullptr, 0, 0, 0, 0, 0);
   }
+  m_level1_scratch.release();
+  m_thread_team_data.level1_scratch_assign(nullptr, 0);
 
   Kokkos::Profiling::finalize();
 
@@ -83,7 +86,6 @@ void SerialInternal::resize_thread_team_data(size_t pool_reduce_bytes,
   const size_t old_team_reduce  = m_thread_team_data.team_reduce_bytes();
   const size_t old_team_shared  = m_thread_team_data.team_shared_bytes();
   const size_t old_thread_local = m_thread_team_data.thread_local_bytes();
-  const size_t old_alloc_bytes  = m_thread_team_data.scratch_bytes();
 
   // Allocate if any of the old allocation is tool small:
 
@@ -93,17 +95,6 @@ void SerialInternal::resize_thread_team_data(size_t pool_reduce_bytes,
                         (old_thread_local < thread_local_bytes);
 
   if (allocate) {
-    Kokkos::HostSpace space;
-
-    if (old_alloc_bytes) {
-      m_thread_team_data.disband_team();
-      m_thread_team_data.disband_pool();
-
-      space.deallocate("Kokkos::Serial::scratch_mem",
-                       m_thread_team_data.scratch_buffer(),
-                       m_thread_team_data.scratch_bytes());
-    }
-
     if (pool_reduce_bytes < old_pool_reduce) {
       pool_reduce_bytes = old_pool_reduce;
     }
@@ -117,6 +108,27 @@ void SerialInternal::resize_thread_team_data(size_t pool_reduce_bytes,
       thread_local_bytes = old_thread_local;
     }
 
+    allocate_thread_team_data(pool_reduce_bytes, team_reduce_bytes,
+                              team_shared_bytes, thread_local_bytes);
+  }
+}
+
+void SerialInternal::allocate_thread_team_data(size_t pool_reduce_bytes,
+                                               size_t team_reduce_bytes,
+                                               size_t team_shared_bytes,
+                                               size_t thread_local_bytes) {
+  Kokkos::HostSpace space;
+
+  if (m_thread_team_data.scratch_bytes()) {
+    m_thread_team_data.disband_team();
+    m_thread_team_data.disband_pool();
+
+    space.deallocate("Kokkos::Serial::scratch_mem",
+                     m_thread_team_data.scratch_buffer(),
+                     m_thread_team_data.scratch_bytes());
+  }
+
+  {
     const size_t alloc_bytes =
         HostThreadTeamData::scratch_size(pool_reduce_bytes, team_reduce_bytes,
                                          team_shared_bytes, thread_local_bytes);
@@ -139,8 +151,51 @@ void SerialInternal::resize_thread_team_data(size_t pool_reduce_bytes,
     m_thread_team_data.organize_team(1);
   }
 }
+
+void SerialInternal::resize_level1_scratch(size_t level1_bytes) {
+  m_level1_scratch.resize(level1_bytes, 1);
+  m_thread_team_data.level1_scratch_assign(m_level1_scratch.slot(0),
+                                           m_level1_scratch.slot_size());
+}
+
+void SerialInternal::reserve_team_scratch(size_t level0_bytes,
+                                          size_t level1_bytes) {
+  std::lock_guard<std::mutex> lock(m_thread_team_data_mutex);
+  m_reserved_team_shared = std::max(m_reserved_team_shared, level0_bytes);
+  resize_thread_team_data(0, 0, m_reserved_team_shared, 0);
+  m_level1_scratch.reserve(level1_bytes, 1);
+}
+
+void SerialInternal::shrink_team_scratch() {
+  std::lock_guard<std::mutex> lock(m_thread_team_data_mutex);
+  if (m_reserved_team_shared < m_thread_team_data.team_shared_bytes()) {
+    allocate_thread_team_data(m_thread_team_data.pool_reduce_bytes(),
+                              m_thread_team_data.team_reduce_bytes(),
+                              m_reserved_team_shared,
+                              m_thread_team_data.thread_local_bytes());
+  }
+  m_level1_scratch.shrink();
+  m_thread_team_data.level1_scratch_assign(nullptr, 0);
+}
 }  // namespace Impl
 
+void Experimental::reserve_team_scratch(Serial const& instance,
+                                        size_t level0_bytes,
+                                        size_t level1_bytes) {
+  instance.fence(
+      "Kokkos::Experimental::reserve_team_scratch: fence before resizing "
+      "scratch");
+  instance.impl_internal_space_instance()->reserve_team_scratch(level0_bytes,
+                                                                level1_bytes);
+}
+
+void Experimental::shrink_team_scratch(Serial const& instance) {
+  instance.fence(
+      "Kokkos::Experimental::shrink_team_scratch: fence before releasing "
+      "scratch");
+  instance.impl_internal_space_instance()->shrink_team_scratch();
+}
+
 Serial::Serial()
     : m_space_instance(&Impl::SerialInternal::singleton(),
                        [](Impl::SerialInternal*) {}) {}
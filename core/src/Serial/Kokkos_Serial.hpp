@@ -39,6 +39,7 @@ static_assert(false,
 #include <Kokkos_ScratchSpace.hpp>
 #include <Kokkos_MemoryTraits.hpp>
 #include <impl/Kokkos_HostThreadTeam.hpp>
+#include <impl/Kokkos_HostScratchArena.hpp>
 #include <impl/Kokkos_FunctorAnalysis.hpp>
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_HostSharedPtr.hpp>
@@ -67,8 +68,28 @@ class SerialInternal {
                                size_t team_shared_bytes,
                                size_t thread_local_bytes);
 
+  // Grows the level 1 scratch arena to level1_bytes and assigns it to the
+  // team of the thread team data
+  void resize_level1_scratch(size_t level1_bytes);
+
+  // Keeps at least the given team scratch when shrinking
+  void reserve_team_scratch(size_t level0_bytes, size_t level1_bytes);
+
+  // Releases the team scratch beyond the reservation
+  void shrink_team_scratch();
+
   HostThreadTeamData m_thread_team_data;
   bool m_is_initialized = false;
+
+ private:
+  void allocate_thread_team_data(size_t pool_reduce_bytes,
+                                 size_t team_reduce_bytes,
+                                 size_t team_shared_bytes,
+                                 size_t thread_local_bytes);
+
+  size_t m_reserved_team_shared = 0;
+
+  HostScratchArena m_level1_scratch{"Kokkos::Serial::level1_scratch"};
 };
 }  // namespace Impl
 
@@ -254,6 +275,18 @@ std::vector<Serial> partition_space(const Serial&,
   return instances;
 }
 
+/// \brief Reserves the scratch memory of team kernels on the instance.
+///
+/// The sizes are per team, as TeamPolicy::scratch_size returns them. Team
+/// kernels whose level 0 and level 1 scratch fit in the reservation do not
+/// allocate when they are launched.
+void reserve_team_scratch(Serial const& instance, size_t level0_bytes,
+                          size_t level1_bytes);
+
+/// \brief Releases the team scratch memory that kernels grew beyond the
+/// reservation, e.g. when the instance becomes idle. Fences the instance.
+void shrink_team_scratch(Serial const& instance);
+
 }  // namespace Kokkos::Experimental
 
 #include <Serial/Kokkos_Serial_Parallel_Range.hpp>
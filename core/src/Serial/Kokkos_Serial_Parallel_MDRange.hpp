@@ -43,7 +43,10 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
   }
 
  public:
-  inline void execute() const { this->exec(); }
+  inline void execute() const {
+    Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
+    this->exec();
+  }
   template <typename Policy, typename Functor>
   static int max_tile_size_product(const Policy&, const Functor&) {
     /**
@@ -96,6 +99,7 @@ class ParallelReduce<CombinedFunctorReducerType,
     return 1024;
   }
   inline void execute() const {
+    Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
     const ReducerType& reducer     = m_iter.m_func.get_reducer();
     const size_t pool_reduce_size  = reducer.value_size();
     const size_t team_reduce_size  = 0;  // Never shrinks
@@ -49,6 +49,7 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>, Kokkos::Serial> {
 
  public:
   inline void execute() const {
+    Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
     this->template exec<typename Policy::work_tag>();
   }
 
@@ -96,6 +97,7 @@ class ParallelReduce<CombinedFunctorReducerType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
+    Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
     const size_t pool_reduce_size =
         m_functor_reducer.get_reducer().value_size();
     const size_t team_reduce_size  = 0;  // Never shrinks
@@ -180,6 +182,7 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
+    Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
     const typename Analysis::Reducer& final_reducer =
         m_functor_reducer.get_reducer();
     const size_t pool_reduce_size  = final_reducer.value_size();
@@ -247,6 +250,7 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() {
+    Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
     const size_t pool_reduce_size =
         m_functor_reducer.get_reducer().value_size();
     const size_t team_reduce_size  = 0;  // Never shrinks
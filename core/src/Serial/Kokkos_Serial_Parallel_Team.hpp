@@ -241,6 +241,7 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
  public:
   inline void execute() const {
+    Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
     const size_t pool_reduce_size  = 0;  // Never shrinks
     const size_t team_reduce_size  = TEAM_REDUCE_SIZE;
     const size_t team_shared_size  = m_shared;
@@ -253,6 +254,7 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
     internal_instance->resize_thread_team_data(
         pool_reduce_size, team_reduce_size, team_shared_size,
         thread_local_size);
+    internal_instance->resize_level1_scratch(m_policy.scratch_size(1));
 
     this->template exec<typename Policy::work_tag>(
         internal_instance->m_thread_team_data);
@@ -262,7 +264,7 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
       : m_functor(arg_functor),
         m_policy(arg_policy),
         m_league(arg_policy.league_size()),
-        m_shared(arg_policy.scratch_size(0) + arg_policy.scratch_size(1) +
+        m_shared(arg_policy.scratch_size(0) +
                  FunctorTeamShmemSize<FunctorType>::value(arg_functor, 1)) {}
 };
 
@@ -311,6 +313,7 @@ class ParallelReduce<CombinedFunctorReducerType,
 
  public:
   inline void execute() const {
+    Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
     const size_t pool_reduce_size =
         m_functor_reducer.get_reducer().value_size();
 
@@ -325,6 +328,7 @@ class ParallelReduce<CombinedFunctorReducerType,
     internal_instance->resize_thread_team_data(
         pool_reduce_size, team_reduce_size, team_shared_size,
         thread_local_size);
+    internal_instance->resize_level1_scratch(m_policy.scratch_size(1));
 
     pointer_type ptr =
         m_result_ptr
@@ -346,7 +350,7 @@ class ParallelReduce<CombinedFunctorReducerType,
         m_policy(arg_policy),
         m_league(arg_policy.league_size()),
         m_result_ptr(arg_result.data()),
-        m_shared(arg_policy.scratch_size(0) + arg_policy.scratch_size(1) +
+        m_shared(arg_policy.scratch_size(0) +
                  FunctorTeamShmemSize<FunctorType>::value(
                      m_functor_reducer.get_functor(), 1)) {
     static_assert(Kokkos::is_view<ViewType>::value,
@@ -44,6 +44,7 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
 
  public:
   inline void execute() const noexcept {
+    Kokkos::Impl::SharedAllocationDisableTrackingGuard untracked;
     // Spin until COMPLETED_TOKEN.
     // END_TOKEN indicates no work is currently available.
 
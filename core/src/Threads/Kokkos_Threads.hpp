@@ -29,18 +29,21 @@ static_assert(false,
 
 #include <cstddef>
 #include <iosfwd>
+#include <vector>
 #include <Kokkos_HostSpace.hpp>
 #include <Kokkos_ScratchSpace.hpp>
 #include <Kokkos_Layout.hpp>
 #include <Kokkos_MemoryTraits.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
 #include <impl/Kokkos_InitializationSettings.hpp>
+#include <impl/Kokkos_HostSharedPtr.hpp>
 
 /*--------------------------------------------------------------------------*/
 
 namespace Kokkos {
 namespace Impl {
 class ThreadsExec;
+class ThreadsInternal;
 enum class fence_is_static { yes, no };
 }  // namespace Impl
 }  // namespace Kokkos
@@ -71,6 +74,9 @@ class Threads {
   //! \name Static functions that all Kokkos devices must implement.
   //@{
 
+  /// \brief Default instance, running on the whole thread pool.
+  Threads();
+
   /// \brief True if and only if this method is being called in a
   ///   thread-parallel function.
   static int in_parallel();
@@ -91,7 +97,7 @@ class Threads {
 
   /** \brief  Return the maximum amount of concurrency.  */
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
-  static int concurrency();
+  static int concurrency(Threads const& = Threads());
 #else
   int concurrency() const;
 #endif
@@ -132,14 +138,30 @@ class Threads {
     return impl_thread_pool_rank();
   }
 
-  uint32_t impl_instance_id() const noexcept { return 1; }
+  uint32_t impl_instance_id() const noexcept;
+
+  Impl::ThreadsInternal* impl_internal_space_instance() const {
+    return m_space_instance.get();
+  }
 
   static const char* name();
   //@}
   //----------------------------------------
  private:
-  friend bool operator==(Threads const&, Threads const&) { return true; }
-  friend bool operator!=(Threads const&, Threads const&) { return false; }
+  friend class Impl::ThreadsInternal;
+
+  // Instance owning a subset of the thread pool, see partition_space
+  Threads(Impl::ThreadsInternal* partition);
+
+  Kokkos::Impl::HostSharedPtr<Impl::ThreadsInternal> m_space_instance;
+
+  friend bool operator==(Threads const& lhs, Threads const& rhs) {
+    return lhs.impl_internal_space_instance() ==
+           rhs.impl_internal_space_instance();
+  }
+  friend bool operator!=(Threads const& lhs, Threads const& rhs) {
+    return !(lhs == rhs);
+  }
 };
 
 namespace Tools {
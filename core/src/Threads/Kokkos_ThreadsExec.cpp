@@ -20,8 +20,11 @@
 
 #include <Kokkos_Macros.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <limits>
+#include <numeric>
 #include <utility>
 #include <iostream>
 #include <sstream>
@@ -32,6 +35,7 @@
 
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_CPUDiscovery.hpp>
+#include <impl/Kokkos_HostTopology.hpp>
 #include <impl/Kokkos_Tools.hpp>
 #include <impl/Kokkos_ExecSpaceManager.hpp>
 
@@ -67,14 +71,52 @@ ThreadsExec *s_threads_exec[ThreadsExec::MAX_THREAD_COUNT] = {nullptr};
 std::thread::id s_threads_pid[ThreadsExec::MAX_THREAD_COUNT];
 std::pair<unsigned, unsigned> s_threads_coord[ThreadsExec::MAX_THREAD_COUNT];
 
+// OS CPU each entry of 's_threads_exec' is pinned to when binding natively
+// (without hwloc), -1 if the entry is not pinned.
+int s_threads_cpu[ThreadsExec::MAX_THREAD_COUNT];
+HostThreadBinding s_threads_binding = HostThreadBinding::none;
+
 int s_thread_pool_size[3] = {0, 0, 0};
 
+// Spawns the thread pool of a lazily initialized backend, called by the
+// first kernel
+std::function<void()> s_deferred_spawn;
+
 unsigned s_current_reduce_size = 0;
 unsigned s_current_shared_size = 0;
 
 void (*volatile s_current_function)(ThreadsExec &, const void *);
 const void *volatile s_current_function_arg = nullptr;
 
+// Serializes handing pool threads to the thread pool or to a partition
+// instance, see ThreadsInternal.
+std::mutex s_threads_claim_mutex;
+
+// Partition member run by the calling thread, nullptr outside of partitions
+thread_local ThreadsExec *t_partition_exec = nullptr;
+
+// Wait until a pool thread is idle, i.e. neither runs a kernel of the thread
+// pool nor one of a partition instance.
+void wait_inactive(ThreadsExec &exec) {
+  while (ThreadsExec::Inactive != exec.state()) {
+    std::this_thread::yield();
+  }
+}
+
+// (NUMA node, core within the NUMA node) of an OS CPU
+std::pair<unsigned, unsigned> native_thread_coordinate(int cpu) {
+  auto const &topology = host_topology();
+  auto const *const pu = topology.find(cpu);
+  if (!pu) return {0, 0};
+  int first_core = pu->core;
+  for (auto const &other : topology.processing_units) {
+    if (other.numa_node == pu->numa_node) {
+      first_core = std::min(first_core, other.core);
+    }
+  }
+  return {pu->numa_node, pu->core - first_core};
+}
+
 struct Sentinel {
   ~Sentinel() {
     if (s_thread_pool_size[0] || s_thread_pool_size[1] ||
@@ -143,7 +185,25 @@ void ThreadsExec::driver() {
   ThreadsExec this_thread;
 
   while (ThreadsExec::Active == this_thread.m_pool_state) {
-    (*s_current_function)(this_thread, s_current_function_arg);
+    ThreadsExec *const member = this_thread.m_partition_exec;
+
+    if (member) {
+      // Lent to a partition instance, run one of its members
+      ThreadsInternal const &partition = *member->m_partition;
+      t_partition_exec                 = member;
+      {
+        SharedAllocationDisableTrackingGuard untracked;
+        (*partition.m_function)(*member, partition.m_function_arg);
+      }
+      t_partition_exec             = nullptr;
+      this_thread.m_partition_exec = nullptr;
+      member->m_pool_state         = ThreadsExec::Inactive;
+      memory_fence();
+    } else {
+      // View copies made by the functor are not reference counted
+      SharedAllocationDisableTrackingGuard untracked;
+      (*s_current_function)(this_thread, s_current_function_arg);
+    }
 
     // Deactivate thread and wait for reactivation
     this_thread.m_pool_state = ThreadsExec::Inactive;
@@ -162,7 +222,9 @@ ThreadsExec::ThreadsExec()
       m_pool_rank(0),
       m_pool_size(0),
       m_pool_fan_size(0),
-      m_pool_state(ThreadsExec::Terminating) {
+      m_pool_state(ThreadsExec::Terminating),
+      m_partition(nullptr),
+      m_partition_exec(nullptr) {
   if (&s_threads_process != this) {
     // A spawned thread
 
@@ -178,9 +240,14 @@ ThreadsExec::ThreadsExec()
     // Given a good entry set this thread in the 's_threads_exec' array
     if (entry < s_thread_pool_size[0] &&
         nil == atomic_compare_exchange(s_threads_exec + entry, nil, this)) {
-      const std::pair<unsigned, unsigned> coord =
+      std::pair<unsigned, unsigned> coord =
           Kokkos::hwloc::get_this_thread_coordinate();
 
+      if (0 <= s_threads_cpu[entry] &&
+          bind_this_thread_to_cpu(s_threads_cpu[entry])) {
+        coord = native_thread_coordinate(s_threads_cpu[entry]);
+      }
+
       m_numa_rank      = coord.first;
       m_numa_core_rank = coord.second;
       m_pool_base      = s_threads_exec;
@@ -208,6 +275,22 @@ ThreadsExec::ThreadsExec()
   }
 }
 
+ThreadsExec::ThreadsExec(ThreadsInternal &partition, const ThreadsExec &home,
+                         int entry, int size)
+    : m_pool_base(partition.m_pool_base.data()),
+      m_scratch(nullptr),
+      m_scratch_reduce_end(0),
+      m_scratch_thread_end(0),
+      m_numa_rank(home.m_numa_rank),
+      m_numa_core_rank(home.m_numa_core_rank),
+      m_pool_rank(size - (entry + 1)),
+      m_pool_rank_rev(entry),
+      m_pool_size(size),
+      m_pool_fan_size(fan_size(m_pool_rank, size)),
+      m_pool_state(ThreadsExec::Inactive),
+      m_partition(&partition),
+      m_partition_exec(nullptr) {}
+
 ThreadsExec::~ThreadsExec() {
   const unsigned entry = m_pool_size - (m_pool_rank + 1);
 
@@ -232,7 +315,7 @@ ThreadsExec::~ThreadsExec() {
 
   m_pool_state = ThreadsExec::Terminating;
 
-  if (&s_threads_process != this && entry < MAX_THREAD_COUNT) {
+  if (&s_threads_process != this && !m_partition && entry < MAX_THREAD_COUNT) {
     ThreadsExec *const nil = nullptr;
 
     atomic_compare_exchange(s_threads_exec + entry, this, nil);
@@ -244,6 +327,8 @@ ThreadsExec::~ThreadsExec() {
 int ThreadsExec::get_thread_count() { return s_thread_pool_size[0]; }
 
 ThreadsExec *ThreadsExec::get_thread(const int init_thread_rank) {
+  spawn_deferred_thread_pool();
+
   ThreadsExec *const th =
       init_thread_rank < s_thread_pool_size[0]
           ? s_threads_exec[s_thread_pool_size[0] - (init_thread_rank + 1)]
@@ -311,8 +396,11 @@ int ThreadsExec::in_parallel() {
   // A thread function is in execution and
   // the function argument is not the special threads process argument and
   // the master process is a worker or is not the master process.
-  return s_current_function && (&s_threads_process != s_current_function_arg) &&
-         (s_threads_process.m_pool_base || !is_process());
+  // Or the calling thread runs a member of a partition instance.
+  return t_partition_exec ||
+         (s_current_function &&
+          (&s_threads_process != s_current_function_arg) &&
+          (s_threads_process.m_pool_base || !is_process()));
 }
 void ThreadsExec::fence() { internal_fence(Impl::fence_is_static::yes); }
 void ThreadsExec::fence(const std::string &name) {
@@ -330,12 +418,21 @@ void ThreadsExec::internal_fence(Impl::fence_is_static is_static) {
 void ThreadsExec::internal_fence(const std::string &name,
                                  Impl::fence_is_static is_static) {
   const auto &fence_lam = [&]() {
-    if (s_thread_pool_size[0]) {
+    if (is_static == Impl::fence_is_static::yes) {
+      HostSubmissionQueue::fence_all();
+    }
+
+    // Nothing runs before a lazily initialized thread pool is spawned
+    if (s_threads_exec[0]) {
       // Wait for the root thread to complete:
       Impl::spinwait_while_equal<int>(s_threads_exec[0]->m_pool_state,
                                       ThreadsExec::Active);
     }
 
+    // Only the process dispatches to the thread pool, other threads, e.g.
+    // ones using partition instances, must not reset the current function.
+    if (!is_process()) return;
+
     s_current_function     = nullptr;
     s_current_function_arg = nullptr;
 
@@ -360,12 +457,18 @@ void ThreadsExec::internal_fence(const std::string &name,
 void ThreadsExec::start(void (*func)(ThreadsExec &, const void *),
                         const void *arg) {
   verify_is_process("ThreadsExec::start", true);
+  spawn_deferred_thread_pool();
 
   if (s_current_function || s_current_function_arg) {
     Kokkos::Impl::throw_runtime_exception(
         std::string("ThreadsExec::start() FAILED : already executing"));
   }
 
+  // Wait for the threads lent to partition instances to be returned
+  for (int i = s_thread_pool_size[0]; 0 < i--;) {
+    wait_inactive(*s_threads_exec[i]);
+  }
+
   s_current_function     = func;
   s_current_function_arg = arg;
 
@@ -379,7 +482,10 @@ void ThreadsExec::start(void (*func)(ThreadsExec &, const void *),
 
   if (s_threads_process.m_pool_size) {
     // Master process is the root thread, run it:
-    (*func)(s_threads_process, arg);
+    {
+      SharedAllocationDisableTrackingGuard untracked;
+      (*func)(s_threads_process, arg);
+    }
     s_threads_process.m_pool_state = ThreadsExec::Inactive;
   }
 }
@@ -388,6 +494,7 @@ void ThreadsExec::start(void (*func)(ThreadsExec &, const void *),
 
 bool ThreadsExec::sleep() {
   verify_is_process("ThreadsExec::sleep", true);
+  spawn_deferred_thread_pool();
 
   if (&execute_sleep == s_current_function) return false;
 
@@ -395,11 +502,14 @@ bool ThreadsExec::sleep() {
 
   ThreadsExec::global_lock();
 
+  std::lock_guard<std::mutex> lock(s_threads_claim_mutex);
+
   s_current_function = &execute_sleep;
 
   // Activate threads:
   for (unsigned i = s_thread_pool_size[0]; 0 < i;) {
-    s_threads_exec[--i]->m_pool_state = ThreadsExec::Active;
+    wait_inactive(*s_threads_exec[--i]);
+    s_threads_exec[i]->m_pool_state = ThreadsExec::Active;
   }
 
   return true;
@@ -442,6 +552,8 @@ void ThreadsExec::execute_resize_scratch_in_serial() {
     }
   }
 
+  std::unique_lock<std::mutex> lock(s_threads_claim_mutex);
+
   s_current_function     = &first_touch_allocate_thread_private_scratch;
   s_current_function_arg = &s_threads_process;
 
@@ -451,6 +563,7 @@ void ThreadsExec::execute_resize_scratch_in_serial() {
   for (unsigned i = s_thread_pool_size[0]; begin < i;) {
     ThreadsExec &th = *s_threads_exec[--i];
 
+    wait_inactive(th);
     th.m_pool_state = ThreadsExec::Active;
 
     wait_yield(th.m_pool_state, ThreadsExec::Active);
@@ -462,6 +575,7 @@ void ThreadsExec::execute_resize_scratch_in_serial() {
     first_touch_allocate_thread_private_scratch(s_threads_process, nullptr);
     s_threads_process.m_pool_state = ThreadsExec::Inactive;
   }
+  lock.unlock();
 
   s_current_function_arg = nullptr;
   s_current_function     = nullptr;
@@ -505,9 +619,43 @@ void ThreadsExec::first_touch_allocate_thread_private_scratch(ThreadsExec &exec,
   }
 }
 
+void ThreadsExec::first_touch_allocate_partition_scratch(ThreadsExec &exec,
+                                                         const void *) {
+  using Record = Kokkos::Impl::SharedAllocationRecord<Kokkos::HostSpace, void>;
+
+  if (exec.m_scratch) {
+    Record *const r = Record::get_record(exec.m_scratch);
+    exec.m_scratch  = nullptr;
+    Record::decrement(r);
+  }
+
+  exec.m_scratch_reduce_end = exec.m_partition->m_scratch_reduce_end;
+  exec.m_scratch_thread_end = exec.m_partition->m_scratch_thread_end;
+
+  if (exec.m_scratch_thread_end) {
+    Record *const r =
+        Record::allocate(Kokkos::HostSpace(), "Kokkos::thread_scratch",
+                         exec.m_scratch_thread_end);
+
+    Record::increment(r);
+
+    exec.m_scratch = r->data();
+
+    unsigned *ptr = reinterpret_cast<unsigned *>(exec.m_scratch);
+
+    unsigned *const end = ptr + exec.m_scratch_thread_end / sizeof(unsigned);
+
+    // touch on this thread
+    while (ptr < end) *ptr++ = 0;
+  }
+
+  exec.fan_in();
+}
+
 void *ThreadsExec::resize_scratch(size_t reduce_size, size_t thread_size) {
   enum { ALIGN_MASK = Kokkos::Impl::MEMORY_ALIGNMENT - 1 };
 
+  spawn_deferred_thread_pool();
   fence();
 
   const size_t old_reduce_size = s_threads_process.m_scratch_reduce_end;
@@ -517,22 +665,47 @@ void *ThreadsExec::resize_scratch(size_t reduce_size, size_t thread_size) {
   reduce_size = (reduce_size + ALIGN_MASK) & ~ALIGN_MASK;
   thread_size = (thread_size + ALIGN_MASK) & ~ALIGN_MASK;
 
-  // Increase size or deallocate completely.
+  // Increase size or deallocate completely. Growing keeps the larger of the
+  // old and requested sizes, kernels alternating between reduction and team
+  // scratch would otherwise reallocate at every launch.
 
-  if ((old_reduce_size < reduce_size) || (old_thread_size < thread_size) ||
-      ((reduce_size == 0 && thread_size == 0) &&
-       (old_reduce_size != 0 || old_thread_size != 0))) {
-    verify_is_process("ThreadsExec::resize_scratch", true);
+  if ((old_reduce_size < reduce_size) || (old_thread_size < thread_size)) {
+    reallocate_scratch(std::max(reduce_size, old_reduce_size),
+                       std::max(thread_size, old_thread_size));
+  } else if ((reduce_size == 0 && thread_size == 0) &&
+             (old_reduce_size != 0 || old_thread_size != 0)) {
+    reallocate_scratch(0, 0);
+  }
+
+  return s_threads_process.m_scratch;
+}
+
+void ThreadsExec::shrink_scratch(size_t thread_size) {
+  enum { ALIGN_MASK = Kokkos::Impl::MEMORY_ALIGNMENT - 1 };
+
+  spawn_deferred_thread_pool();
+  fence();
 
-    s_threads_process.m_scratch_reduce_end = reduce_size;
-    s_threads_process.m_scratch_thread_end = reduce_size + thread_size;
+  const size_t old_reduce_size = s_threads_process.m_scratch_reduce_end;
+  const size_t old_thread_size = s_threads_process.m_scratch_thread_end -
+                                 s_threads_process.m_scratch_reduce_end;
 
-    execute_resize_scratch_in_serial();
+  thread_size = (thread_size + ALIGN_MASK) & ~ALIGN_MASK;
 
-    s_threads_process.m_scratch = s_threads_exec[0]->m_scratch;
+  if (thread_size < old_thread_size) {
+    reallocate_scratch(old_reduce_size, thread_size);
   }
+}
 
-  return s_threads_process.m_scratch;
+void ThreadsExec::reallocate_scratch(size_t reduce_size, size_t thread_size) {
+  verify_is_process("ThreadsExec::resize_scratch", true);
+
+  s_threads_process.m_scratch_reduce_end = reduce_size;
+  s_threads_process.m_scratch_thread_end = reduce_size + thread_size;
+
+  execute_resize_scratch_in_serial();
+
+  s_threads_process.m_scratch = s_threads_exec[0]->m_scratch;
 }
 
 //----------------------------------------------------------------------------
@@ -561,12 +734,20 @@ void ThreadsExec::print_configuration(std::ostream &s, const bool detail) {
   s << " hwloc[" << numa_count << "x" << cores_per_numa << "x"
     << threads_per_core << "]";
 #endif
+  if (s_threads_binding != HostThreadBinding::none) {
+    auto const &topology = host_topology();
+    s << " bind[" << to_string(s_threads_binding) << " "
+      << topology.num_numa_nodes << "x" << topology.num_cores << "x"
+      << topology.max_smt << "]";
+  }
 
   if (s_thread_pool_size[0]) {
     s << " threads[" << s_thread_pool_size[0] << "]"
       << " threads_per_numa[" << s_thread_pool_size[1] << "]"
       << " threads_per_core[" << s_thread_pool_size[2] << "]";
-    if (nullptr == s_threads_process.m_pool_base) {
+    if (s_deferred_spawn) {
+      s << " SpawnedByFirstKernel";
+    } else if (nullptr == s_threads_process.m_pool_base) {
       s << " Asynchronous";
     }
     s << " ReduceScratch[" << s_current_reduce_size << "]"
@@ -605,9 +786,10 @@ void ThreadsExec::print_configuration(std::ostream &s, const bool detail) {
 
 //----------------------------------------------------------------------------
 
-int ThreadsExec::is_initialized() { return nullptr != s_threads_exec[0]; }
+int ThreadsExec::is_initialized() { return 0 != s_thread_pool_size[0]; }
 
-void ThreadsExec::initialize(int thread_count_arg) {
+void ThreadsExec::initialize(int thread_count_arg, HostThreadBinding binding,
+                             bool lazy) {
   // legacy arguments
   unsigned thread_count       = thread_count_arg == -1 ? 0 : thread_count_arg;
   unsigned use_numa_count     = 0;
@@ -618,10 +800,14 @@ void ThreadsExec::initialize(int thread_count_arg) {
 
   const bool is_initialized = 0 != s_thread_pool_size[0];
 
-  unsigned thread_spawn_failed = 0;
+  // The calling thread is the process, also when the first kernel spawns the
+  // thread pool.
+  verify_is_process("Kokkos::Threads::initialize", false);
 
-  for (int i = 0; i < ThreadsExec::MAX_THREAD_COUNT; i++)
+  for (int i = 0; i < ThreadsExec::MAX_THREAD_COUNT; i++) {
     s_threads_exec[i] = nullptr;
+    s_threads_cpu[i]  = -1;
+  }
 
   if (!is_initialized) {
     // If thread_count, use_numa_count, or use_cores_per_numa are zero
@@ -640,6 +826,34 @@ void ThreadsExec::initialize(int thread_count_arg) {
                          : 1;
     }
 
+    // hwloc binding takes precedence over the native binding
+    if (hwloc_can_bind && binding != HostThreadBinding::none) {
+      if (Kokkos::show_warnings()) {
+        std::cerr << "Kokkos::Threads::initialize WARNING: ignoring "
+                     "--kokkos-bind-threads="
+                  << to_string(binding) << ", threads are bound by hwloc"
+                  << std::endl;
+      }
+      binding = HostThreadBinding::none;
+    }
+    if (binding != HostThreadBinding::none && thread_count_arg == -1 &&
+        !hwloc_avail) {
+      // Default to one thread per available processing unit
+      thread_count = std::max<std::size_t>(
+          1, std::min<std::size_t>(host_topology().processing_units.size(),
+                                   MAX_THREAD_COUNT));
+    }
+    s_threads_binding = HostThreadBinding::none;
+    // Only read the topology when binding, it takes a few files per CPU.
+    if (binding != HostThreadBinding::none) {
+      auto const placement =
+          host_thread_placement(host_topology(), binding, thread_count);
+      for (std::size_t i = 0; i < placement.size(); ++i) {
+        s_threads_cpu[i] = placement[i];
+      }
+      if (!placement.empty()) s_threads_binding = binding;
+    }
+
     const unsigned thread_spawn_begin = hwloc::thread_mapping(
         "Kokkos::Threads::initialize", allow_asynchronous_threadpool,
         thread_count, use_numa_count, use_cores_per_numa, s_threads_coord);
@@ -655,120 +869,143 @@ void ThreadsExec::initialize(int thread_count_arg) {
     s_thread_pool_size[0] = thread_count;
     s_thread_pool_size[1] = s_thread_pool_size[0] / use_numa_count;
     s_thread_pool_size[2] = s_thread_pool_size[1] / use_cores_per_numa;
-    s_current_function =
-        &execute_function_noop;  // Initialization work function
-
-    for (unsigned ith = thread_spawn_begin; ith < thread_count; ++ith) {
-      s_threads_process.m_pool_state = ThreadsExec::Inactive;
+    if (lazy) {
+      s_deferred_spawn = [=]() {
+        spawn_thread_pool(thread_spawn_begin, hwloc_can_bind, proc_coord);
+      };
+    } else {
+      spawn_thread_pool(thread_spawn_begin, hwloc_can_bind, proc_coord);
+    }
+  }
 
-      // If hwloc available then spawned thread will
-      // choose its own entry in 's_threads_coord'
-      // otherwise specify the entry.
-      s_current_function_arg =
-          reinterpret_cast<void *>(hwloc_can_bind ? ~0u : ith);
+  if (is_initialized) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Threads::initialize ERROR : already initialized");
+  }
 
-      // Make sure all outstanding memory writes are complete
-      // before spawning the new thread.
-      memory_fence();
+  // Check for over-subscription
+  auto const reported_ranks = mpi_ranks_per_node();
+  auto const mpi_local_size = reported_ranks < 0 ? 1 : reported_ranks;
+  int const procs_per_node  = std::thread::hardware_concurrency();
+  if (Kokkos::show_warnings() &&
+      (mpi_local_size * long(thread_count) > procs_per_node)) {
+    std::cerr << "Kokkos::Threads::initialize WARNING: You are likely "
+                 "oversubscribing your CPU cores."
+              << std::endl;
+    std::cerr << "                                    Detected: "
+              << procs_per_node << " cores per node." << std::endl;
+    std::cerr << "                                    Detected: "
+              << mpi_local_size << " MPI_ranks per node." << std::endl;
+    std::cerr << "                                    Requested: "
+              << thread_count << " threads per process." << std::endl;
+  }
 
-      // Spawn thread executing the 'driver()' function.
-      // Wait until spawned thread has attempted to initialize.
-      // If spawning and initialization is successful then
-      // an entry in 's_threads_exec' will be assigned.
-      ThreadsExec::spawn();
-      wait_yield(s_threads_process.m_pool_state, ThreadsExec::Inactive);
-      if (s_threads_process.m_pool_state == ThreadsExec::Terminating) break;
-    }
+  Impl::SharedAllocationRecord<void, void>::tracking_enable();
+}
 
-    // Wait for all spawned threads to deactivate before zeroing the function.
+void ThreadsExec::spawn_thread_pool(
+    const unsigned thread_spawn_begin, const bool hwloc_can_bind,
+    const std::pair<unsigned, unsigned> proc_coord) {
+  const unsigned thread_count  = s_thread_pool_size[0];
+  unsigned thread_spawn_failed = 0;
 
-    for (unsigned ith = thread_spawn_begin; ith < thread_count; ++ith) {
-      // Try to protect against cache coherency failure by casting to volatile.
-      ThreadsExec *const th = ((ThreadsExec * volatile *)s_threads_exec)[ith];
-      if (th) {
-        wait_yield(th->m_pool_state, ThreadsExec::Active);
-      } else {
-        ++thread_spawn_failed;
-      }
-    }
+  s_current_function =
+      &execute_function_noop;  // Initialization work function
 
-    s_current_function             = nullptr;
-    s_current_function_arg         = nullptr;
+  for (unsigned ith = thread_spawn_begin; ith < thread_count; ++ith) {
     s_threads_process.m_pool_state = ThreadsExec::Inactive;
 
+    // If hwloc available then spawned thread will
+    // choose its own entry in 's_threads_coord'
+    // otherwise specify the entry.
+    s_current_function_arg =
+        reinterpret_cast<void *>(hwloc_can_bind ? ~0u : ith);
+
+    // Make sure all outstanding memory writes are complete
+    // before spawning the new thread.
     memory_fence();
 
-    if (!thread_spawn_failed) {
-      // Bind process to the core on which it was located before spawning
-      // occurred
-      if (hwloc_can_bind) {
-        Kokkos::hwloc::bind_this_thread(proc_coord);
-      }
+    // Spawn thread executing the 'driver()' function.
+    // Wait until spawned thread has attempted to initialize.
+    // If spawning and initialization is successful then
+    // an entry in 's_threads_exec' will be assigned.
+    ThreadsExec::spawn();
+    wait_yield(s_threads_process.m_pool_state, ThreadsExec::Inactive);
+    if (s_threads_process.m_pool_state == ThreadsExec::Terminating) break;
+  }
 
-      if (thread_spawn_begin) {  // Include process in pool.
-        const std::pair<unsigned, unsigned> coord =
-            Kokkos::hwloc::get_this_thread_coordinate();
-
-        s_threads_exec[0]                  = &s_threads_process;
-        s_threads_process.m_numa_rank      = coord.first;
-        s_threads_process.m_numa_core_rank = coord.second;
-        s_threads_process.m_pool_base      = s_threads_exec;
-        s_threads_process.m_pool_rank =
-            thread_count - 1;  // Reversed for scan-compatible reductions
-        s_threads_process.m_pool_size     = thread_count;
-        s_threads_process.m_pool_fan_size = fan_size(
-            s_threads_process.m_pool_rank, s_threads_process.m_pool_size);
-        s_threads_pid[s_threads_process.m_pool_rank] =
-            std::this_thread::get_id();
-      } else {
-        s_threads_process.m_pool_base     = nullptr;
-        s_threads_process.m_pool_rank     = 0;
-        s_threads_process.m_pool_size     = 0;
-        s_threads_process.m_pool_fan_size = 0;
-      }
+  // Wait for all spawned threads to deactivate before zeroing the function.
 
-      // Initial allocations:
-      ThreadsExec::resize_scratch(1024, 1024);
+  for (unsigned ith = thread_spawn_begin; ith < thread_count; ++ith) {
+    // Try to protect against cache coherency failure by casting to volatile.
+    ThreadsExec *const th = ((ThreadsExec * volatile *)s_threads_exec)[ith];
+    if (th) {
+      wait_yield(th->m_pool_state, ThreadsExec::Active);
     } else {
-      s_thread_pool_size[0] = 0;
-      s_thread_pool_size[1] = 0;
-      s_thread_pool_size[2] = 0;
+      ++thread_spawn_failed;
     }
   }
 
-  if (is_initialized || thread_spawn_failed) {
-    std::ostringstream msg;
+  s_current_function             = nullptr;
+  s_current_function_arg         = nullptr;
+  s_threads_process.m_pool_state = ThreadsExec::Inactive;
 
-    msg << "Kokkos::Threads::initialize ERROR";
+  memory_fence();
 
-    if (is_initialized) {
-      msg << " : already initialized";
+  if (!thread_spawn_failed) {
+    // Bind process to the core on which it was located before spawning
+    // occurred
+    if (hwloc_can_bind) {
+      Kokkos::hwloc::bind_this_thread(proc_coord);
     }
-    if (thread_spawn_failed) {
-      msg << " : failed to spawn " << thread_spawn_failed << " threads";
+
+    if (thread_spawn_begin) {  // Include process in pool.
+      std::pair<unsigned, unsigned> coord =
+          Kokkos::hwloc::get_this_thread_coordinate();
+
+      if (0 <= s_threads_cpu[0] &&
+          bind_this_thread_to_cpu(s_threads_cpu[0])) {
+        coord = native_thread_coordinate(s_threads_cpu[0]);
+      }
+
+      s_threads_exec[0]                  = &s_threads_process;
+      s_threads_process.m_numa_rank      = coord.first;
+      s_threads_process.m_numa_core_rank = coord.second;
+      s_threads_process.m_pool_base      = s_threads_exec;
+      s_threads_process.m_pool_rank =
+          thread_count - 1;  // Reversed for scan-compatible reductions
+      s_threads_process.m_pool_size     = thread_count;
+      s_threads_process.m_pool_fan_size = fan_size(
+          s_threads_process.m_pool_rank, s_threads_process.m_pool_size);
+      s_threads_pid[s_threads_process.m_pool_rank] =
+          std::this_thread::get_id();
+    } else {
+      s_threads_process.m_pool_base     = nullptr;
+      s_threads_process.m_pool_rank     = 0;
+      s_threads_process.m_pool_size     = 0;
+      s_threads_process.m_pool_fan_size = 0;
     }
 
+    // Initial allocations:
+    ThreadsExec::resize_scratch(1024, 1024);
+  } else {
+    s_thread_pool_size[0] = 0;
+    s_thread_pool_size[1] = 0;
+    s_thread_pool_size[2] = 0;
+
+    std::ostringstream msg;
+    msg << "Kokkos::Threads::initialize ERROR : failed to spawn "
+        << thread_spawn_failed << " threads";
     Kokkos::Impl::throw_runtime_exception(msg.str());
   }
+}
 
-  // Check for over-subscription
-  auto const reported_ranks = mpi_ranks_per_node();
-  auto const mpi_local_size = reported_ranks < 0 ? 1 : reported_ranks;
-  int const procs_per_node  = std::thread::hardware_concurrency();
-  if (Kokkos::show_warnings() &&
-      (mpi_local_size * long(thread_count) > procs_per_node)) {
-    std::cerr << "Kokkos::Threads::initialize WARNING: You are likely "
-                 "oversubscribing your CPU cores."
-              << std::endl;
-    std::cerr << "                                    Detected: "
-              << procs_per_node << " cores per node." << std::endl;
-    std::cerr << "                                    Detected: "
-              << mpi_local_size << " MPI_ranks per node." << std::endl;
-    std::cerr << "                                    Requested: "
-              << thread_count << " threads per process." << std::endl;
-  }
+void ThreadsExec::spawn_deferred_thread_pool() {
+  if (!s_deferred_spawn) return;
 
-  Impl::SharedAllocationRecord<void, void>::tracking_enable();
+  Kokkos::Timer timer;
+  std::exchange(s_deferred_spawn, nullptr)();
+  record_startup_time("Threads thread pool", timer.seconds());
 }
 
 //----------------------------------------------------------------------------
@@ -776,9 +1013,13 @@ void ThreadsExec::initialize(int thread_count_arg) {
 void ThreadsExec::finalize() {
   verify_is_process("ThreadsExec::finalize", false);
 
+  // Without a kernel, a lazily initialized thread pool was never spawned
+  s_deferred_spawn = nullptr;
+
   fence();
 
   resize_scratch(0, 0);
+  ThreadsInternal::singleton().m_level1_scratch.release();
 
   const unsigned begin = s_threads_process.m_pool_base ? 1 : 0;
 
@@ -802,6 +1043,10 @@ void ThreadsExec::finalize() {
   if (Kokkos::hwloc::can_bind_threads()) {
     Kokkos::hwloc::unbind_this_thread();
   }
+  if (s_threads_binding != HostThreadBinding::none) {
+    restore_this_thread_affinity();
+    s_threads_binding = HostThreadBinding::none;
+  }
 
   s_thread_pool_size[0] = 0;
   s_thread_pool_size[1] = 0;
@@ -821,6 +1066,263 @@ void ThreadsExec::finalize() {
 
 //----------------------------------------------------------------------------
 
+ThreadsInternal &ThreadsInternal::singleton() {
+  static ThreadsInternal self;
+  return self;
+}
+
+// The thread pool is the first instance and gets the id 1
+ThreadsInternal::ThreadsInternal()
+    : m_instance_id(
+          Kokkos::Tools::Experimental::Impl::idForInstance<Kokkos::Threads>(
+              reinterpret_cast<uintptr_t>(this))) {}
+
+ThreadsInternal::ThreadsInternal(ThreadsExec *const *workers, int size)
+    : m_pool_base(size),
+      m_workers(workers, workers + (size - 1)),
+      m_instance_id(
+          Kokkos::Tools::Experimental::Impl::idForInstance<Kokkos::Threads>(
+              reinterpret_cast<uintptr_t>(this))) {
+  // The root runs on the dispatching thread, place it like the process
+  for (int entry = 0; entry < size; ++entry) {
+    m_members.emplace_back(new ThreadsExec(
+        *this, entry ? *m_workers[entry - 1] : s_threads_process, entry, size));
+    m_pool_base[entry] = m_members.back().get();
+  }
+
+  const int threads_per_core = s_thread_pool_size[2];
+
+  m_pool_size[0] = size;
+  m_pool_size[1] = size;
+  m_pool_size[2] = (0 < threads_per_core && 0 == size % threads_per_core)
+                       ? threads_per_core
+                       : 1;
+
+  // Initial allocations:
+  resize_scratch(1024, 1024);
+}
+
+int ThreadsInternal::pool_size(int depth) const {
+  return is_partition() ? m_pool_size[depth] : s_thread_pool_size[depth];
+}
+
+std::vector<ThreadsExec *> ThreadsInternal::available_workers() const {
+  if (is_partition()) return m_workers;
+
+  // Without the process thread, it dispatches to the partitions
+  std::vector<ThreadsExec *> workers;
+  for (int i = s_threads_process.m_pool_base ? 1 : 0; i < s_thread_pool_size[0];
+       ++i) {
+    workers.push_back(s_threads_exec[i]);
+  }
+  return workers;
+}
+
+std::vector<Threads> ThreadsInternal::partition(
+    std::vector<double> const &weights) {
+  ThreadsExec::verify_is_process("Kokkos::Threads partition_space", true);
+  // Partitions borrow the threads of the pool
+  ThreadsExec::spawn_deferred_thread_pool();
+
+  if (weights.empty()) {
+    Kokkos::abort("Kokkos::abort: Partition weights vector is empty.");
+  }
+
+  const double total_weight =
+      std::accumulate(weights.begin(), weights.end(), 0.);
+  const int main_pool_size = pool_size();
+  const auto workers       = available_workers();
+
+  // Every partition has at least its root, the thread dispatching to it, and
+  // borrows the next 'size - 1' pool threads.  The last partition gets all
+  // resources left.
+  std::vector<Threads> instances;
+  int resources_left = main_pool_size;
+  int next_worker    = 0;
+  for (std::size_t i = 0; i < weights.size(); ++i) {
+    int size = resources_left;
+    if (i + 1 < weights.size()) {
+      size = static_cast<int>(weights[i] / total_weight * main_pool_size);
+    }
+    size = std::max(1, std::min<int>(size, 1 + workers.size() - next_worker));
+
+    instances.push_back(
+        Threads(new ThreadsInternal(workers.data() + next_worker, size)));
+
+    resources_left -= size;
+    next_worker += size - 1;
+  }
+  return instances;
+}
+
+void ThreadsInternal::start(void (*func)(ThreadsExec &, const void *),
+                            const void *arg) {
+  m_function     = func;
+  m_function_arg = arg;
+
+  // Wait for the borrowed pool threads to become idle and hand them the
+  // members of this partition.
+  {
+    std::lock_guard<std::mutex> lock(s_threads_claim_mutex);
+    for (ThreadsExec *worker : m_workers) {
+      wait_inactive(*worker);
+    }
+    for (std::size_t i = 0; i < m_workers.size(); ++i) {
+      m_workers[i]->m_partition_exec = m_members[i + 1].get();
+      m_members[i + 1]->m_pool_state = ThreadsExec::Active;
+    }
+
+    // Make sure the members are written before activating threads.
+    memory_fence();
+
+    for (ThreadsExec *worker : m_workers) {
+      worker->m_pool_state = ThreadsExec::Active;
+    }
+  }
+
+  // The calling thread is the root, its completion implies the completion of
+  // all members.
+  ThreadsExec &root            = *m_members[0];
+  ThreadsExec *const enclosing = t_partition_exec;
+  t_partition_exec             = &root;
+  root.m_pool_state            = ThreadsExec::Active;
+  {
+    SharedAllocationDisableTrackingGuard untracked;
+    (*func)(root, arg);
+  }
+  root.m_pool_state = ThreadsExec::Inactive;
+  t_partition_exec  = enclosing;
+
+  m_function     = nullptr;
+  m_function_arg = nullptr;
+}
+
+void ThreadsInternal::execute(void (*func)(ThreadsExec &, const void *),
+                              const void *arg) {
+  if (!is_partition()) {
+    // Spawning allocates the scratch memory of the threads, which claims them
+    ThreadsExec::spawn_deferred_thread_pool();
+
+    // A pool thread becomes inactive before the root has seen it completing
+    // its work, partitions may only borrow it once the fence is done.
+    std::lock_guard<std::mutex> lock(s_threads_claim_mutex);
+    ThreadsExec::start(func, arg);
+    ThreadsExec::fence();
+    return;
+  }
+
+  if (0 == s_thread_pool_size[0]) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Threads partition instance FAILED : Threads not "
+        "initialized.");
+  }
+
+  start(func, arg);
+}
+
+void *ThreadsInternal::resize_scratch(size_t reduce_size, size_t thread_size) {
+  if (!is_partition()) {
+    return ThreadsExec::resize_scratch(reduce_size, thread_size);
+  }
+
+  enum { ALIGN_MASK = Kokkos::Impl::MEMORY_ALIGNMENT - 1 };
+
+  const size_t old_reduce_size = m_scratch_reduce_end;
+  const size_t old_thread_size = m_scratch_thread_end - m_scratch_reduce_end;
+
+  reduce_size = (reduce_size + ALIGN_MASK) & ~ALIGN_MASK;
+  thread_size = (thread_size + ALIGN_MASK) & ~ALIGN_MASK;
+
+  // Increase size, every member allocates and touches its own scratch.
+  if ((old_reduce_size < reduce_size) || (old_thread_size < thread_size)) {
+    m_scratch_reduce_end = std::max(reduce_size, old_reduce_size);
+    m_scratch_thread_end =
+        m_scratch_reduce_end + std::max(thread_size, old_thread_size);
+
+    execute(&ThreadsExec::first_touch_allocate_partition_scratch, nullptr);
+  }
+
+  return root_reduce_scratch();
+}
+
+void ThreadsInternal::resize_level1_scratch(size_t level1_bytes,
+                                            int team_alloc) {
+  m_level1_scratch.resize(level1_bytes,
+                          std::max(1, pool_size() / std::max(1, team_alloc)));
+}
+
+void ThreadsInternal::reserve_team_scratch(size_t level0_bytes,
+                                           size_t level1_bytes) {
+  std::lock_guard<std::mutex> lock(m_instance_mutex);
+
+  m_reserved_thread_scratch =
+      std::max(m_reserved_thread_scratch,
+               ThreadsExecTeamMember::team_reduce_size() + level0_bytes);
+  resize_scratch(0, m_reserved_thread_scratch);
+
+  // Covers level 1 scratch of teams of one thread
+  m_level1_scratch.reserve(level1_bytes, pool_size());
+}
+
+void ThreadsInternal::shrink_team_scratch() {
+  std::lock_guard<std::mutex> lock(m_instance_mutex);
+
+  m_level1_scratch.shrink();
+
+  if (!is_partition()) {
+    ThreadsExec::shrink_scratch(m_reserved_thread_scratch);
+    return;
+  }
+
+  enum { ALIGN_MASK = Kokkos::Impl::MEMORY_ALIGNMENT - 1 };
+
+  const size_t thread_size =
+      (m_reserved_thread_scratch + ALIGN_MASK) & ~ALIGN_MASK;
+  if (m_scratch_reduce_end + thread_size < m_scratch_thread_end) {
+    m_scratch_thread_end = m_scratch_reduce_end + thread_size;
+
+    execute(&ThreadsExec::first_touch_allocate_partition_scratch, nullptr);
+  }
+}
+
+void *ThreadsInternal::root_reduce_scratch() const {
+  return is_partition() ? m_members[0]->reduce_memory()
+                        : ThreadsExec::root_reduce_scratch();
+}
+
+void ThreadsInternal::fence(const std::string &name) {
+  if (!is_partition()) {
+    m_completion->wait_for_dependencies();
+    ThreadsExec::internal_fence(name, Impl::fence_is_static::no);
+    return;
+  }
+
+  // Unless queued, dispatch to a partition is synchronous, only wait for a
+  // kernel dispatched from another thread.
+  Kokkos::Tools::Experimental::Impl::profile_fence_event<Kokkos::Threads>(
+      name,
+      Kokkos::Tools::Experimental::Impl::DirectFenceIDHandle{m_instance_id},
+      [&]() {
+        if (m_submission) m_submission->fence();
+        m_completion->wait_for_dependencies();
+        std::lock_guard<std::mutex> lock(m_instance_mutex);
+      });
+}
+
+void ThreadsInternal::set_async_dispatch(bool enable) {
+  if (!is_partition()) {
+    Kokkos::Impl::throw_runtime_exception(
+        "Kokkos::Experimental::set_async_dispatch FAILED : only partition "
+        "instances of Threads dispatch asynchronously");
+  }
+  if (enable == static_cast<bool>(m_submission)) return;
+
+  // Destroying the queue waits for the kernels in it
+  m_submission = enable ? std::make_unique<HostSubmissionQueue>() : nullptr;
+}
+
+//----------------------------------------------------------------------------
+
 } /* namespace Impl */
 } /* namespace Kokkos */
 
@@ -829,14 +1331,28 @@ void ThreadsExec::finalize() {
 
 namespace Kokkos {
 
+Threads::Threads()
+    : m_space_instance(&Impl::ThreadsInternal::singleton(),
+                       [](Impl::ThreadsInternal *) {}) {}
+
+Threads::Threads(Impl::ThreadsInternal *partition)
+    : m_space_instance(partition,
+                       [](Impl::ThreadsInternal *ptr) { delete ptr; }) {}
+
 #ifdef KOKKOS_ENABLE_DEPRECATED_CODE_4
-int Threads::concurrency() { return impl_thread_pool_size(0); }
+int Threads::concurrency(Threads const &space) {
+  return space.m_space_instance->pool_size(0);
+}
 #else
-int Threads::concurrency() const { return impl_thread_pool_size(0); }
+int Threads::concurrency() const { return m_space_instance->pool_size(0); }
 #endif
 
 void Threads::fence(const std::string &name) const {
-  Impl::ThreadsExec::internal_fence(name, Impl::fence_is_static::no);
+  m_space_instance->fence(name);
+}
+
+uint32_t Threads::impl_instance_id() const noexcept {
+  return m_space_instance->instance_id();
 }
 
 Threads &Threads::impl_instance(int) {
@@ -845,6 +1361,8 @@ Threads &Threads::impl_instance(int) {
 }
 
 int Threads::impl_thread_pool_rank_host() {
+  if (Impl::t_partition_exec) return Impl::t_partition_exec->pool_rank();
+
   const std::thread::id pid = std::this_thread::get_id();
   int i                     = 0;
   while ((i < Impl::s_thread_pool_size[0]) && (pid != Impl::s_threads_pid[i])) {
@@ -859,6 +1377,27 @@ int Threads::impl_thread_pool_size(int depth) {
 
 const char *Threads::name() { return "Threads"; }
 
+void Experimental::set_async_dispatch(Threads const &instance, bool enable) {
+  instance.impl_internal_space_instance()->set_async_dispatch(enable);
+}
+
+void Experimental::reserve_team_scratch(Threads const &instance,
+                                        size_t level0_bytes,
+                                        size_t level1_bytes) {
+  instance.fence(
+      "Kokkos::Experimental::reserve_team_scratch: fence before resizing "
+      "scratch");
+  instance.impl_internal_space_instance()->reserve_team_scratch(level0_bytes,
+                                                                level1_bytes);
+}
+
+void Experimental::shrink_team_scratch(Threads const &instance) {
+  instance.fence(
+      "Kokkos::Experimental::shrink_team_scratch: fence before releasing "
+      "scratch");
+  instance.impl_internal_space_instance()->shrink_team_scratch();
+}
+
 namespace Impl {
 
 int g_threads_space_factory_initialized =
@@ -20,8 +20,11 @@
 #include <Kokkos_Macros.hpp>
 
 #include <cstdio>
+#include <memory>
+#include <mutex>
 #include <ostream>
 #include <utility>
+#include <vector>
 
 #include <impl/Kokkos_Spinwait.hpp>
 
@@ -29,6 +32,9 @@
 #include <Kokkos_Pair.hpp>
 
 #include <impl/Kokkos_ConcurrentBitset.hpp>
+#include <impl/Kokkos_HostTopology.hpp>
+#include <impl/Kokkos_HostSubmissionQueue.hpp>
+#include <impl/Kokkos_HostScratchArena.hpp>
 #include <Threads/Kokkos_Threads.hpp>
 
 //----------------------------------------------------------------------------
@@ -61,6 +67,7 @@ class ThreadsExec {
 
  private:
   friend class Kokkos::Threads;
+  friend class ThreadsInternal;
 
   // Fan-in operations' root is the highest ranking thread
   // to place the 'scan' reduction intermediate values on
@@ -91,19 +98,39 @@ class ThreadsExec {
   // Is this thread stealing (i.e. its owned work_range is exhausted
   bool m_stealing;
 
+  // Partition instance this is a member of, nullptr for the thread pool
+  ThreadsInternal *m_partition;
+  // Member of a partition instance that this pool thread currently runs
+  ThreadsExec *volatile m_partition_exec;
+
   static void global_lock();
   static void global_unlock();
   static void spawn();
+  static void spawn_thread_pool(const unsigned thread_spawn_begin,
+                                const bool hwloc_can_bind,
+                                const std::pair<unsigned, unsigned> proc_coord);
 
   static void first_touch_allocate_thread_private_scratch(ThreadsExec &,
                                                           const void *);
+  static void first_touch_allocate_partition_scratch(ThreadsExec &,
+                                                     const void *);
   static void execute_sleep(ThreadsExec &, const void *);
 
   ThreadsExec(const ThreadsExec &);
   ThreadsExec &operator=(const ThreadsExec &);
 
+  // Member 'entry' of a partition instance, placed like the pool thread 'home'
+  ThreadsExec(ThreadsInternal &partition, const ThreadsExec &home, int entry,
+              int size);
+
+  ThreadsExec *pool_member(const int rank) const {
+    return m_pool_base[m_pool_size - (rank + 1)];
+  }
+
   static void execute_resize_scratch_in_serial();
 
+  static void reallocate_scratch(size_t reduce_size, size_t thread_size);
+
  public:
   KOKKOS_INLINE_FUNCTION int pool_size() const { return m_pool_size; }
   KOKKOS_INLINE_FUNCTION int pool_rank() const { return m_pool_rank; }
@@ -131,6 +158,9 @@ class ThreadsExec {
 
   static void *resize_scratch(size_t reduce_size, size_t thread_size);
 
+  // Releases the thread scratch beyond thread_size, resize_scratch only grows
+  static void shrink_scratch(size_t thread_size);
+
   static void *root_reduce_scratch();
 
   static bool is_process();
@@ -139,7 +169,15 @@ class ThreadsExec {
 
   static int is_initialized();
 
-  static void initialize(int thread_count);
+  // A lazy initialization defers spawning the thread pool to the first
+  // kernel, see spawn_deferred_thread_pool()
+  static void initialize(int thread_count,
+                         HostThreadBinding binding = HostThreadBinding::none,
+                         bool lazy                 = false);
+
+  // Spawns the thread pool unless it is already running. Called by the
+  // process thread before dispatching to the pool.
+  static void spawn_deferred_thread_pool();
 
   static void finalize();
 
@@ -181,17 +219,18 @@ class ThreadsExec {
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
         accum +=
-            *static_cast<volatile int *>(get_thread(rank)->reduce_memory());
+            *static_cast<volatile int *>(pool_member(rank)->reduce_memory());
       }
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        *static_cast<volatile int *>(get_thread(rank)->reduce_memory()) = accum;
+        *static_cast<volatile int *>(pool_member(rank)->reduce_memory()) =
+            accum;
       }
 
       memory_fence();
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        get_thread(rank)->m_pool_state = ThreadsExec::Active;
+        pool_member(rank)->m_pool_state = ThreadsExec::Active;
       }
     }
 
@@ -221,7 +260,7 @@ class ThreadsExec {
       memory_fence();
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
-        get_thread(rank)->m_pool_state = ThreadsExec::Active;
+        pool_member(rank)->m_pool_state = ThreadsExec::Active;
       }
     }
   }
@@ -410,7 +449,7 @@ class ThreadsExec {
 
       for (int rank = 0; rank < m_pool_size; ++rank) {
         scalar_type *const ptr =
-            (scalar_type *)get_thread(rank)->reduce_memory();
+            (scalar_type *)pool_member(rank)->reduce_memory();
         if (rank) {
           for (unsigned i = 0; i < count; ++i) {
             ptr[i] = ptr_prev[i + count];
@@ -575,6 +614,130 @@ class ThreadsExec {
   }
 };
 
+//----------------------------------------------------------------------------
+/** \brief  Instance data of a Kokkos::Threads execution space.
+ *
+ *  The default instance dispatches to the whole thread pool.  A partition
+ *  instance, created by partition_space, borrows a disjoint subset of the
+ *  pool threads: the thread dispatching a kernel is the root of the
+ *  partition and the borrowed pool threads run the other members.  Kernels
+ *  on different partitions therefore run concurrently when they are
+ *  dispatched from different host threads.  Dispatch to a partition is
+ *  synchronous and may be done from any host thread, or asynchronous
+ *  through a submission queue, see set_async_dispatch.
+ */
+class ThreadsInternal {
+ public:
+  static ThreadsInternal &singleton();
+
+  ThreadsInternal(const ThreadsInternal &) = delete;
+  ThreadsInternal &operator=(const ThreadsInternal &) = delete;
+
+  bool is_partition() const { return !m_members.empty(); }
+
+  uint32_t instance_id() const noexcept { return m_instance_id; }
+
+  int pool_size(int depth = 0) const;
+
+  void *resize_scratch(size_t reduce_size, size_t thread_size);
+  void *root_reduce_scratch() const;
+
+  // Grows the level 1 scratch arena to one slot of level1_bytes per team the
+  // members run concurrently
+  void resize_level1_scratch(size_t level1_bytes, int team_alloc);
+
+  HostScratchArena const &level1_scratch() const noexcept {
+    return m_level1_scratch;
+  }
+
+  // Grows the team scratch and keeps it when shrinking
+  void reserve_team_scratch(size_t level0_bytes, size_t level1_bytes);
+
+  // Releases the team scratch beyond the reservation
+  void shrink_team_scratch();
+
+  // Run the function on all members and wait for its completion
+  void execute(void (*)(ThreadsExec &, const void *), const void *);
+
+  void fence(const std::string &name);
+
+  std::vector<Threads> partition(std::vector<double> const &weights);
+
+  // Only partitions, the pool is dispatched to from the process thread
+  void set_async_dispatch(bool enable);
+
+  // Serializes kernel dispatch to this instance
+  std::mutex m_instance_mutex;
+
+  // Tracks the kernels launched on this instance
+  HostInstanceCompletion *completion() const noexcept {
+    return m_completion.get();
+  }
+
+  // The queue of the kernels, if dispatched asynchronously
+  HostSubmissionQueue *submission_queue() const noexcept {
+    return m_submission.get();
+  }
+
+ private:
+  friend class ThreadsExec;
+
+  ThreadsInternal();
+  ThreadsInternal(ThreadsExec *const *workers, int size);
+
+  void start(void (*)(ThreadsExec &, const void *), const void *);
+
+  // Pool threads available to partitions of this instance
+  std::vector<ThreadsExec *> available_workers() const;
+
+  // Partition members in fan-in order, entry 0 is the root
+  std::vector<std::unique_ptr<ThreadsExec>> m_members;
+  std::vector<ThreadsExec *> m_pool_base;
+  // Pool threads running the members 1, 2, ...
+  std::vector<ThreadsExec *> m_workers;
+
+  void (*m_function)(ThreadsExec &, const void *) = nullptr;
+  const void *m_function_arg                      = nullptr;
+
+  size_t m_scratch_reduce_end = 0;
+  size_t m_scratch_thread_end = 0;
+  int m_pool_size[3]          = {0, 0, 0};
+
+  // Thread scratch kept when shrinking, see reserve_team_scratch
+  size_t m_reserved_thread_scratch = 0;
+
+  HostScratchArena m_level1_scratch{"Kokkos::Threads::level1_scratch"};
+
+  uint32_t m_instance_id;
+
+  std::shared_ptr<HostInstanceCompletion> m_completion =
+      std::make_shared<HostInstanceCompletion>();
+
+  // Last, so that the queued kernels run before the members are destroyed
+  std::unique_ptr<HostSubmissionQueue> m_submission;
+};
+
+template <>
+struct ExecSpaceCompletion<Kokkos::Threads> {
+  static HostInstanceCompletion *get(Kokkos::Threads const &exec) noexcept {
+    return exec.impl_internal_space_instance()->completion();
+  }
+};
+
+template <>
+struct ExecSpaceSubmission<Kokkos::Threads> {
+  static constexpr bool may_be_asynchronous = true;
+
+  static HostSubmissionQueue *get(Kokkos::Threads const &exec) noexcept {
+    HostSubmissionQueue *const queue =
+        exec.impl_internal_space_instance()->submission_queue();
+    // Kernels launched by a running kernel of the instance run nested
+    return queue && !queue->is_worker_thread() && !ThreadsExec::in_parallel()
+               ? queue
+               : nullptr;
+  }
+};
+
 } /* namespace Impl */
 } /* namespace Kokkos */
 
@@ -591,7 +754,12 @@ inline int Threads::impl_is_initialized() {
 
 inline void Threads::impl_initialize(InitializationSettings const &settings) {
   Impl::ThreadsExec::initialize(
-      settings.has_num_threads() ? settings.get_num_threads() : -1);
+      settings.has_num_threads() ? settings.get_num_threads() : -1,
+      settings.has_bind_threads()
+          ? Impl::host_thread_binding_from_string(settings.get_bind_threads())
+          : Impl::HostThreadBinding::none,
+      settings.has_lazy_initialization() &&
+          settings.get_lazy_initialization());
 }
 
 inline void Threads::impl_finalize() { Impl::ThreadsExec::finalize(); }
@@ -609,4 +777,52 @@ inline void Threads::impl_static_fence(const std::string &name) {
 }
 } /* namespace Kokkos */
 
+namespace Kokkos {
+namespace Experimental {
+
+template <class... Args>
+std::vector<Threads> partition_space(Threads const &main_instance,
+                                     Args... args) {
+  static_assert(
+      (... && std::is_arithmetic_v<Args>),
+      "Kokkos Error: partitioning arguments must be integers or floats");
+  return main_instance.impl_internal_space_instance()->partition(
+      {static_cast<double>(args)...});
+}
+
+template <class T>
+std::vector<Threads> partition_space(Threads const &main_instance,
+                                     std::vector<T> const &weights) {
+  static_assert(
+      std::is_arithmetic<T>::value,
+      "Kokkos Error: partitioning arguments must be integers or floats");
+  return main_instance.impl_internal_space_instance()->partition(
+      std::vector<double>(weights.begin(), weights.end()));
+}
+
+/// \brief Makes kernel launches on a partition instance return right away.
+///
+/// The kernels are run in launch order by a worker thread of the instance
+/// and fencing the instance waits for them. Must not be called while
+/// kernels are launched on the instance. Throws for the default instance,
+/// whose thread pool can only be dispatched to from the process thread.
+void set_async_dispatch(Threads const &instance, bool enable);
+
+/// \brief Reserves the scratch memory of team kernels on the instance.
+///
+/// The sizes are per team, as TeamPolicy::scratch_size returns them. Level 1
+/// scratch is reserved for as many teams as the instance has threads. Team
+/// kernels whose level 0 and level 1 scratch fit in the reservation do not
+/// allocate when they are launched. Like kernels on the default instance,
+/// it must be called from the process thread for the default instance.
+void reserve_team_scratch(Threads const &instance, size_t level0_bytes,
+                          size_t level1_bytes);
+
+/// \brief Releases the team scratch memory that kernels grew beyond the
+/// reservation, e.g. when the instance becomes idle. Fences the instance.
+void shrink_team_scratch(Threads const &instance);
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
 #endif /* #define KOKKOS_THREADSEXEC_HPP */
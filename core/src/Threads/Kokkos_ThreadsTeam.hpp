@@ -24,6 +24,7 @@
 #include <utility>
 #include <impl/Kokkos_Spinwait.hpp>
 #include <impl/Kokkos_HostThreadTeam.hpp>
+#include <impl/Kokkos_HostScratchArena.hpp>
 
 #include <Kokkos_Atomic.hpp>
 
@@ -54,6 +55,9 @@ class ThreadsExecTeamMember {
   ThreadsExec* const* m_team_base;  ///< Base for team fan-in
   space m_team_shared;
   size_t m_team_shared_size;
+  // Slot of the team in the level 1 scratch arena of the instance
+  char* m_level1_scratch;
+  size_t m_level1_scratch_size;
   int m_team_size;
   int m_team_rank;
   int m_team_rank_rev;
@@ -70,7 +74,12 @@ class ThreadsExecTeamMember {
   inline void set_team_shared() {
     new (&m_team_shared) space(
         static_cast<char*>((*m_team_base)->scratch_memory()) + TEAM_REDUCE_SIZE,
-        m_team_shared_size);
+        m_team_shared_size, m_level1_scratch, m_level1_scratch_size);
+  }
+
+  // Level 1 scratch falls back to level 0 scratch without a level 1 arena
+  KOKKOS_INLINE_FUNCTION int scratch_level(int level) const {
+    return m_level1_scratch ? level : 0;
   }
 
  public:
@@ -117,13 +126,15 @@ class ThreadsExecTeamMember {
   }
 
   KOKKOS_INLINE_FUNCTION
-  const execution_space::scratch_memory_space& team_scratch(int) const {
-    return m_team_shared.set_team_thread_mode(0, 1, 0);
+  const execution_space::scratch_memory_space& team_scratch(int level) const {
+    return m_team_shared.set_team_thread_mode(scratch_level(level), 1, 0);
   }
 
   KOKKOS_INLINE_FUNCTION
-  const execution_space::scratch_memory_space& thread_scratch(int) const {
-    return m_team_shared.set_team_thread_mode(0, team_size(), team_rank());
+  const execution_space::scratch_memory_space& thread_scratch(
+      int level) const {
+    return m_team_shared.set_team_thread_mode(scratch_level(level),
+                                              team_size(), team_rank());
   }
 
   KOKKOS_INLINE_FUNCTION int league_rank() const { return m_league_rank; }
@@ -349,6 +360,8 @@ class ThreadsExecTeamMember {
         m_team_base(nullptr),
         m_team_shared(nullptr, 0),
         m_team_shared_size(shared_size),
+        m_level1_scratch(nullptr),
+        m_level1_scratch_size(0),
         m_team_size(team.team_size()),
         m_team_rank(0),
         m_team_rank_rev(0),
@@ -409,6 +422,11 @@ class ThreadsExecTeamMember {
         m_league_end =
             (team.league_size() * (pool_league_rank + 1)) / pool_league_size;
 
+        HostScratchArena const& level1_scratch =
+            team.space().impl_internal_space_instance()->level1_scratch();
+        m_level1_scratch      = level1_scratch.slot(pool_league_rank_rev);
+        m_level1_scratch_size = level1_scratch.slot_size();
+
         set_team_shared();
       }
 
@@ -431,6 +449,8 @@ class ThreadsExecTeamMember {
         m_team_base(nullptr),
         m_team_shared(nullptr, 0),
         m_team_shared_size(0),
+        m_level1_scratch(nullptr),
+        m_level1_scratch_size(0),
         m_team_size(1),
         m_team_rank(0),
         m_team_rank_rev(0),
@@ -515,6 +535,7 @@ template <class... Properties>
 class TeamPolicyInternal<Kokkos::Threads, Properties...>
     : public PolicyTraits<Properties...> {
  private:
+  typename PolicyTraits<Properties...>::execution_space m_space;
   int m_league_size;
   int m_team_size;
   int m_team_alloc;
@@ -529,11 +550,12 @@ class TeamPolicyInternal<Kokkos::Threads, Properties...>
   bool m_tune_vector_length;
 
   inline void init(const int league_size_request, const int team_size_request) {
-    const int pool_size = traits::execution_space::impl_thread_pool_size(0);
+    ThreadsInternal const &instance = *m_space.impl_internal_space_instance();
+    const int pool_size             = instance.pool_size(0);
     const int max_host_team_size = Impl::HostThreadTeamData::max_team_members;
     const int team_max =
         pool_size < max_host_team_size ? pool_size : max_host_team_size;
-    const int team_grain = traits::execution_space::impl_thread_pool_size(2);
+    const int team_grain = instance.pool_size(2);
 
     m_league_size = league_size_request;
 
@@ -565,17 +587,15 @@ class TeamPolicyInternal<Kokkos::Threads, Properties...>
 
   using traits = PolicyTraits<Properties...>;
 
-  const typename traits::execution_space& space() const {
-    static typename traits::execution_space m_space;
-    return m_space;
-  }
+  const typename traits::execution_space& space() const { return m_space; }
 
   template <class ExecSpace, class... OtherProperties>
   friend class TeamPolicyInternal;
 
   template <class... OtherProperties>
   TeamPolicyInternal(
-      const TeamPolicyInternal<Kokkos::Threads, OtherProperties...>& p) {
+      const TeamPolicyInternal<Kokkos::Threads, OtherProperties...>& p)
+      : m_space(p.m_space) {
     m_league_size            = p.m_league_size;
     m_team_size              = p.m_team_size;
     m_team_alloc             = p.m_team_alloc;
@@ -593,13 +613,13 @@ class TeamPolicyInternal<Kokkos::Threads, Properties...>
 
   template <class FunctorType>
   int team_size_max(const FunctorType&, const ParallelForTag&) const {
-    int pool_size          = traits::execution_space::impl_thread_pool_size(1);
+    int pool_size = m_space.impl_internal_space_instance()->pool_size(1);
     int max_host_team_size = Impl::HostThreadTeamData::max_team_members;
     return pool_size < max_host_team_size ? pool_size : max_host_team_size;
   }
   template <class FunctorType>
   int team_size_max(const FunctorType&, const ParallelReduceTag&) const {
-    int pool_size          = traits::execution_space::impl_thread_pool_size(1);
+    int pool_size = m_space.impl_internal_space_instance()->pool_size(1);
     int max_host_team_size = Impl::HostThreadTeamData::max_team_members;
     return pool_size < max_host_team_size ? pool_size : max_host_team_size;
   }
@@ -610,12 +630,12 @@ class TeamPolicyInternal<Kokkos::Threads, Properties...>
   }
   template <class FunctorType>
   int team_size_recommended(const FunctorType&, const ParallelForTag&) const {
-    return traits::execution_space::impl_thread_pool_size(2);
+    return m_space.impl_internal_space_instance()->pool_size(2);
   }
   template <class FunctorType>
   int team_size_recommended(const FunctorType&,
                             const ParallelReduceTag&) const {
-    return traits::execution_space::impl_thread_pool_size(2);
+    return m_space.impl_internal_space_instance()->pool_size(2);
   }
   template <class FunctorType, class ReducerType>
   inline int team_size_recommended(const FunctorType& f, const ReducerType&,
@@ -652,10 +672,11 @@ class TeamPolicyInternal<Kokkos::Threads, Properties...>
   inline int team_iter() const { return m_team_iter; }
 
   /** \brief  Specify league size, request team size */
-  TeamPolicyInternal(const typename traits::execution_space&,
+  TeamPolicyInternal(const typename traits::execution_space& space,
                      int league_size_request, int team_size_request,
                      int vector_length_request = 1)
-      : m_league_size(0),
+      : m_space(space),
+        m_league_size(0),
         m_team_size(0),
         m_team_alloc(0),
         m_team_scratch_size{0, 0},
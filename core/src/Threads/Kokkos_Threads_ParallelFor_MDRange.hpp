@@ -92,8 +92,11 @@ class ParallelFor<FunctorType, Kokkos::MDRangePolicy<Traits...>,
 
  public:
   inline void execute() const {
-    ThreadsExec::start(&ParallelFor::exec, this);
-    ThreadsExec::fence();
+    ThreadsInternal *const instance =
+        m_iter.m_rp.space().impl_internal_space_instance();
+    std::lock_guard<std::mutex> lock(instance->m_instance_mutex);
+
+    instance->execute(&ParallelFor::exec, this);
   }
 
   ParallelFor(const FunctorType &arg_functor, const MDRangePolicy &arg_policy)
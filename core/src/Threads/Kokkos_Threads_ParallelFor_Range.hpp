@@ -108,8 +108,11 @@ class ParallelFor<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
-    ThreadsExec::start(&ParallelFor::exec, this);
-    ThreadsExec::fence();
+    ThreadsInternal *const instance =
+        m_policy.space().impl_internal_space_instance();
+    std::lock_guard<std::mutex> lock(instance->m_instance_mutex);
+
+    instance->execute(&ParallelFor::exec, this);
   }
 
   ParallelFor(const FunctorType &arg_functor, const Policy &arg_policy)
@@ -96,18 +96,22 @@ class ParallelFor<FunctorType, Kokkos::TeamPolicy<Properties...>,
 
  public:
   inline void execute() const {
-    ThreadsExec::resize_scratch(
-        0, Policy::member_type::team_reduce_size() + m_shared);
+    ThreadsInternal *const instance =
+        m_policy.space().impl_internal_space_instance();
+    std::lock_guard<std::mutex> lock(instance->m_instance_mutex);
 
-    ThreadsExec::start(&ParallelFor::exec, this);
+    instance->resize_scratch(
+        0, Policy::member_type::team_reduce_size() + m_shared);
+    instance->resize_level1_scratch(m_policy.scratch_size(1),
+                                    m_policy.team_alloc());
 
-    ThreadsExec::fence();
+    instance->execute(&ParallelFor::exec, this);
   }
 
   ParallelFor(const FunctorType &arg_functor, const Policy &arg_policy)
       : m_functor(arg_functor),
         m_policy(fix_policy(arg_policy)),
-        m_shared(m_policy.scratch_size(0) + m_policy.scratch_size(1) +
+        m_shared(m_policy.scratch_size(0) +
                  FunctorTeamShmemSize<FunctorType>::value(
                      arg_functor, m_policy.team_size())) {}
 };
@@ -106,15 +106,16 @@ class ParallelReduce<CombinedFunctorReducerType,
  public:
   inline void execute() const {
     const ReducerType &reducer = m_iter.m_func.get_reducer();
-    ThreadsExec::resize_scratch(reducer.value_size(), 0);
+    ThreadsInternal *const instance =
+        m_iter.m_rp.space().impl_internal_space_instance();
+    std::lock_guard<std::mutex> lock(instance->m_instance_mutex);
 
-    ThreadsExec::start(&ParallelReduce::exec, this);
+    instance->resize_scratch(reducer.value_size(), 0);
 
-    ThreadsExec::fence();
+    instance->execute(&ParallelReduce::exec, this);
 
     if (m_result_ptr) {
-      const pointer_type data =
-          (pointer_type)ThreadsExec::root_reduce_scratch();
+      const pointer_type data = (pointer_type)instance->root_reduce_scratch();
 
       const unsigned n = reducer.value_count();
       for (unsigned i = 0; i < n; ++i) {
@@ -80,17 +80,20 @@ class ParallelReduce<CombinedFunctorReducerType,
         reducer.final(m_result_ptr);
       }
     } else {
-      ThreadsExec::resize_scratch(
+      ThreadsInternal *const instance =
+          m_policy.space().impl_internal_space_instance();
+      std::lock_guard<std::mutex> lock(instance->m_instance_mutex);
+
+      instance->resize_scratch(
           reducer.value_size(),
           Policy::member_type::team_reduce_size() + m_shared);
+      instance->resize_level1_scratch(m_policy.scratch_size(1),
+                                      m_policy.team_alloc());
 
-      ThreadsExec::start(&ParallelReduce::exec, this);
-
-      ThreadsExec::fence();
+      instance->execute(&ParallelReduce::exec, this);
 
       if (m_result_ptr) {
-        const pointer_type data =
-            (pointer_type)ThreadsExec::root_reduce_scratch();
+        const pointer_type data = (pointer_type)instance->root_reduce_scratch();
 
         const unsigned n = reducer.value_count();
         for (unsigned i = 0; i < n; ++i) {
@@ -119,7 +122,7 @@ class ParallelReduce<CombinedFunctorReducerType,
       : m_functor_reducer(arg_functor_reducer),
         m_policy(fix_policy(arg_policy)),
         m_result_ptr(arg_result.data()),
-        m_shared(m_policy.scratch_size(0) + m_policy.scratch_size(1) +
+        m_shared(m_policy.scratch_size(0) +
                  FunctorTeamShmemSize<FunctorType>::value(
                      arg_functor_reducer.get_functor(), m_policy.team_size())) {
     static_assert(
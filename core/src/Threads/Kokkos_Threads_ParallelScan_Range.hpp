@@ -89,9 +89,12 @@ class ParallelScan<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
-    ThreadsExec::resize_scratch(2 * Analysis::value_size(m_functor), 0);
-    ThreadsExec::start(&ParallelScan::exec, this);
-    ThreadsExec::fence();
+    ThreadsInternal *const instance =
+        m_policy.space().impl_internal_space_instance();
+    std::lock_guard<std::mutex> lock(instance->m_instance_mutex);
+
+    instance->resize_scratch(2 * Analysis::value_size(m_functor), 0);
+    instance->execute(&ParallelScan::exec, this);
   }
 
   ParallelScan(const FunctorType &arg_functor, const Policy &arg_policy)
@@ -173,9 +176,12 @@ class ParallelScanWithTotal<FunctorType, Kokkos::RangePolicy<Traits...>,
 
  public:
   inline void execute() const {
-    ThreadsExec::resize_scratch(2 * Analysis::value_size(m_functor), 0);
-    ThreadsExec::start(&ParallelScanWithTotal::exec, this);
-    ThreadsExec::fence();
+    ThreadsInternal *const instance =
+        m_policy.space().impl_internal_space_instance();
+    std::lock_guard<std::mutex> lock(instance->m_instance_mutex);
+
+    instance->resize_scratch(2 * Analysis::value_size(m_functor), 0);
+    instance->execute(&ParallelScanWithTotal::exec, this);
   }
 
   template <class ViewType>
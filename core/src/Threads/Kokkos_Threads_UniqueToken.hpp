@@ -37,17 +37,18 @@ class UniqueToken<Threads, UniqueTokenScope::Instance> {
   /// \brief create object size for concurrency on the given instance
   ///
   /// This object should not be shared between instances
-  UniqueToken(execution_space const & = execution_space()) noexcept
-      : m_count(::Kokkos::Threads::impl_thread_pool_size()),
+  UniqueToken(execution_space const &space = execution_space()) noexcept
+      : m_count(space.impl_internal_space_instance()->pool_size()),
         m_buffer_view(buffer_type()),
         m_buffer(nullptr) {}
 
-  UniqueToken(size_type max_size, execution_space const & = execution_space())
-      : m_count(max_size > ::Kokkos::Threads::impl_thread_pool_size()
-                    ? ::Kokkos::Threads::impl_thread_pool_size()
+  UniqueToken(size_type max_size,
+              execution_space const &space = execution_space())
+      : m_count(max_size > space.impl_internal_space_instance()->pool_size()
+                    ? space.impl_internal_space_instance()->pool_size()
                     : max_size),
         m_buffer_view(
-            max_size > ::Kokkos::Threads::impl_thread_pool_size()
+            max_size > space.impl_internal_space_instance()->pool_size()
                 ? buffer_type()
                 : buffer_type("UniqueToken::m_buffer_view",
                               ::Kokkos::Impl::concurrent_bitset::buffer_bound(
@@ -69,8 +69,11 @@ class ParallelFor<FunctorType, Kokkos::WorkGraphPolicy<Traits...>,
 
  public:
   inline void execute() {
-    ThreadsExec::start(&Self::thread_main, this);
-    ThreadsExec::fence();
+    ThreadsInternal *const instance =
+        m_policy.space().impl_internal_space_instance();
+    std::lock_guard<std::mutex> lock(instance->m_instance_mutex);
+
+    instance->execute(&Self::thread_main, this);
   }
 
   inline ParallelFor(const FunctorType& arg_functor, const Policy& arg_policy)
@@ -25,16 +25,20 @@
 #include <impl/Kokkos_DeviceManagement.hpp>
 #include <impl/Kokkos_ExecSpaceManager.hpp>
 #include <impl/Kokkos_CPUDiscovery.hpp>
+#include <impl/Kokkos_HostTopology.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
 #include <cstring>
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <cstdlib>
 #include <stack>
 #include <functional>
 #include <list>
+#include <mutex>
 #include <cerrno>
 #include <random>
 #include <regex>
@@ -50,6 +54,7 @@ bool g_is_initialized = false;
 bool g_is_finalized   = false;
 bool g_show_warnings  = true;
 bool g_tune_internals = false;
+std::atomic<size_t> g_global_fence_count{0};
 // When compiling with clang/LLVM and using the GNU (GCC) C++ Standard Library
 // (any recent version between GCC 7.3 and GCC 9.2), std::deque SEGV's during
 // the unwinding of the atexit(3C) handlers at program termination.  However,
@@ -74,6 +79,11 @@ std::map<metadata_category_type,
          std::map<metadata_key_type, metadata_value_type>>
     metadata_map;
 
+// Phases of the initialization in the order they completed, with their
+// duration in seconds
+std::mutex startup_times_mutex;
+std::vector<std::pair<std::string, double>> startup_times;
+
 void declare_configuration_metadata(const std::string& category,
                                     const std::string& key,
                                     const std::string& value) {
@@ -94,9 +104,13 @@ void combine(Kokkos::InitializationSettings& out,
   KOKKOS_IMPL_COMBINE_SETTING(skip_device);
   KOKKOS_IMPL_COMBINE_SETTING(disable_warnings);
   KOKKOS_IMPL_COMBINE_SETTING(tune_internals);
+  KOKKOS_IMPL_COMBINE_SETTING(bind_threads);
+  KOKKOS_IMPL_COMBINE_SETTING(lazy_initialization);
   KOKKOS_IMPL_COMBINE_SETTING(tools_help);
   KOKKOS_IMPL_COMBINE_SETTING(tools_libs);
   KOKKOS_IMPL_COMBINE_SETTING(tools_args);
+  KOKKOS_IMPL_COMBINE_SETTING(tools_trace_file);
+  KOKKOS_IMPL_COMBINE_SETTING(tools_perf_counters);
 #undef KOKKOS_IMPL_COMBINE_SETTING
 }
 
@@ -112,6 +126,13 @@ void combine(Kokkos::InitializationSettings& out,
   if (in.args != InitArguments::unset_string_option) {
     out.set_tools_args(in.args);
   }
+  if (in.trace_file != InitArguments::unset_string_option) {
+    out.set_tools_trace_file(in.trace_file);
+  }
+  if (in.perf_counters != InitArguments::PossiblyUnsetOption::unset) {
+    out.set_tools_perf_counters(in.perf_counters ==
+                                InitArguments::PossiblyUnsetOption::on);
+  }
 }
 
 void combine(Kokkos::Tools::InitArguments& out,
@@ -127,6 +148,14 @@ void combine(Kokkos::Tools::InitArguments& out,
   if (in.has_tools_args()) {
     out.args = in.get_tools_args();
   }
+  if (in.has_tools_trace_file()) {
+    out.trace_file = in.get_tools_trace_file();
+  }
+  if (in.has_tools_perf_counters()) {
+    out.perf_counters = in.get_tools_perf_counters()
+                            ? InitArguments::PossiblyUnsetOption::on
+                            : InitArguments::PossiblyUnsetOption::off;
+  }
 }
 
 int get_device_count() {
@@ -202,7 +231,11 @@ void Kokkos::Impl::ExecSpaceManager::initialize_spaces(
   // Eventually, we may want to do something less brittle than this, but for now
   // we're just preserving compatibility with the old implementation.
   for (auto& to_init : exec_space_factory_list) {
+    Kokkos::Timer timer;
     to_init.second->initialize(settings);
+    // Strip the ordering prefix, e.g. "050_"
+    record_startup_time(to_init.first.substr(to_init.first.find('_') + 1),
+                        timer.seconds());
   }
 }
 
@@ -224,6 +257,12 @@ void Kokkos::Impl::ExecSpaceManager::print_configuration(std::ostream& os,
   }
 }
 
+void Kokkos::Impl::record_startup_time(std::string const& phase,
+                                       double seconds) {
+  std::lock_guard<std::mutex> lock(startup_times_mutex);
+  startup_times.emplace_back(phase, seconds);
+}
+
 int Kokkos::Impl::get_ctest_gpu(int local_rank) {
   auto const* ctest_kokkos_device_type =
       std::getenv("CTEST_KOKKOS_DEVICE_TYPE");
@@ -784,7 +823,9 @@ void pre_initialize_internal(const Kokkos::InitializationSettings& settings) {
 void post_initialize_internal(const Kokkos::InitializationSettings& settings) {
   Kokkos::Tools::InitArguments tools_init_arguments;
   combine(tools_init_arguments, settings);
+  Kokkos::Timer timer;
   initialize_profiling(tools_init_arguments);
+  Kokkos::Impl::record_startup_time("tools", timer.seconds());
   g_is_initialized = true;
   if (settings.has_print_configuration() &&
       settings.get_print_configuration()) {
@@ -798,7 +839,10 @@ void initialize_internal(const Kokkos::InitializationSettings& settings) {
   // these callbacks are not called inside the backend initialization, before
   // the tool initialization happened.
   Kokkos::Tools::Experimental::pause_tools();
+  Kokkos::Timer timer;
   pre_initialize_internal(settings);
+  Kokkos::Impl::record_startup_time("configuration metadata",
+                                    timer.seconds());
   initialize_backends(settings);
   Kokkos::Tools::Experimental::resume_tools();
   post_initialize_internal(settings);
@@ -843,6 +887,7 @@ void post_finalize_internal() {
 }
 
 void fence_internal(const std::string& name) {
+  g_global_fence_count.fetch_add(1, std::memory_order_relaxed);
   Kokkos::Impl::ExecSpaceManager::get_instance().static_fence(name);
 }
 
@@ -863,6 +908,17 @@ Kokkos Core Options:
                                    left off, Kokkos uses heuristics
   --kokkos-num-threads=INT       : specify total number of threads to use for
                                    parallel regions on the host.
+  --kokkos-bind-threads=(none|compact|spread|numa)
+                                 : pin the host backend threads to CPUs, using the
+                                   topology read from sysfs (Linux only).
+                                   - compact: neighbouring cores, one thread per
+                                              core before using hyperthreads.
+                                   - spread:  evenly spaced over all cores.
+                                   - numa:    the same number of threads on every
+                                              NUMA node.
+  --kokkos-lazy-initialization   : start the host backend threads and allocate
+                                   their scratch memory when the first kernel
+                                   is launched instead of in Kokkos::initialize
   --kokkos-device-id=INT         : specify device id to be used by Kokkos.
   --kokkos-map-device-id-by=(random|mpi_rank)
                                  : strategy to select device-id automatically from
@@ -886,6 +942,13 @@ Kokkos Tools Options:
                                    kokkos-tool as command-line arguments. E.g.
                                    `<EXE> --kokkos-tools-args="-c input.txt"` will
                                    pass `<EXE> -c input.txt` as argc/argv to tool
+  --kokkos-tools-trace-file=STR  : Record kernels, fences, regions and deep copies
+                                   into a Chrome Trace Event JSON file (viewable
+                                   with chrome://tracing or ui.perfetto.dev).
+                                   Works without loading a kokkos-tool
+  --kokkos-tools-perf-counters   : Count cycles, instructions, LLC and dTLB misses
+                                   per kernel with perf_event_open (Linux only)
+                                   and print a summary at finalize
 
 Except for --kokkos[-tools]-help, you can alternatively set the corresponding
 environment variable of a flag (all letters in upper-case and underscores
@@ -914,9 +977,11 @@ void Kokkos::Impl::parse_command_line_arguments(
   int num_devices;  // deprecated
   int skip_device;  // deprecated
   std::string map_device_id_by;
+  std::string bind_threads;
   bool disable_warnings;
   bool print_configuration;
   bool tune_internals;
+  bool lazy_initialization;
 
   auto get_flag = [](std::string s) -> std::string {
     return s.erase(s.find('='));
@@ -1042,6 +1107,10 @@ void Kokkos::Impl::parse_command_line_arguments(
                               tune_internals)) {
       settings.set_tune_internals(tune_internals);
       remove_flag = true;
+    } else if (check_arg_bool(argv[iarg], "--kokkos-lazy-initialization",
+                              lazy_initialization)) {
+      settings.set_lazy_initialization(lazy_initialization);
+      remove_flag = true;
     } else if (check_arg(argv[iarg], "--kokkos-help") ||
                check_arg(argv[iarg], "--help")) {
       help_flag   = true;
@@ -1057,6 +1126,17 @@ void Kokkos::Impl::parse_command_line_arguments(
       }
       settings.set_map_device_id_by(map_device_id_by);
       remove_flag = true;
+    } else if (check_arg_str(argv[iarg], "--kokkos-bind-threads",
+                             bind_threads)) {
+      if (!is_valid_host_thread_binding(bind_threads)) {
+        std::stringstream ss;
+        ss << "Error: command line argument '--kokkos-bind-threads="
+           << bind_threads << "' is not recognized."
+           << " Raised by Kokkos::initialize().\n";
+        Kokkos::abort(ss.str().c_str());
+      }
+      settings.set_bind_threads(bind_threads);
+      remove_flag = true;
     } else if (std::regex_match(argv[iarg],
                                 std::regex("-?-kokkos.*", std::regex::egrep))) {
       warn_not_recognized_command_line_argument(argv[iarg]);
@@ -1165,6 +1245,10 @@ void Kokkos::Impl::parse_environment_variables(
   if (check_env_bool("KOKKOS_TUNE_INTERNALS", tune_internals)) {
     settings.set_tune_internals(tune_internals);
   }
+  bool lazy_initialization;
+  if (check_env_bool("KOKKOS_LAZY_INITIALIZATION", lazy_initialization)) {
+    settings.set_lazy_initialization(lazy_initialization);
+  }
   char const* map_device_id_by = std::getenv("KOKKOS_MAP_DEVICE_ID_BY");
   if (map_device_id_by != nullptr) {
     if (std::getenv("KOKKOS_DEVICE_ID")) {
@@ -1181,6 +1265,17 @@ void Kokkos::Impl::parse_environment_variables(
     }
     settings.set_map_device_id_by(map_device_id_by);
   }
+  char const* bind_threads = std::getenv("KOKKOS_BIND_THREADS");
+  if (bind_threads != nullptr) {
+    if (!is_valid_host_thread_binding(bind_threads)) {
+      std::stringstream ss;
+      ss << "Error: environment variable 'KOKKOS_BIND_THREADS=" << bind_threads
+         << "' is not recognized."
+         << " Raised by Kokkos::initialize().\n";
+      Kokkos::abort(ss.str().c_str());
+    }
+    settings.set_bind_threads(bind_threads);
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -1197,9 +1292,11 @@ void Kokkos::initialize(int& argc, char* argv[]) {
         "Error: Kokkos::initialize() has already been called."
         " Kokkos can be initialized at most once.\n");
   }
+  Kokkos::Timer timer;
   InitializationSettings settings;
   Impl::parse_environment_variables(settings);
   Impl::parse_command_line_arguments(argc, argv, settings);
+  Impl::record_startup_time("settings", timer.seconds());
   initialize_internal(settings);
 }
 
@@ -1209,9 +1306,11 @@ void Kokkos::initialize(InitializationSettings const& settings) {
         "Error: Kokkos::initialize() has already been called."
         " Kokkos can be initialized at most once.\n");
   }
+  Kokkos::Timer timer;
   InitializationSettings tmp;
   Impl::parse_environment_variables(tmp);
   combine(tmp, settings);
+  Impl::record_startup_time("settings", timer.seconds());
   initialize_internal(tmp);
 }
 
@@ -1250,6 +1349,10 @@ void Kokkos::fence() { fence("Kokkos::fence: Unnamed Global Fence"); }
 #endif
 void Kokkos::fence(const std::string& name) { fence_internal(name); }
 
+[[nodiscard]] size_t Kokkos::Experimental::global_fence_count() noexcept {
+  return g_global_fence_count.load(std::memory_order_relaxed);
+}
+
 namespace {
 void print_helper(std::ostream& os,
                   const std::map<std::string, std::string>& print_me) {
@@ -1280,6 +1383,16 @@ void Kokkos::print_configuration(std::ostream& os, bool verbose) {
   os << "Options:\n";
   print_helper(os, metadata_map["options"]);
 
+  os << "Startup:\n";
+  {
+    std::lock_guard<std::mutex> lock(startup_times_mutex);
+    for (auto const& [phase, seconds] : startup_times) {
+      std::ostringstream milliseconds;
+      milliseconds << std::fixed << std::setprecision(3) << seconds * 1000;
+      os << "  " << phase << ": " << milliseconds.str() << " ms\n";
+    }
+  }
+
   Impl::ExecSpaceManager::get_instance().print_configuration(os, verbose);
 }
 
@@ -154,6 +154,11 @@ class ExecSpaceManager {
   static ExecSpaceManager& get_instance();
 };
 
+// Records how long a phase of the initialization took, for
+// Kokkos::print_configuration. Backends initialized lazily also record
+// starting their threads, which the first kernel they run does.
+void record_startup_time(std::string const& phase, double seconds);
+
 template <class ExecutionSpace>
 int initialize_space_factory(std::string name) {
   auto space_ptr = std::make_unique<ExecSpaceDerived<ExecutionSpace>>();
@@ -0,0 +1,100 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_HostInstanceCompletion.hpp>
+#include <impl/Kokkos_Spinwait.hpp>
+
+#include <algorithm>
+
+namespace Kokkos {
+namespace Impl {
+
+HostInstanceCompletion::ticket_type HostInstanceCompletion::last_launched()
+    const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_launched;
+}
+
+void HostInstanceCompletion::wait(ticket_type ticket) const {
+  for (uint32_t i = 0; !is_complete(ticket); ++i) {
+    host_thread_yield(i, WaitMode::PASSIVE);
+  }
+}
+
+void HostInstanceCompletion::add_dependency(HostInstanceCompletion const& other,
+                                            ticket_type ticket) {
+  if (other.is_complete(ticket)) return;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_dependencies.emplace_back(other.shared_from_this(), ticket);
+}
+
+void HostInstanceCompletion::wait(dependency_list const& dependencies) {
+  for (auto const& [other, ticket] : dependencies) other->wait(ticket);
+}
+
+void HostInstanceCompletion::wait_for_dependencies() {
+  dependency_list dependencies;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_dependencies.empty()) return;
+    dependencies = m_dependencies;
+  }
+
+  wait(dependencies);
+
+  // Dependencies stay met, forget them unless they were added meanwhile.
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_dependencies.erase(
+      std::remove_if(m_dependencies.begin(), m_dependencies.end(),
+                     [](dependency_type const& dependency) {
+                       return dependency.first->is_complete(dependency.second);
+                     }),
+      m_dependencies.end());
+}
+
+HostInstanceCompletion::ticket_type HostInstanceCompletion::begin_launch() {
+  wait_for_dependencies();
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ticket_type const ticket = ++m_launched;
+  m_running.push_back(ticket);
+  m_first_incomplete.store(m_running.front(), std::memory_order_release);
+  return ticket;
+}
+
+std::pair<HostInstanceCompletion::ticket_type,
+          HostInstanceCompletion::dependency_list>
+HostInstanceCompletion::begin_submit() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  ticket_type const ticket = ++m_launched;
+  m_running.push_back(ticket);
+  m_first_incomplete.store(m_running.front(), std::memory_order_release);
+  return {ticket, std::exchange(m_dependencies, {})};
+}
+
+void HostInstanceCompletion::end_launch(ticket_type ticket) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_running.erase(std::find(m_running.begin(), m_running.end(), ticket));
+  m_first_incomplete.store(
+      m_running.empty() ? m_launched + 1 : m_running.front(),
+      std::memory_order_release);
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
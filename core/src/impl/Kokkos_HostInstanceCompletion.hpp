@@ -0,0 +1,128 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HOST_INSTANCE_COMPLETION_HPP
+#define KOKKOS_HOST_INSTANCE_COMPLETION_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+// class HostInstanceCompletion
+//
+// Tracks the kernels launched on an instance of a host execution space.
+// Every launch draws a ticket, tickets increase with the order of the
+// launches, and the kernels up to a ticket are complete once none of them is
+// still running. Other instances wait for a prefix of the kernels through
+// their dependencies, which every launch on them waits for before it starts,
+// instead of fencing the instance from the submitting thread.
+//
+// Kernels may complete out of order when they are launched concurrently from
+// several threads, or nested inside each other, so the tracker keeps the
+// tickets of the running kernels rather than a completion count.
+class HostInstanceCompletion
+    : public std::enable_shared_from_this<HostInstanceCompletion> {
+ public:
+  using ticket_type = uint64_t;
+  using dependency_type =
+      std::pair<std::shared_ptr<HostInstanceCompletion const>, ticket_type>;
+  using dependency_list = std::vector<dependency_type>;
+
+  // The ticket of the last kernel launched so far, 0 if there is none
+  ticket_type last_launched() const;
+
+  // Whether all kernels up to the ticket completed
+  bool is_complete(ticket_type ticket) const noexcept {
+    return ticket < m_first_incomplete.load(std::memory_order_acquire);
+  }
+
+  // Blocks the calling thread until all kernels up to the ticket completed
+  void wait(ticket_type ticket) const;
+
+  // Makes the kernels launched from now on wait until all kernels of other up
+  // to the ticket completed; other must be owned by a std::shared_ptr
+  void add_dependency(HostInstanceCompletion const& other, ticket_type ticket);
+
+  // Blocks the calling thread until the dependencies added so far are met
+  void wait_for_dependencies();
+
+  // Waits for the dependencies and returns the ticket of a new kernel
+  ticket_type begin_launch();
+
+  // Returns the ticket of a new kernel together with the dependencies it has
+  // to wait for before it starts, and forgets them. Only for instances that
+  // run their kernels in submission order, so that the kernels submitted
+  // later do not start before it.
+  std::pair<ticket_type, dependency_list> begin_submit();
+
+  // Blocks the calling thread until the dependencies are met
+  static void wait(dependency_list const& dependencies);
+
+  // Marks the kernel with the ticket as completed
+  void end_launch(ticket_type ticket);
+
+ private:
+  mutable std::mutex m_mutex;
+  ticket_type m_launched = 0;
+  // Tickets of the running kernels in increasing order, usually at most one
+  std::vector<ticket_type> m_running;
+  dependency_list m_dependencies;
+  // Smallest ticket of a running kernel, or m_launched + 1 if none is running
+  std::atomic<ticket_type> m_first_incomplete{1};
+};
+
+// Backends whose instances track the completion of their kernels specialize
+// this to return the tracker of an instance.
+template <class ExecutionSpace>
+struct ExecSpaceCompletion {
+  static HostInstanceCompletion* get(ExecutionSpace const&) noexcept {
+    return nullptr;
+  }
+};
+
+// Marks the lifetime of a kernel launched on an instance
+template <class ExecutionSpace>
+class ExecSpaceLaunchGuard {
+ public:
+  explicit ExecSpaceLaunchGuard(ExecutionSpace const& exec)
+      : m_completion(ExecSpaceCompletion<ExecutionSpace>::get(exec)) {
+    if (m_completion) m_ticket = m_completion->begin_launch();
+  }
+
+  ~ExecSpaceLaunchGuard() {
+    if (m_completion) m_completion->end_launch(m_ticket);
+  }
+
+  ExecSpaceLaunchGuard(ExecSpaceLaunchGuard const&) = delete;
+  ExecSpaceLaunchGuard& operator=(ExecSpaceLaunchGuard const&) = delete;
+
+ private:
+  HostInstanceCompletion* m_completion;
+  HostInstanceCompletion::ticket_type m_ticket = 0;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,120 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_HostScratchArena.hpp>
+#include <impl/Kokkos_Error.hpp>
+#include <Kokkos_HostSpace.hpp>
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+namespace {
+
+// Slots start on their own cache line so that teams do not share one
+constexpr size_t slot_alignment = 64;
+
+size_t align_up(size_t n, size_t alignment) {
+  return (n + alignment - 1) / alignment * alignment;
+}
+
+// Large arenas span whole huge pages
+size_t arena_capacity(size_t n) {
+  return n < HostScratchArena::huge_page_size
+             ? n
+             : align_up(n, HostScratchArena::huge_page_size);
+}
+
+}  // namespace
+
+void HostScratchArena::resize(size_t slot_size, int slot_count) {
+  m_slot_size = align_up(slot_size, slot_alignment);
+
+  if (m_capacity < m_slot_size * slot_count) {
+    allocate(m_slot_size * slot_count);
+  }
+}
+
+void HostScratchArena::reserve(size_t slot_size, int slot_count) {
+  resize(slot_size, slot_count);
+  m_reserved_capacity = std::max(m_reserved_capacity, m_slot_size * slot_count);
+}
+
+void HostScratchArena::shrink() {
+  if (arena_capacity(m_reserved_capacity) < m_capacity) {
+    if (m_reserved_capacity) {
+      allocate(m_reserved_capacity);
+    } else {
+      release();
+    }
+  }
+  m_slot_size = 0;
+}
+
+void HostScratchArena::release() {
+  if (m_allocation) {
+    Kokkos::HostSpace().deallocate(m_label, m_allocation, m_allocation_size);
+  }
+  m_allocation      = nullptr;
+  m_allocation_size = 0;
+  m_data            = nullptr;
+  m_capacity        = 0;
+  m_slot_size       = 0;
+}
+
+void HostScratchArena::allocate(size_t capacity) {
+  const size_t slot_size = m_slot_size;
+  release();
+
+  // Large arenas start on a huge page boundary, the slack of the allocation
+  // makes up for the alignment.
+  capacity                     = arena_capacity(capacity);
+  const bool huge              = huge_page_size <= capacity;
+  const size_t allocation_size = huge ? capacity + huge_page_size : capacity;
+
+  try {
+    m_allocation = Kokkos::HostSpace().allocate(m_label, allocation_size);
+  } catch (Kokkos::Experimental::RawMemoryAllocationFailure const& failure) {
+    // For now, just rethrow the error message the existing way
+    Kokkos::Impl::throw_runtime_exception(failure.get_error_message());
+  }
+  m_allocation_size = allocation_size;
+  m_capacity        = capacity;
+  m_slot_size       = slot_size;
+  m_data            = static_cast<char*>(m_allocation);
+
+  if (huge) {
+    m_data += align_up(reinterpret_cast<uintptr_t>(m_data), huge_page_size) -
+              reinterpret_cast<uintptr_t>(m_data);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    // Only advice, the arena works with regular pages if it is not followed
+    (void)madvise(m_data, m_capacity, MADV_HUGEPAGE);
+#endif
+  }
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
@@ -0,0 +1,83 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_HOST_SCRATCH_ARENA_HPP
+#define KOKKOS_IMPL_HOST_SCRATCH_ARENA_HPP
+
+#include <Kokkos_Macros.hpp>
+
+#include <cstddef>
+
+namespace Kokkos {
+namespace Impl {
+
+// class HostScratchArena
+//
+// Level 1 team scratch of an instance of a host execution space. Team kernels
+// split the arena in one slot per team the instance runs concurrently, the
+// members of a team bump allocate from its slot and start over with every
+// league rank. The arena is sized separately from the thread data holding the
+// level 0 scratch, which stays small enough to be cache resident, and large
+// arenas are backed by huge pages where the system supports it.
+//
+// The arena is not thread safe, kernels resize it while holding the lock of
+// their instance.
+class HostScratchArena {
+ public:
+  // Arenas of at least this size are aligned to and advised to use huge pages
+  static constexpr size_t huge_page_size = size_t(2) << 20;
+
+  explicit HostScratchArena(const char* label) noexcept : m_label(label) {}
+
+  ~HostScratchArena() { release(); }
+
+  HostScratchArena(HostScratchArena const&) = delete;
+  HostScratchArena& operator=(HostScratchArena const&) = delete;
+
+  // Splits the arena in slot_count slots of at least slot_size bytes, it grows
+  // the arena if needed but never shrinks it
+  void resize(size_t slot_size, int slot_count);
+
+  // Resizes the arena and keeps it at least that large when shrinking
+  void reserve(size_t slot_size, int slot_count);
+
+  // Releases the memory beyond the reservation
+  void shrink();
+
+  void release();
+
+  char* slot(int i) const noexcept {
+    return m_slot_size ? m_data + i * m_slot_size : nullptr;
+  }
+  size_t slot_size() const noexcept { return m_slot_size; }
+  size_t capacity() const noexcept { return m_capacity; }
+
+ private:
+  void allocate(size_t capacity);
+
+  const char* m_label;
+  void* m_allocation         = nullptr;
+  size_t m_allocation_size   = 0;
+  char* m_data               = nullptr;
+  size_t m_capacity          = 0;
+  size_t m_slot_size         = 0;
+  size_t m_reserved_capacity = 0;
+};
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
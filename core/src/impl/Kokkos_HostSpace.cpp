@@ -23,6 +23,7 @@
 #include <impl/Kokkos_Error.hpp>
 #include <impl/Kokkos_MemorySpace.hpp>
 #include <impl/Kokkos_Tools.hpp>
+#include <impl/Kokkos_HostSubmissionQueue.hpp>
 
 /*--------------------------------------------------------------------------*/
 
@@ -135,7 +136,19 @@ void HostSpace::impl_deallocate(
     const size_t arg_alloc_size, const size_t arg_logical_size,
     const Kokkos::Tools::SpaceHandle arg_handle) const {
   if (arg_alloc_ptr) {
+    // Kernel launches on the synchronous host backends return only once the
+    // kernel completed, so only backends that launch asynchronously can still
+    // be using memory whose last reference was just released.
+#if defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_HIP) ||       \
+    defined(KOKKOS_ENABLE_SYCL) || defined(KOKKOS_ENABLE_OPENMPTARGET) || \
+    defined(KOKKOS_ENABLE_OPENACC) ||                                   \
+    (defined(KOKKOS_ENABLE_HPX) &&                                      \
+     defined(KOKKOS_ENABLE_IMPL_HPX_ASYNC_DISPATCH))
     Kokkos::fence("HostSpace::impl_deallocate before free");
+#else
+    // Unless host instances were made to dispatch asynchronously
+    Kokkos::Impl::HostSubmissionQueue::fence_all();
+#endif
     size_t reported_size =
         (arg_logical_size > 0) ? arg_logical_size : arg_alloc_size;
     if (Kokkos::Profiling::profileLibraryLoaded()) {
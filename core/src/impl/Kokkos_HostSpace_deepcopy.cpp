@@ -51,19 +51,22 @@ void hostspace_parallel_deepcopy_async(const DefaultHostExecutionSpace& exec,
   // If the asynchronous HPX backend is enabled, do *not* copy anything
   // synchronously. The deep copy must be correctly sequenced with respect to
   // other kernels submitted to the same instance, so we only use the fallback
-  // parallel_for version in this case.
+  // parallel_for version in this case. The same holds for an instance whose
+  // kernels are queued.
+  [[maybe_unused]] const bool is_queued =
+      ExecSpaceSubmission<DefaultHostExecutionSpace>::get(exec) != nullptr;
 #if !(defined(KOKKOS_ENABLE_HPX) && \
       defined(KOKKOS_ENABLE_IMPL_HPX_ASYNC_DISPATCH))
   constexpr int host_deep_copy_serial_limit = 10 * 8192;
-  if ((n < host_deep_copy_serial_limit) ||
-      (DefaultHostExecutionSpace().concurrency() == 1)) {
+  if (!is_queued && ((n < host_deep_copy_serial_limit) ||
+                     (DefaultHostExecutionSpace().concurrency() == 1))) {
     if (0 < n) std::memcpy(dst, src, n);
     return;
   }
 
   // Both src and dst are aligned the same way with respect to 8 byte words
-  if (reinterpret_cast<ptrdiff_t>(src) % 8 ==
-      reinterpret_cast<ptrdiff_t>(dst) % 8) {
+  if (!is_queued && reinterpret_cast<ptrdiff_t>(src) % 8 ==
+                        reinterpret_cast<ptrdiff_t>(dst) % 8) {
     char* dst_c       = reinterpret_cast<char*>(dst);
     const char* src_c = reinterpret_cast<const char*>(src);
     int count         = 0;
@@ -95,8 +98,8 @@ void hostspace_parallel_deepcopy_async(const DefaultHostExecutionSpace& exec,
   }
 
   // Both src and dst are aligned the same way with respect to 4 byte words
-  if (reinterpret_cast<ptrdiff_t>(src) % 4 ==
-      reinterpret_cast<ptrdiff_t>(dst) % 4) {
+  if (!is_queued && reinterpret_cast<ptrdiff_t>(src) % 4 ==
+                        reinterpret_cast<ptrdiff_t>(dst) % 4) {
     char* dst_c       = reinterpret_cast<char*>(dst);
     const char* src_c = reinterpret_cast<const char*>(src);
     int count         = 0;
@@ -128,7 +131,8 @@ void hostspace_parallel_deepcopy_async(const DefaultHostExecutionSpace& exec,
   }
 #endif
 
-  // Src and dst are not aligned the same way, we can only to byte wise copy.
+  // Src and dst are not aligned the same way, or the copy is queued, we can
+  // only to byte wise copy.
   {
     char* dst_p       = reinterpret_cast<char*>(dst);
     const char* src_p = reinterpret_cast<const char*>(src);
@@ -0,0 +1,163 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_HostSubmissionQueue.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+struct HostSubmissionQueue::State {
+  std::mutex mutex;
+  std::condition_variable submitted;
+  std::condition_variable drained;
+  std::deque<std::function<void()>> tasks;
+  // Whether the worker runs a task it already removed from tasks
+  bool busy = false;
+  bool stop = false;
+  std::exception_ptr error;
+  // Written before the queue is registered, the worker does not read it
+  std::thread::id worker_id;
+
+  bool idle() const { return tasks.empty() && !busy; }
+
+  void wait_idle(std::unique_lock<std::mutex>& lock) {
+    drained.wait(lock, [this]() { return idle(); });
+  }
+};
+
+namespace {
+
+// The states of all queues, so that memory can be released safely. Fencing
+// works on copies, a task may destroy a queue while they are fenced.
+std::mutex g_queues_mutex;
+std::vector<std::shared_ptr<HostSubmissionQueue::State>> g_queues;
+std::atomic<int> g_queue_count{0};
+
+// Whether the calling thread is the worker of a queue. Workers only release
+// the scratch memory of their own instance, which no other queue uses.
+thread_local bool t_is_worker = false;
+
+}  // namespace
+
+HostSubmissionQueue::HostSubmissionQueue()
+    : m_state(std::make_shared<State>()) {
+  std::thread worker(run, m_state);
+  m_state->worker_id = worker.get_id();
+  worker.detach();
+
+  std::lock_guard<std::mutex> lock(g_queues_mutex);
+  g_queues.push_back(m_state);
+  g_queue_count.fetch_add(1, std::memory_order_relaxed);
+}
+
+HostSubmissionQueue::~HostSubmissionQueue() {
+  {
+    std::lock_guard<std::mutex> lock(g_queues_mutex);
+    g_queues.erase(std::find(g_queues.begin(), g_queues.end(), m_state));
+    g_queue_count.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  // The worker exits once it ran the remaining tasks.
+  std::unique_lock<std::mutex> lock(m_state->mutex);
+  if (!is_worker_thread()) m_state->wait_idle(lock);
+  m_state->stop = true;
+  m_state->submitted.notify_one();
+}
+
+void HostSubmissionQueue::run(std::shared_ptr<State> state) {
+  t_is_worker = true;
+  std::unique_lock<std::mutex> lock(state->mutex);
+  while (true) {
+    state->submitted.wait(
+        lock, [&]() { return state->stop || !state->tasks.empty(); });
+    if (state->tasks.empty()) return;
+
+    std::function<void()> task = std::move(state->tasks.front());
+    state->tasks.pop_front();
+    state->busy = true;
+    lock.unlock();
+
+    std::exception_ptr error;
+    try {
+      task();
+    } catch (...) {
+      error = std::current_exception();
+    }
+    // Released outside of the lock, the task may hold the last reference to
+    // the instance owning the queue.
+    task = nullptr;
+
+    lock.lock();
+    if (!state->error) state->error = error;
+    state->busy = false;
+    if (state->idle()) state->drained.notify_all();
+  }
+}
+
+void HostSubmissionQueue::submit(std::function<void()> task) {
+  std::lock_guard<std::mutex> lock(m_state->mutex);
+  m_state->tasks.push_back(std::move(task));
+  m_state->submitted.notify_one();
+}
+
+void HostSubmissionQueue::fence() {
+  if (is_worker_thread()) return;
+
+  std::exception_ptr error;
+  {
+    std::unique_lock<std::mutex> lock(m_state->mutex);
+    m_state->wait_idle(lock);
+    std::swap(error, m_state->error);
+  }
+  if (error) std::rethrow_exception(error);
+}
+
+bool HostSubmissionQueue::is_worker_thread() const noexcept {
+  return std::this_thread::get_id() == m_state->worker_id;
+}
+
+void HostSubmissionQueue::fence_all() {
+  if (t_is_worker || g_queue_count.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
+
+  std::vector<std::shared_ptr<State>> queues;
+  {
+    std::lock_guard<std::mutex> lock(g_queues_mutex);
+    queues = g_queues;
+  }
+  for (auto const& state : queues) {
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->wait_idle(lock);
+  }
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
@@ -0,0 +1,118 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_HOST_SUBMISSION_QUEUE_HPP
+#define KOKKOS_HOST_SUBMISSION_QUEUE_HPP
+
+#include <Kokkos_Macros.hpp>
+#include <impl/Kokkos_HostInstanceCompletion.hpp>
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+namespace Kokkos {
+namespace Impl {
+
+// class HostSubmissionQueue
+//
+// Kernels submitted to an instance of a host execution space that dispatches
+// asynchronously. A worker thread owned by the queue runs them one after the
+// other in submission order, it is the thread dispatching to the threads of
+// the instance, so submitting only enqueues the kernel.
+//
+// Memory released while a kernel may still use it must wait for all queues,
+// see fence_all().
+class HostSubmissionQueue {
+ public:
+  HostSubmissionQueue();
+
+  // Runs the kernels submitted so far, unless destroyed by its own worker
+  ~HostSubmissionQueue();
+
+  HostSubmissionQueue(HostSubmissionQueue const&) = delete;
+  HostSubmissionQueue& operator=(HostSubmissionQueue const&) = delete;
+
+  void submit(std::function<void()> task);
+
+  // Blocks until the kernels submitted so far completed and rethrows the
+  // first exception one of them threw. Does nothing on the worker thread.
+  void fence();
+
+  // Whether the calling thread is the worker thread of the queue
+  bool is_worker_thread() const noexcept;
+
+  // Waits for all queues, unless called by a worker thread; exceptions are
+  // left to be rethrown by the fences of the queues
+  static void fence_all();
+
+  // Defined in the source file, public for the registry of all queues
+  struct State;
+
+ private:
+  static void run(std::shared_ptr<State> state);
+
+  // Shared with the worker thread, which may outlive the queue when the last
+  // reference to its instance is released by a kernel
+  std::shared_ptr<State> m_state;
+};
+
+// Backends whose instances may dispatch asynchronously specialize this to
+// return the queue of an instance, or nullptr when a kernel launched on the
+// instance from the calling thread has to run synchronously.
+template <class ExecutionSpace>
+struct ExecSpaceSubmission {
+  static constexpr bool may_be_asynchronous = false;
+
+  static HostSubmissionQueue* get(ExecutionSpace const&) noexcept {
+    return nullptr;
+  }
+};
+
+// Executes the closure of a kernel launched on exec, or submits a copy of it
+// to the queue of exec. The kernel draws its completion ticket when launched
+// and waits for the dependencies of exec at that point.
+template <class ExecutionSpace, class Closure>
+void launch_closure(ExecutionSpace const& exec, Closure& closure) {
+  if constexpr (ExecSpaceSubmission<ExecutionSpace>::may_be_asynchronous) {
+    if (HostSubmissionQueue* const queue =
+            ExecSpaceSubmission<ExecutionSpace>::get(exec)) {
+      HostInstanceCompletion* const completion =
+          ExecSpaceCompletion<ExecutionSpace>::get(exec);
+      auto [ticket, dependencies] = completion->begin_submit();
+      queue->submit([closure, completion, ticket = ticket,
+                     dependencies = std::move(dependencies)]() mutable {
+        HostInstanceCompletion::wait(dependencies);
+        try {
+          closure.execute();
+        } catch (...) {
+          completion->end_launch(ticket);
+          throw;
+        }
+        completion->end_launch(ticket);
+      });
+      return;
+    }
+  }
+
+  ExecSpaceLaunchGuard<ExecutionSpace> launch(exec);
+  closure.execute();
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
@@ -168,6 +168,8 @@ int HostThreadTeamData::organize_team(const int team_size) {
 
 void HostThreadTeamData::disband_team() {
   m_team_scratch         = m_scratch;
+  m_level1_scratch       = nullptr;
+  m_level1_scratch_size  = 0;
   m_team_base            = m_pool_rank;
   m_team_rank            = 0;
   m_team_size            = 1;
@@ -82,6 +82,8 @@ class HostThreadTeamData {
   int64_t* m_scratch;       // per-thread buffer
   int64_t* m_pool_scratch;  // == pool[0]->m_scratch
   int64_t* m_team_scratch;  // == pool[ 0 + m_team_base ]->m_scratch
+  char* m_level1_scratch;   // slot of the team in a level 1 scratch arena
+  size_t m_level1_scratch_size;
   int m_pool_rank;
   int m_pool_size;
   size_t m_team_reduce;
@@ -164,6 +166,8 @@ class HostThreadTeamData {
         m_scratch(nullptr),
         m_pool_scratch(nullptr),
         m_team_scratch(nullptr),
+        m_level1_scratch(nullptr),
+        m_level1_scratch_size(0),
         m_pool_rank(0),
         m_pool_size(1),
         m_team_reduce(0),
@@ -215,6 +219,17 @@ class HostThreadTeamData {
   constexpr int pool_rank() const { return m_pool_rank; }
   constexpr int pool_size() const { return m_pool_size; }
 
+  // Index of the team of this thread among the teams of the pool
+  constexpr int team_index() const { return m_team_base / m_team_alloc; }
+
+  // Level 1 scratch of the team of this thread, assigned by team kernels
+  // that keep it apart from level 0 scratch. Members of teams without it
+  // allocate level 1 scratch from level 0 scratch.
+  void level1_scratch_assign(char* ptr, size_t size) noexcept {
+    m_level1_scratch      = ptr;
+    m_level1_scratch_size = ptr ? size : 0;
+  }
+
   HostThreadTeamData* pool_member(int r) const noexcept {
     return (reinterpret_cast<HostThreadTeamData**>(m_pool_scratch +
                                                    m_pool_members))[r];
@@ -398,22 +413,26 @@ class HostThreadTeamMember {
   HostThreadTeamData& m_data;
   int const m_league_rank;
   int const m_league_size;
+  // Level 1 scratch falls back to level 0 scratch without a level 1 arena
+  int const m_max_scratch_level;
 
  public:
   constexpr HostThreadTeamMember(HostThreadTeamData& arg_data) noexcept
       : m_scratch(arg_data.team_shared(), arg_data.team_shared_bytes()),
         m_data(arg_data),
         m_league_rank(arg_data.m_league_rank),
-        m_league_size(arg_data.m_league_size) {}
+        m_league_size(arg_data.m_league_size),
+        m_max_scratch_level(0) {}
 
   constexpr HostThreadTeamMember(HostThreadTeamData& arg_data,
                                  int const arg_league_rank,
                                  int const arg_league_size) noexcept
       : m_scratch(arg_data.team_shared(), arg_data.team_shared_bytes(),
-                  arg_data.team_shared(), arg_data.team_shared_bytes()),
+                  arg_data.m_level1_scratch, arg_data.m_level1_scratch_size),
         m_data(arg_data),
         m_league_rank(arg_league_rank),
-        m_league_size(arg_league_size) {}
+        m_league_size(arg_league_size),
+        m_max_scratch_level(arg_data.m_level1_scratch ? 1 : 0) {}
 
   ~HostThreadTeamMember()                           = default;
   HostThreadTeamMember()                            = delete;
@@ -444,14 +463,16 @@ class HostThreadTeamMember {
   }
 
   KOKKOS_INLINE_FUNCTION
-  const scratch_memory_space& team_scratch(int) const {
-    return m_scratch.set_team_thread_mode(0, 1, 0);
+  const scratch_memory_space& team_scratch(int level) const {
+    return m_scratch.set_team_thread_mode(
+        level < m_max_scratch_level ? level : m_max_scratch_level, 1, 0);
   }
 
   KOKKOS_INLINE_FUNCTION
-  const scratch_memory_space& thread_scratch(int) const {
-    return m_scratch.set_team_thread_mode(0, m_data.m_team_size,
-                                          m_data.m_team_rank);
+  const scratch_memory_space& thread_scratch(int level) const {
+    return m_scratch.set_team_thread_mode(
+        level < m_max_scratch_level ? level : m_max_scratch_level,
+        m_data.m_team_size, m_data.m_team_rank);
   }
 
   //--------------------------------------------------------------------------
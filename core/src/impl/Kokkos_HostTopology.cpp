@@ -0,0 +1,348 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_HostTopology.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <tuple>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#define KOKKOS_IMPL_HAS_SYSFS_TOPOLOGY
+#endif
+
+namespace Kokkos {
+namespace Impl {
+
+namespace {
+
+// Parses a sysfs CPU list such as "0-3,8,10-11"
+std::vector<int> parse_cpu_list(std::string const& list) {
+  std::vector<int> cpus;
+  std::istringstream in(list);
+  std::string range;
+  while (std::getline(in, range, ',')) {
+    if (range.empty() || range == "\n") continue;
+    auto const dash = range.find('-');
+    try {
+      int const first = std::stoi(range.substr(0, dash));
+      int const last =
+          dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+      for (int cpu = first; cpu <= last; ++cpu) cpus.push_back(cpu);
+    } catch (...) {
+      return {};
+    }
+  }
+  return cpus;
+}
+
+bool read_file(std::string const& path, std::string& contents) {
+  std::ifstream file(path);
+  if (!file) return false;
+  std::getline(file, contents);
+  return true;
+}
+
+bool read_int(std::string const& path, int& value) {
+  std::ifstream file(path);
+  return static_cast<bool>(file >> value);
+}
+
+// Maps arbitrary ids to 0, 1, ... in increasing order of the ids
+template <class Key>
+std::map<Key, int> dense_indices(std::vector<Key> const& keys) {
+  std::map<Key, int> indices;
+  for (auto const& key : keys) indices.emplace(key, 0);
+  int next = 0;
+  for (auto& entry : indices) entry.second = next++;
+  return indices;
+}
+
+// Processing units of the given cores, first hardware thread of every core,
+// then the second one, ...
+std::vector<int> smt_level_major(
+    std::vector<std::vector<HostProcessingUnit>> const& cores) {
+  std::vector<int> cpus;
+  std::size_t max_smt = 0;
+  for (auto const& core : cores) max_smt = std::max(max_smt, core.size());
+  for (std::size_t smt = 0; smt < max_smt; ++smt) {
+    for (auto const& core : cores) {
+      if (smt < core.size()) cpus.push_back(core[smt].os_index);
+    }
+  }
+  return cpus;
+}
+
+}  // namespace
+
+HostProcessingUnit const* HostTopology::find(int os_index) const {
+  for (auto const& pu : processing_units) {
+    if (pu.os_index == os_index) return &pu;
+  }
+  return nullptr;
+}
+
+HostTopology read_host_topology(std::string const& sysfs_root,
+                                std::vector<int> const& cpus) {
+  HostTopology topology;
+  if (cpus.empty()) return topology;
+
+  struct RawProcessingUnit {
+    int os_index;
+    int node       = 0;
+    int package_id = 0;
+    int core_id;
+    int llc_id;
+  };
+  std::vector<RawProcessingUnit> raw;
+
+  std::map<int, int> cpu_to_node;
+#ifdef KOKKOS_IMPL_HAS_SYSFS_TOPOLOGY
+  if (DIR* dir = opendir((sysfs_root + "/node").c_str())) {
+    while (dirent* entry = readdir(dir)) {
+      std::string const name = entry->d_name;
+      if (name.compare(0, 4, "node") != 0 || name.size() == 4 ||
+          name.find_first_not_of("0123456789", 4) != std::string::npos) {
+        continue;
+      }
+      int const node = std::stoi(name.substr(4));
+      std::string list;
+      if (read_file(sysfs_root + "/node/" + name + "/cpulist", list)) {
+        for (int cpu : parse_cpu_list(list)) cpu_to_node[cpu] = node;
+      }
+    }
+    closedir(dir);
+  }
+#endif
+
+  for (int cpu : cpus) {
+    RawProcessingUnit pu;
+    pu.os_index = cpu;
+    pu.core_id  = cpu;
+    pu.llc_id   = -1;
+
+    auto const node = cpu_to_node.find(cpu);
+    if (node != cpu_to_node.end()) pu.node = node->second;
+
+    std::string const cpu_dir = sysfs_root + "/cpu/cpu" + std::to_string(cpu);
+    int value;
+    if (read_int(cpu_dir + "/topology/physical_package_id", value)) {
+      pu.package_id = value;
+    }
+    if (read_int(cpu_dir + "/topology/core_id", value)) {
+      pu.core_id = value;
+    }
+
+    // The last level cache is the highest level data or unified cache, its
+    // domain is named after the first CPU sharing it.
+    int llc_level = 0;
+    for (int index = 0;; ++index) {
+      std::string const cache_dir =
+          cpu_dir + "/cache/index" + std::to_string(index);
+      int level;
+      if (!read_int(cache_dir + "/level", level)) break;
+      std::string type;
+      std::string shared;
+      if (read_file(cache_dir + "/type", type) && type == "Instruction") {
+        continue;
+      }
+      if (level > llc_level &&
+          read_file(cache_dir + "/shared_cpu_list", shared)) {
+        auto const sharing = parse_cpu_list(shared);
+        if (!sharing.empty()) {
+          llc_level = level;
+          pu.llc_id = sharing.front();
+        }
+      }
+    }
+    raw.push_back(pu);
+  }
+
+  using CoreKey = std::tuple<int, int, int>;  // node, package, core id
+  std::vector<int> nodes;
+  std::vector<int> packages;
+  std::vector<CoreKey> cores;
+  std::vector<std::pair<int, int>> llcs;  // package, llc id
+  for (auto const& pu : raw) {
+    nodes.push_back(pu.node);
+    packages.push_back(pu.package_id);
+    cores.emplace_back(pu.node, pu.package_id, pu.core_id);
+    llcs.emplace_back(pu.package_id, pu.llc_id);
+  }
+  auto const node_index    = dense_indices(nodes);
+  auto const package_index = dense_indices(packages);
+  auto const core_index    = dense_indices(cores);
+  auto const llc_index     = dense_indices(llcs);
+
+  for (auto const& pu : raw) {
+    HostProcessingUnit unit;
+    unit.os_index  = pu.os_index;
+    unit.numa_node = node_index.at(pu.node);
+    unit.package   = package_index.at(pu.package_id);
+    unit.core      = core_index.at(CoreKey(pu.node, pu.package_id, pu.core_id));
+    unit.smt_rank  = 0;
+    unit.llc       = llc_index.at({pu.package_id, pu.llc_id});
+    topology.processing_units.push_back(unit);
+  }
+
+  auto& units = topology.processing_units;
+  std::sort(units.begin(), units.end(),
+            [](HostProcessingUnit const& a, HostProcessingUnit const& b) {
+              return std::tie(a.numa_node, a.package, a.core, a.os_index) <
+                     std::tie(b.numa_node, b.package, b.core, b.os_index);
+            });
+  for (std::size_t i = 1; i < units.size(); ++i) {
+    if (units[i].core == units[i - 1].core) {
+      units[i].smt_rank = units[i - 1].smt_rank + 1;
+    }
+  }
+
+  topology.num_numa_nodes = node_index.size();
+  topology.num_packages   = package_index.size();
+  topology.num_cores      = core_index.size();
+  topology.num_llcs       = llc_index.size();
+  for (auto const& unit : units) {
+    topology.max_smt = std::max(topology.max_smt, unit.smt_rank + 1);
+  }
+  return topology;
+}
+
+HostTopology const& host_topology() {
+  static HostTopology const topology = []() {
+    std::vector<int> cpus;
+#ifdef KOKKOS_IMPL_HAS_SYSFS_TOPOLOGY
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (CPU_ISSET(cpu, &mask)) cpus.push_back(cpu);
+      }
+    }
+#endif
+    return read_host_topology("/sys/devices/system", cpus);
+  }();
+  return topology;
+}
+
+bool is_valid_host_thread_binding(std::string const& name) {
+  return name == "none" || name == "compact" || name == "spread" ||
+         name == "numa";
+}
+
+HostThreadBinding host_thread_binding_from_string(std::string const& name) {
+  if (name == "compact") return HostThreadBinding::compact;
+  if (name == "spread") return HostThreadBinding::spread;
+  if (name == "numa") return HostThreadBinding::numa;
+  return HostThreadBinding::none;
+}
+
+char const* to_string(HostThreadBinding binding) {
+  switch (binding) {
+    case HostThreadBinding::compact: return "compact";
+    case HostThreadBinding::spread: return "spread";
+    case HostThreadBinding::numa: return "numa";
+    default: return "none";
+  }
+}
+
+std::vector<int> host_thread_placement(HostTopology const& topology,
+                                       HostThreadBinding binding,
+                                       int num_threads) {
+  std::vector<int> placement;
+  if (binding == HostThreadBinding::none || topology.empty() ||
+      num_threads <= 0) {
+    return placement;
+  }
+
+  // Cores in topological order, each with its processing units
+  std::vector<std::vector<HostProcessingUnit>> cores;
+  for (auto const& pu : topology.processing_units) {
+    if (cores.empty() || cores.back().front().core != pu.core) {
+      cores.emplace_back();
+    }
+    cores.back().push_back(pu);
+  }
+
+  int const num_cores = cores.size();
+
+  if (binding == HostThreadBinding::spread && num_threads <= num_cores) {
+    for (int i = 0; i < num_threads; ++i) {
+      placement.push_back(
+          cores[long(i) * num_cores / num_threads].front().os_index);
+    }
+  } else if (binding == HostThreadBinding::numa) {
+    std::vector<std::vector<std::vector<HostProcessingUnit>>> nodes(
+        topology.num_numa_nodes);
+    for (auto const& core : cores) {
+      nodes[core.front().numa_node].push_back(core);
+    }
+    int const num_nodes = nodes.size();
+    for (int node = 0; node < num_nodes; ++node) {
+      auto const cpus = smt_level_major(nodes[node]);
+      int const count =
+          num_threads / num_nodes + (node < num_threads % num_nodes ? 1 : 0);
+      for (int i = 0; i < count; ++i) {
+        placement.push_back(cpus[i % cpus.size()]);
+      }
+    }
+  } else {
+    auto const cpus = smt_level_major(cores);
+    for (int i = 0; i < num_threads; ++i) {
+      placement.push_back(cpus[i % cpus.size()]);
+    }
+  }
+  return placement;
+}
+
+bool bind_this_thread_to_cpu(int os_index) {
+#ifdef KOKKOS_IMPL_HAS_SYSFS_TOPOLOGY
+  if (os_index < 0 || os_index >= CPU_SETSIZE) return false;
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  CPU_SET(os_index, &mask);
+  return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+#else
+  (void)os_index;
+  return false;
+#endif
+}
+
+bool restore_this_thread_affinity() {
+#ifdef KOKKOS_IMPL_HAS_SYSFS_TOPOLOGY
+  auto const& topology = host_topology();
+  if (topology.empty()) return false;
+  cpu_set_t mask;
+  CPU_ZERO(&mask);
+  for (auto const& pu : topology.processing_units) {
+    CPU_SET(pu.os_index, &mask);
+  }
+  return pthread_setaffinity_np(pthread_self(), sizeof(mask), &mask) == 0;
+#else
+  return false;
+#endif
+}
+
+}  // namespace Impl
+}  // namespace Kokkos
@@ -0,0 +1,92 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_HOST_TOPOLOGY_HPP
+#define KOKKOS_IMPL_HOST_TOPOLOGY_HPP
+
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Impl {
+
+// Native host topology discovery and thread pinning, independent of the hwloc
+// TPL.  On Linux the topology is read from sysfs and restricted to the CPUs in
+// the affinity mask of the process (sched_getaffinity), so that a process
+// bound by MPI or a batch system only sees and uses its own CPUs.  Elsewhere
+// nothing is detected and binding is a no-op.
+
+struct HostProcessingUnit {
+  int os_index;   // logical CPU number as used by sched_setaffinity
+  int numa_node;  // dense NUMA node index
+  int package;    // dense socket index
+  int core;       // dense physical core index
+  int smt_rank;   // rank among the hardware threads of the core
+  int llc;        // dense index of the last level cache domain
+};
+
+struct HostTopology {
+  // Processing units sorted by NUMA node, socket, core and SMT rank
+  std::vector<HostProcessingUnit> processing_units;
+  int num_numa_nodes = 0;
+  int num_packages   = 0;
+  int num_cores      = 0;
+  int num_llcs       = 0;
+  int max_smt        = 0;
+
+  bool empty() const { return processing_units.empty(); }
+  HostProcessingUnit const* find(int os_index) const;
+};
+
+// Reads the topology of the given CPUs from a sysfs tree rooted at
+// 'sysfs_root' (normally /sys/devices/system).  Missing files are tolerated;
+// CPUs without topology information are treated as single-threaded cores.
+HostTopology read_host_topology(std::string const& sysfs_root,
+                                std::vector<int> const& cpus);
+
+// Topology of the CPUs the process may run on, detected once
+HostTopology const& host_topology();
+
+enum class HostThreadBinding { none, compact, spread, numa };
+
+// Valid names are "none", "compact", "spread" and "numa"
+bool is_valid_host_thread_binding(std::string const& name);
+HostThreadBinding host_thread_binding_from_string(std::string const& name);
+char const* to_string(HostThreadBinding binding);
+
+// OS CPU to pin each of 'num_threads' thread ranks to:
+//  - compact: consecutive ranks on neighbouring cores, filling NUMA node 0
+//             first; hardware threads of a core are used only once every
+//             core has a thread
+//  - spread:  ranks evenly spaced over all cores, consecutive ranks stay close
+//  - numa:    the same number of ranks on every NUMA node, each node's ranks
+//             contiguous and compact within the node
+// Ranks wrap around when there are more threads than processing units.
+// Returns an empty vector for HostThreadBinding::none or an empty topology.
+std::vector<int> host_thread_placement(HostTopology const& topology,
+                                       HostThreadBinding binding,
+                                       int num_threads);
+
+// Pins the calling thread to one OS CPU, returns false on failure
+bool bind_this_thread_to_cpu(int os_index);
+
+// Restores the affinity mask the process had when the topology was detected
+bool restore_this_thread_affinity();
+
+}  // namespace Impl
+}  // namespace Kokkos
+
+#endif
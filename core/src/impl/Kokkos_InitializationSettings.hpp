@@ -73,9 +73,13 @@ class InitializationSettings {
   KOKKOS_IMPL_DECLARE(bool, disable_warnings);
   KOKKOS_IMPL_DECLARE(bool, print_configuration);
   KOKKOS_IMPL_DECLARE(bool, tune_internals);
+  KOKKOS_IMPL_DECLARE(std::string, bind_threads);
+  KOKKOS_IMPL_DECLARE(bool, lazy_initialization);
   KOKKOS_IMPL_DECLARE(bool, tools_help);
   KOKKOS_IMPL_DECLARE(std::string, tools_libs);
   KOKKOS_IMPL_DECLARE(std::string, tools_args);
+  KOKKOS_IMPL_DECLARE(std::string, tools_trace_file);
+  KOKKOS_IMPL_DECLARE(bool, tools_perf_counters);
 
 #undef KOKKOS_IMPL_INIT_ARGS_DATA_MEMBER_TYPE
 #undef KOKKOS_IMPL_INIT_ARGS_DATA_MEMBER
@@ -26,6 +26,8 @@
 #include <impl/Kokkos_Profiling.hpp>
 #include <impl/Kokkos_Profiling_Interface.hpp>
 #include <impl/Kokkos_Command_Line_Parsing.hpp>
+#include <impl/Kokkos_Profiling_Trace.hpp>
+#include <impl/Kokkos_Profiling_PerfCounters.hpp>
 
 #if defined(KOKKOS_ENABLE_LIBDL) || defined(KOKKOS_TOOLS_INDEPENDENT_BUILD)
 #include <dlfcn.h>
@@ -85,11 +87,14 @@ void parse_command_line_arguments(int& argc, char* argv[],
                                   InitArguments& arguments) {
   int iarg = 0;
   using Kokkos::Impl::check_arg;
+  using Kokkos::Impl::check_arg_bool;
   using Kokkos::Impl::check_arg_str;
 
-  auto& libs = arguments.lib;
-  auto& args = arguments.args;
-  auto& help = arguments.help;
+  auto& libs       = arguments.lib;
+  auto& args       = arguments.args;
+  auto& help       = arguments.help;
+  auto& trace_file = arguments.trace_file;
+  bool perf_counters;
   while (iarg < argc) {
     bool remove_flag = false;
     if (check_arg_str(argv[iarg], "--kokkos-tools-libs", libs) ||
@@ -118,6 +123,15 @@ void parse_command_line_arguments(int& argc, char* argv[],
       }
       // add the name of the executable to the beginning
       if (argc > 0) args = std::string(argv[0]) + " " + args;
+    } else if (check_arg_str(argv[iarg], "--kokkos-tools-trace-file",
+                             trace_file)) {
+      remove_flag = true;
+    } else if (check_arg_bool(argv[iarg], "--kokkos-tools-perf-counters",
+                              perf_counters)) {
+      arguments.perf_counters = perf_counters
+                                    ? InitArguments::PossiblyUnsetOption::on
+                                    : InitArguments::PossiblyUnsetOption::off;
+      remove_flag = true;
     } else if (check_arg(argv[iarg], "--kokkos-tools-help")) {
       help = InitArguments::PossiblyUnsetOption::on;
       warn_cmd_line_arg_ignored_when_kokkos_tools_disabled(argv[iarg]);
@@ -176,12 +190,29 @@ Kokkos::Tools::Impl::InitializationStatus parse_environment_variables(
                                                     env_tools_args);
     args = env_tools_args;
   }
+  auto env_trace_file = std::getenv("KOKKOS_TOOLS_TRACE_FILE");
+  if (env_trace_file != nullptr) {
+    arguments.trace_file = env_trace_file;
+  }
+  bool perf_counters;
+  if (Kokkos::Impl::check_env_bool("KOKKOS_TOOLS_PERF_COUNTERS",
+                                   perf_counters)) {
+    arguments.perf_counters = perf_counters
+                                  ? InitArguments::PossiblyUnsetOption::on
+                                  : InitArguments::PossiblyUnsetOption::off;
+  }
   return {
       Kokkos::Tools::Impl::InitializationStatus::InitializationResult::success,
       ""};
 }
 InitializationStatus initialize_tools_subsystem(
     const Kokkos::Tools::InitArguments& args) {
+  if (args.trace_file != Kokkos::Tools::InitArguments::unset_string_option) {
+    initialize_trace(args.trace_file);
+  }
+  if (args.perf_counters == InitArguments::PossiblyUnsetOption::on) {
+    initialize_perf_counters();
+  }
 #ifdef KOKKOS_TOOLS_ENABLE_LIBDL
   Kokkos::Profiling::initialize(args.lib);
   auto final_args =
@@ -297,7 +328,8 @@ inline void invoke_kokkosp_callback(
 }
 }  // namespace Experimental
 bool profileLibraryLoaded() {
-  return !Experimental::eventSetsEqual(Experimental::current_callbacks,
+  return Impl::trace_enabled() || Impl::perf_counters_enabled() ||
+         !Experimental::eventSetsEqual(Experimental::current_callbacks,
                                        Experimental::no_profiling);
 }
 
@@ -307,6 +339,9 @@ void beginParallelFor(const std::string& kernelPrefix, const uint32_t devID,
       Experimental::MayRequireGlobalFencing::Yes,
       Experimental::current_callbacks.begin_parallel_for, kernelPrefix.c_str(),
       devID, kernelID);
+  Impl::trace_begin(Impl::TraceCategory::parallel_for, kernelPrefix.c_str(),
+                    devID);
+  Impl::perf_counters_begin_kernel(kernelPrefix.c_str());
 #ifdef KOKKOS_ENABLE_TUNING
   if (Kokkos::tune_internals()) {
     auto context_id = Experimental::get_new_context_id();
@@ -322,6 +357,8 @@ void beginParallelFor(const std::string& kernelPrefix, const uint32_t devID,
 }
 
 void endParallelFor(const uint64_t kernelID) {
+  Impl::perf_counters_end_kernel();
+  Impl::trace_end(Impl::TraceCategory::parallel_for);
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::Yes,
       Experimental::current_callbacks.end_parallel_for, kernelID);
@@ -338,6 +375,9 @@ void beginParallelScan(const std::string& kernelPrefix, const uint32_t devID,
       Experimental::MayRequireGlobalFencing::Yes,
       Experimental::current_callbacks.begin_parallel_scan, kernelPrefix.c_str(),
       devID, kernelID);
+  Impl::trace_begin(Impl::TraceCategory::parallel_scan, kernelPrefix.c_str(),
+                    devID);
+  Impl::perf_counters_begin_kernel(kernelPrefix.c_str());
 #ifdef KOKKOS_ENABLE_TUNING
   if (Kokkos::tune_internals()) {
     auto context_id = Experimental::get_new_context_id();
@@ -353,6 +393,8 @@ void beginParallelScan(const std::string& kernelPrefix, const uint32_t devID,
 }
 
 void endParallelScan(const uint64_t kernelID) {
+  Impl::perf_counters_end_kernel();
+  Impl::trace_end(Impl::TraceCategory::parallel_scan);
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::Yes,
       Experimental::current_callbacks.end_parallel_scan, kernelID);
@@ -369,6 +411,9 @@ void beginParallelReduce(const std::string& kernelPrefix, const uint32_t devID,
       Experimental::MayRequireGlobalFencing::Yes,
       Experimental::current_callbacks.begin_parallel_reduce,
       kernelPrefix.c_str(), devID, kernelID);
+  Impl::trace_begin(Impl::TraceCategory::parallel_reduce, kernelPrefix.c_str(),
+                    devID);
+  Impl::perf_counters_begin_kernel(kernelPrefix.c_str());
 #ifdef KOKKOS_ENABLE_TUNING
   if (Kokkos::tune_internals()) {
     auto context_id = Experimental::get_new_context_id();
@@ -384,6 +429,8 @@ void beginParallelReduce(const std::string& kernelPrefix, const uint32_t devID,
 }
 
 void endParallelReduce(const uint64_t kernelID) {
+  Impl::perf_counters_end_kernel();
+  Impl::trace_end(Impl::TraceCategory::parallel_reduce);
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::Yes,
       Experimental::current_callbacks.end_parallel_reduce, kernelID);
@@ -395,12 +442,14 @@ void endParallelReduce(const uint64_t kernelID) {
 }
 
 void pushRegion(const std::string& kName) {
+  Impl::trace_begin(Impl::TraceCategory::region, kName.c_str());
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::Yes,
       Experimental::current_callbacks.push_region, kName.c_str());
 }
 
 void popRegion() {
+  Impl::trace_end(Impl::TraceCategory::region);
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::Yes,
       Experimental::current_callbacks.pop_region);
@@ -426,6 +475,10 @@ void beginDeepCopy(const SpaceHandle dst_space, const std::string dst_label,
                    const void* dst_ptr, const SpaceHandle src_space,
                    const std::string src_label, const void* src_ptr,
                    const uint64_t size) {
+  if (Impl::trace_enabled()) {
+    Impl::trace_begin(Impl::TraceCategory::deep_copy,
+                      ("deep_copy " + dst_label + " <- " + src_label).c_str());
+  }
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::No,
       Experimental::current_callbacks.begin_deep_copy, dst_space,
@@ -448,6 +501,7 @@ void beginDeepCopy(const SpaceHandle dst_space, const std::string dst_label,
 }
 
 void endDeepCopy() {
+  Impl::trace_end(Impl::TraceCategory::deep_copy);
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::No,
       Experimental::current_callbacks.end_deep_copy);
@@ -462,6 +516,7 @@ void endDeepCopy() {
 
 void beginFence(const std::string name, const uint32_t deviceId,
                 uint64_t* handle) {
+  Impl::trace_begin(Impl::TraceCategory::fence, name.c_str(), deviceId);
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::No,
       Experimental::current_callbacks.begin_fence, name.c_str(), deviceId,
@@ -469,6 +524,7 @@ void beginFence(const std::string name, const uint32_t deviceId,
 }
 
 void endFence(const uint64_t handle) {
+  Impl::trace_end(Impl::TraceCategory::fence);
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::No,
       Experimental::current_callbacks.end_fence, handle);
@@ -500,6 +556,7 @@ void destroyProfileSection(const uint32_t secID) {
 }
 
 void markEvent(const std::string& eventName) {
+  Impl::trace_instant(eventName.c_str());
   Experimental::invoke_kokkosp_callback(
       Experimental::MayRequireGlobalFencing::No,
       Experimental::current_callbacks.profile_event, eventName.c_str());
@@ -791,6 +848,9 @@ void initialize(const std::string& profileLibrary) {
 }
 
 void finalize() {
+  Impl::finalize_trace();
+  Impl::finalize_perf_counters();
+
   // Make sure finalize calls happens only once
   static int is_finalized = 0;
   if (is_finalized) return;
@@ -42,6 +42,8 @@ struct InitArguments {
   PossiblyUnsetOption help = unset;
   std::string lib          = unset_string_option;
   std::string args         = unset_string_option;
+  std::string trace_file   = unset_string_option;
+  PossiblyUnsetOption perf_counters = unset;
 };
 
 namespace Impl {
@@ -0,0 +1,357 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_Profiling_PerfCounters.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(__linux__)
+#include <dirent.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cerrno>
+#define KOKKOS_IMPL_HAS_PERF_EVENT_OPEN
+#endif
+
+namespace Kokkos {
+
+// forward declaration
+bool show_warnings() noexcept;
+
+namespace Tools {
+namespace Impl {
+
+std::atomic<bool> g_perf_counters_enabled{false};
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr char const* perf_counter_names[num_perf_counters] = {
+    "cycles", "instructions", "LLC misses", "dTLB misses"};
+
+// Assumed size of the memory transaction caused by a last level cache miss
+constexpr double cache_line_bytes = 64.;
+
+struct ThreadCounters {
+  int tid;
+  std::array<int, num_perf_counters> fds;
+};
+
+struct OpenKernel {
+  std::string name;
+  clock_type::time_point start;
+  PerfCounterValues values;
+};
+
+std::vector<ThreadCounters> g_thread_counters;
+std::array<bool, num_perf_counters> g_available{};
+
+std::mutex g_kernels_mutex;
+std::unordered_map<std::string, KernelPerfCounters> g_kernels;
+
+thread_local std::vector<OpenKernel> t_open_kernels;
+
+#ifdef KOKKOS_IMPL_HAS_PERF_EVENT_OPEN
+perf_event_attr make_attr(PerfCounter counter) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size           = sizeof(attr);
+  attr.exclude_kernel = 1;
+  attr.exclude_hv     = 1;
+  attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  auto cache_miss = [](std::uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+           (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+  };
+  switch (counter) {
+    case perf_cycles:
+      attr.type   = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_CPU_CYCLES;
+      break;
+    case perf_instructions:
+      attr.type   = PERF_TYPE_HARDWARE;
+      attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+      break;
+    case perf_llc_misses:
+      attr.type   = PERF_TYPE_HW_CACHE;
+      attr.config = cache_miss(PERF_COUNT_HW_CACHE_LL);
+      break;
+    case perf_dtlb_misses:
+      attr.type   = PERF_TYPE_HW_CACHE;
+      attr.config = cache_miss(PERF_COUNT_HW_CACHE_DTLB);
+      break;
+    default: break;
+  }
+  return attr;
+}
+
+int open_counter(PerfCounter counter, int tid) {
+  auto attr = make_attr(counter);
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, tid, -1, -1,
+                                  PERF_FLAG_FD_CLOEXEC));
+}
+
+std::vector<int> process_threads() {
+  std::vector<int> tids;
+  DIR* dir = opendir("/proc/self/task");
+  if (dir == nullptr) {
+    tids.push_back(static_cast<int>(syscall(SYS_gettid)));
+    return tids;
+  }
+  while (auto* entry = readdir(dir)) {
+    if (entry->d_name[0] == '.') continue;
+    tids.push_back(std::atoi(entry->d_name));
+  }
+  closedir(dir);
+  return tids;
+}
+
+std::uint64_t read_counter(int fd) {
+  std::uint64_t data[3] = {0, 0, 0};
+  if (read(fd, data, sizeof(data)) != static_cast<ssize_t>(sizeof(data))) {
+    return 0;
+  }
+  // scale when the kernel multiplexed the counter
+  if (data[2] != 0 && data[2] < data[1]) {
+    return static_cast<std::uint64_t>(static_cast<double>(data[0]) *
+                                      static_cast<double>(data[1]) /
+                                      static_cast<double>(data[2]));
+  }
+  return data[0];
+}
+#endif
+
+PerfCounterValues read_counters() {
+  PerfCounterValues values{};
+#ifdef KOKKOS_IMPL_HAS_PERF_EVENT_OPEN
+  for (auto const& thread : g_thread_counters) {
+    for (int c = 0; c < num_perf_counters; ++c) {
+      if (thread.fds[c] >= 0) values[c] += read_counter(thread.fds[c]);
+    }
+  }
+#endif
+  return values;
+}
+
+double per_kilo(std::uint64_t events, std::uint64_t instructions) {
+  return instructions == 0 ? 0. : 1000. * events / instructions;
+}
+
+char const* classify(KernelPerfCounters const& kernel) {
+  if (!g_available[perf_cycles] || !g_available[perf_instructions] ||
+      kernel.values[perf_cycles] == 0) {
+    return "n/a";
+  }
+  double const ipc = static_cast<double>(kernel.values[perf_instructions]) /
+                     kernel.values[perf_cycles];
+  // Heuristic thresholds: more than ~10 last level misses per thousand
+  // instructions saturates memory bandwidth on most current host CPUs, an IPC
+  // below 0.7 without such traffic points at dependent loads, TLB walks or
+  // synchronization.
+  if (g_available[perf_llc_misses] &&
+      per_kilo(kernel.values[perf_llc_misses],
+               kernel.values[perf_instructions]) > 10.) {
+    return "bandwidth";
+  }
+  if (ipc < 0.7) return "latency";
+  return "compute";
+}
+
+}  // namespace
+
+bool initialize_perf_counters() {
+  if (perf_counters_enabled()) return true;
+  g_available = {};
+#ifdef KOKKOS_IMPL_HAS_PERF_EVENT_OPEN
+  int first_errno = 0;
+  for (int tid : process_threads()) {
+    ThreadCounters thread;
+    thread.tid = tid;
+    for (int c = 0; c < num_perf_counters; ++c) {
+      thread.fds[c] = open_counter(static_cast<PerfCounter>(c), tid);
+      if (thread.fds[c] >= 0) {
+        g_available[c] = true;
+      } else if (first_errno == 0) {
+        first_errno = errno;
+      }
+    }
+    g_thread_counters.push_back(thread);
+  }
+  bool const any_available =
+      std::any_of(g_available.begin(), g_available.end(),
+                  [](bool available) { return available; });
+  if (Kokkos::show_warnings() && first_errno != 0) {
+    std::cerr << "Warning: hardware performance counters";
+    if (any_available) {
+      std::cerr << " (";
+      bool first = true;
+      for (int c = 0; c < num_perf_counters; ++c) {
+        if (g_available[c]) continue;
+        std::cerr << (first ? "" : ", ") << perf_counter_names[c];
+        first = false;
+      }
+      std::cerr << ")";
+    }
+    std::cerr << " are not available: perf_event_open failed with '"
+              << std::strerror(first_errno) << "'."
+              << " Raised by Kokkos::initialize()." << std::endl;
+  }
+  if (!any_available) {
+    finalize_perf_counters();
+    return false;
+  }
+  g_perf_counters_enabled.store(true, std::memory_order_release);
+  return true;
+#else
+  if (Kokkos::show_warnings()) {
+    std::cerr << "Warning: hardware performance counters are only supported "
+                 "on Linux."
+              << " Raised by Kokkos::initialize()." << std::endl;
+  }
+  return false;
+#endif
+}
+
+void finalize_perf_counters() {
+  if (perf_counters_enabled()) {
+    g_perf_counters_enabled.store(false, std::memory_order_release);
+    print_perf_counters_summary(std::cout);
+  }
+#ifdef KOKKOS_IMPL_HAS_PERF_EVENT_OPEN
+  for (auto const& thread : g_thread_counters) {
+    for (int fd : thread.fds) {
+      if (fd >= 0) close(fd);
+    }
+  }
+#endif
+  g_thread_counters.clear();
+  std::lock_guard<std::mutex> lock(g_kernels_mutex);
+  g_kernels.clear();
+}
+
+std::array<bool, num_perf_counters> perf_counters_available() {
+  return g_available;
+}
+
+void perf_counters_begin_kernel(const char* name) {
+  if (!perf_counters_enabled()) return;
+  t_open_kernels.push_back({name, clock_type::now(), PerfCounterValues{}});
+  // read last so that the bookkeeping above is not counted
+  t_open_kernels.back().values = read_counters();
+}
+
+void perf_counters_end_kernel() {
+  if (!perf_counters_enabled() || t_open_kernels.empty()) return;
+  auto const values = read_counters();
+  auto const end    = clock_type::now();
+  auto& open        = t_open_kernels.back();
+  {
+    std::lock_guard<std::mutex> lock(g_kernels_mutex);
+    auto& kernel = g_kernels[open.name];
+    kernel.name  = open.name;
+    ++kernel.calls;
+    kernel.seconds += std::chrono::duration<double>(end - open.start).count();
+    for (int c = 0; c < num_perf_counters; ++c) {
+      kernel.values[c] += values[c] - open.values[c];
+    }
+  }
+  t_open_kernels.pop_back();
+}
+
+std::vector<KernelPerfCounters> perf_counters_by_kernel() {
+  std::vector<KernelPerfCounters> kernels;
+  {
+    std::lock_guard<std::mutex> lock(g_kernels_mutex);
+    for (auto const& kernel : g_kernels) kernels.push_back(kernel.second);
+  }
+  std::sort(kernels.begin(), kernels.end(),
+            [](KernelPerfCounters const& l, KernelPerfCounters const& r) {
+              return l.seconds > r.seconds;
+            });
+  return kernels;
+}
+
+void print_perf_counters_summary(std::ostream& out) {
+  auto const kernels = perf_counters_by_kernel();
+  if (kernels.empty()) return;
+  auto metric = [](double value, bool available) {
+    char buf[32];
+    if (available) {
+      std::snprintf(buf, sizeof(buf), "%.2f", value);
+    } else {
+      std::snprintf(buf, sizeof(buf), "n/a");
+    }
+    return std::string(buf);
+  };
+  bool const has_ipc =
+      g_available[perf_cycles] && g_available[perf_instructions];
+  bool const has_llc =
+      g_available[perf_llc_misses] && g_available[perf_instructions];
+  bool const has_dtlb =
+      g_available[perf_dtlb_misses] && g_available[perf_instructions];
+  char line[256];
+  out << "Kokkos hardware performance counters per kernel "
+         "(user space, all threads):\n";
+  std::snprintf(line, sizeof(line),
+                "%-40s %8s %11s %6s %9s %10s %9s %9s  %s\n", "kernel", "calls",
+                "time[s]", "IPC", "LLC MPKI", "est. GB/s", "instr/B",
+                "dTLB MPKI", "bound");
+  out << line;
+  for (auto const& kernel : kernels) {
+    auto const& v = kernel.values;
+    double const ipc =
+        v[perf_cycles] == 0
+            ? 0.
+            : static_cast<double>(v[perf_instructions]) / v[perf_cycles];
+    double const bytes = cache_line_bytes * v[perf_llc_misses];
+    double const gbps =
+        kernel.seconds == 0. ? 0. : bytes / kernel.seconds * 1.e-9;
+    double const intensity = bytes == 0. ? 0. : v[perf_instructions] / bytes;
+    std::string name       = kernel.name;
+    if (name.size() > 40) name = name.substr(0, 37) + "...";
+    std::snprintf(
+        line, sizeof(line), "%-40s %8llu %11.6f %6s %9s %10s %9s %9s  %s\n",
+        name.c_str(), static_cast<unsigned long long>(kernel.calls),
+        kernel.seconds, metric(ipc, has_ipc).c_str(),
+        metric(per_kilo(v[perf_llc_misses], v[perf_instructions]), has_llc)
+            .c_str(),
+        metric(gbps, g_available[perf_llc_misses]).c_str(),
+        metric(intensity, has_llc).c_str(),
+        metric(per_kilo(v[perf_dtlb_misses], v[perf_instructions]), has_dtlb)
+            .c_str(),
+        classify(kernel));
+    out << line;
+  }
+  out << std::flush;
+}
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
@@ -0,0 +1,88 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_KOKKOS_PROFILING_PERFCOUNTERS_HPP
+#define KOKKOS_IMPL_KOKKOS_PROFILING_PERFCOUNTERS_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+// Built-in hardware performance counter sampling per kernel.
+//
+// When enabled (--kokkos-tools-perf-counters or KOKKOS_TOOLS_PERF_COUNTERS),
+// user-space cycles, instructions, last level cache misses and data TLB
+// misses are counted with perf_event_open(2) on every thread of the process
+// that exists when the tools subsystem is initialized, i.e. including the
+// worker threads of the host backends.  The counters are read when a
+// parallel_for/reduce/scan begins and ends and the deltas are attributed to
+// the kernel label.  Kokkos::finalize() prints a summary classifying each
+// kernel as bandwidth, latency or compute bound.
+//
+// Attribution assumes one kernel in flight at a time: kernels that overlap
+// on different execution space instances see each other's events.  Counters
+// that can not be opened (non-Linux systems, containers without access to the
+// PMU, perf_event_paranoid > 2) are reported once and skipped.
+
+enum PerfCounter : int {
+  perf_cycles,
+  perf_instructions,
+  perf_llc_misses,
+  perf_dtlb_misses,
+  num_perf_counters
+};
+
+using PerfCounterValues = std::array<std::uint64_t, num_perf_counters>;
+
+struct KernelPerfCounters {
+  std::string name;
+  std::uint64_t calls = 0;
+  double seconds      = 0.;
+  PerfCounterValues values{};
+};
+
+extern std::atomic<bool> g_perf_counters_enabled;
+
+inline bool perf_counters_enabled() noexcept {
+  return g_perf_counters_enabled.load(std::memory_order_relaxed);
+}
+
+// Returns false when no counter could be opened
+bool initialize_perf_counters();
+void finalize_perf_counters();
+
+// Which of the counters could be opened
+std::array<bool, num_perf_counters> perf_counters_available();
+
+void perf_counters_begin_kernel(const char* name);
+void perf_counters_end_kernel();
+
+// Accumulated counters per kernel label, sorted by decreasing time
+std::vector<KernelPerfCounters> perf_counters_by_kernel();
+void print_perf_counters_summary(std::ostream& out);
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,397 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#endif
+
+#include <impl/Kokkos_Profiling_Trace.hpp>
+#include <impl/Kokkos_Profiling_Interface.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+std::atomic<bool> g_trace_enabled{false};
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr std::size_t trace_name_length = 112;
+// Must be a power of two
+constexpr std::uint64_t trace_buffer_capacity = 4096;
+// Wake the writer thread early once a buffer is filled beyond this point
+constexpr std::uint64_t trace_buffer_flush_threshold =
+    trace_buffer_capacity / 2;
+constexpr auto trace_flush_period = std::chrono::milliseconds(50);
+
+constexpr std::uint64_t instant_event_duration = ~std::uint64_t(0);
+
+struct TraceEvent {
+  std::uint64_t start_ns;
+  std::uint64_t duration_ns;
+  std::uint32_t device_id;
+  TraceCategory category;
+  bool on_instance_track;
+  char name[trace_name_length];
+};
+
+struct OpenTraceEvent {
+  TraceCategory category;
+  bool on_instance_track;
+  std::uint32_t device_id;
+  std::uint64_t start_ns;
+  std::string name;
+};
+
+// Single producer (the owning host thread), single consumer (the writer)
+struct alignas(64) TraceBuffer {
+  std::atomic<std::uint64_t> head{0};
+  char pad0[64 - sizeof(std::atomic<std::uint64_t>)];
+  std::atomic<std::uint64_t> tail{0};
+  std::atomic<std::uint64_t> dropped{0};
+  std::uint32_t host_thread = 0;
+  std::vector<TraceEvent> events;
+  // Only touched by the owning thread
+  std::vector<OpenTraceEvent> open_events;
+
+  explicit TraceBuffer(std::uint32_t thread_index)
+      : host_thread(thread_index), events(trace_buffer_capacity) {}
+};
+
+struct TraceWriter {
+  std::ofstream out;
+  clock_type::time_point epoch;
+  bool first_event = true;
+
+  std::mutex buffers_mutex;
+  std::vector<std::unique_ptr<TraceBuffer>> buffers;
+
+  std::mutex wake_mutex;
+  std::condition_variable wake;
+  bool stop = false;
+  std::thread flusher;
+
+  // Tracks seen so far, written as metadata at finalize
+  std::set<std::pair<std::uint32_t, std::uint32_t>> tracks;
+};
+
+TraceWriter* g_writer = nullptr;
+// Bumped on every initialize so buffers of a previous session are not reused
+std::atomic<std::uint64_t> g_trace_session{0};
+
+thread_local TraceBuffer* t_buffer          = nullptr;
+thread_local std::uint64_t t_buffer_session = 0;
+
+std::uint64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() -
+                                                              g_writer->epoch)
+      .count();
+}
+
+TraceBuffer& thread_buffer() {
+  auto const session = g_trace_session.load(std::memory_order_acquire);
+  if (t_buffer == nullptr || t_buffer_session != session) {
+    std::lock_guard<std::mutex> lock(g_writer->buffers_mutex);
+    auto const index = static_cast<std::uint32_t>(g_writer->buffers.size());
+    g_writer->buffers.push_back(std::make_unique<TraceBuffer>(index));
+    t_buffer         = g_writer->buffers.back().get();
+    t_buffer_session = session;
+  }
+  return *t_buffer;
+}
+
+void push_event(TraceBuffer& buffer, TraceCategory category,
+                bool on_instance_track, std::uint32_t device_id,
+                std::uint64_t start_ns, std::uint64_t duration_ns,
+                const char* name) {
+  auto const head = buffer.head.load(std::memory_order_relaxed);
+  auto const tail = buffer.tail.load(std::memory_order_acquire);
+  if (head - tail >= trace_buffer_capacity) {
+    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    g_writer->wake.notify_one();
+    return;
+  }
+  auto& event = buffer.events[head & (trace_buffer_capacity - 1)];
+  event.start_ns          = start_ns;
+  event.duration_ns       = duration_ns;
+  event.device_id         = device_id;
+  event.category          = category;
+  event.on_instance_track = on_instance_track;
+  std::strncpy(event.name, name, trace_name_length - 1);
+  event.name[trace_name_length - 1] = '\0';
+  buffer.head.store(head + 1, std::memory_order_release);
+  if (head - tail + 1 == trace_buffer_flush_threshold) {
+    g_writer->wake.notify_one();
+  }
+}
+
+char const* category_name(TraceCategory category) {
+  switch (category) {
+    case TraceCategory::parallel_for: return "parallel_for";
+    case TraceCategory::parallel_reduce: return "parallel_reduce";
+    case TraceCategory::parallel_scan: return "parallel_scan";
+    case TraceCategory::fence: return "fence";
+    case TraceCategory::region: return "region";
+    case TraceCategory::deep_copy: return "deep_copy";
+    case TraceCategory::profile_event: return "profile_event";
+  }
+  return "unknown";
+}
+
+char const* device_type_name(Experimental::DeviceType type) {
+  using Experimental::DeviceType;
+  switch (type) {
+    case DeviceType::Serial: return "Serial";
+    case DeviceType::OpenMP: return "OpenMP";
+    case DeviceType::Cuda: return "Cuda";
+    case DeviceType::HIP: return "HIP";
+    case DeviceType::OpenMPTarget: return "OpenMPTarget";
+    case DeviceType::HPX: return "HPX";
+    case DeviceType::Threads: return "Threads";
+    case DeviceType::SYCL: return "SYCL";
+    case DeviceType::OpenACC: return "OpenACC";
+    case DeviceType::Unknown: return "Unknown";
+  }
+  return "Unknown";
+}
+
+// Process 0 holds the host thread tracks, execution space types are mapped to
+// processes 1, 2, ... and their instances to threads within that process.
+std::pair<std::uint32_t, std::uint32_t> track_of(const TraceEvent& event,
+                                                 std::uint32_t host_thread) {
+  if (!event.on_instance_track) return {0, host_thread};
+  auto const id = Experimental::identifier_from_devid(event.device_id);
+  return {static_cast<std::uint32_t>(id.type) + 1,
+          (id.device_id << Experimental::num_instance_bits) + id.instance_id};
+}
+
+void write_escaped(std::ostream& out, const char* str) {
+  for (; *str != '\0'; ++str) {
+    auto const c = static_cast<unsigned char>(*str);
+    if (c == '"' || c == '\\') {
+      out << '\\' << *str;
+    } else if (c < 0x20) {
+      char code[8];
+      std::snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+      out << code;
+    } else {
+      out << *str;
+    }
+  }
+}
+
+void write_timestamp(std::ostream& out, std::uint64_t ns) {
+  // Chrome trace timestamps are in microseconds
+  char buf[32];
+  std::snprintf(buf, sizeof(buf), "%llu.%03u",
+                static_cast<unsigned long long>(ns / 1000),
+                static_cast<unsigned>(ns % 1000));
+  out << buf;
+}
+
+void begin_record(TraceWriter& writer) {
+  if (!writer.first_event) writer.out << ",\n";
+  writer.first_event = false;
+}
+
+void write_event(TraceWriter& writer, const TraceEvent& event,
+                 std::uint32_t host_thread) {
+  auto const track = track_of(event, host_thread);
+  writer.tracks.insert(track);
+  begin_record(writer);
+  auto& out = writer.out;
+  out << "{\"name\":\"";
+  write_escaped(out, event.name);
+  out << "\",\"cat\":\"" << category_name(event.category) << "\",";
+  if (event.duration_ns == instant_event_duration) {
+    out << "\"ph\":\"i\",\"s\":\"t\",";
+  } else {
+    out << "\"ph\":\"X\",\"dur\":";
+    write_timestamp(out, event.duration_ns);
+    out << ',';
+  }
+  out << "\"ts\":";
+  write_timestamp(out, event.start_ns);
+  out << ",\"pid\":" << track.first << ",\"tid\":" << track.second;
+  if (event.on_instance_track) {
+    out << ",\"args\":{\"host_thread\":" << host_thread << '}';
+  }
+  out << '}';
+}
+
+// Only ever called by one thread at a time: the flusher thread while it runs,
+// and the finalizing thread once the flusher has been joined.
+void drain_buffers(TraceWriter& writer) {
+  std::vector<TraceBuffer*> buffers;
+  {
+    std::lock_guard<std::mutex> lock(writer.buffers_mutex);
+    for (auto& buffer : writer.buffers) buffers.push_back(buffer.get());
+  }
+  for (auto* buffer : buffers) {
+    auto tail       = buffer->tail.load(std::memory_order_relaxed);
+    auto const head = buffer->head.load(std::memory_order_acquire);
+    for (; tail != head; ++tail) {
+      write_event(writer, buffer->events[tail & (trace_buffer_capacity - 1)],
+                  buffer->host_thread);
+    }
+    buffer->tail.store(tail, std::memory_order_release);
+  }
+}
+
+void write_metadata(TraceWriter& writer) {
+  std::uint64_t dropped = 0;
+  for (auto& buffer : writer.buffers) {
+    dropped += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  std::set<std::uint32_t> processes;
+  for (auto const& track : writer.tracks) {
+    auto& out = writer.out;
+    if (processes.insert(track.first).second) {
+      begin_record(writer);
+      out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << track.first
+          << ",\"args\":{\"name\":\"";
+      if (track.first == 0) {
+        out << "Host threads";
+      } else {
+        out << "Kokkos::"
+            << device_type_name(Experimental::devicetype_from_uint32t(
+                   track.first - 1));
+      }
+      out << "\"}}";
+    }
+    begin_record(writer);
+    out << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << track.first
+        << ",\"tid\":" << track.second << ",\"args\":{\"name\":\"";
+    if (track.first == 0) {
+      out << "host thread " << track.second;
+    } else {
+      constexpr std::uint32_t instance_mask =
+          (std::uint32_t(1) << Experimental::num_instance_bits) - 1;
+      if ((track.second & instance_mask) == instance_mask) {
+        out << "deep_copy resource";
+      } else {
+        out << "instance " << (track.second & instance_mask);
+      }
+    }
+    out << "\"}}";
+  }
+  writer.out << "],\n\"displayTimeUnit\":\"ns\",\n\"otherData\":{"
+             << "\"producer\":\"Kokkos\",\"dropped_events\":" << dropped
+             << "}}\n";
+}
+
+void flusher_loop(TraceWriter* writer) {
+  std::unique_lock<std::mutex> lock(writer->wake_mutex);
+  while (!writer->stop) {
+    writer->wake.wait_for(lock, trace_flush_period);
+    if (writer->stop) break;
+    lock.unlock();
+    drain_buffers(*writer);
+    lock.lock();
+  }
+}
+
+}  // namespace
+
+void initialize_trace(const std::string& file_name) {
+  if (g_writer != nullptr || file_name.empty()) return;
+  auto writer = std::make_unique<TraceWriter>();
+  writer->out.open(file_name);
+  if (!writer->out) {
+    std::cerr << "Warning: unable to open trace file '" << file_name
+              << "', timeline tracing is disabled."
+              << " Raised by Kokkos::initialize()." << std::endl;
+    return;
+  }
+  writer->out << "{\"traceEvents\":[\n";
+  writer->epoch = clock_type::now();
+  g_writer      = writer.release();
+  g_trace_session.fetch_add(1, std::memory_order_release);
+  g_writer->flusher = std::thread(flusher_loop, g_writer);
+  g_trace_enabled.store(true, std::memory_order_release);
+}
+
+void finalize_trace() {
+  if (g_writer == nullptr) return;
+  g_trace_enabled.store(false, std::memory_order_release);
+  {
+    std::lock_guard<std::mutex> lock(g_writer->wake_mutex);
+    g_writer->stop = true;
+  }
+  g_writer->wake.notify_one();
+  g_writer->flusher.join();
+  drain_buffers(*g_writer);
+  write_metadata(*g_writer);
+  g_writer->out.close();
+  delete g_writer;
+  g_writer = nullptr;
+}
+
+void trace_begin(TraceCategory category, const char* name,
+                 std::uint32_t device_id) {
+  if (!trace_enabled()) return;
+  auto& buffer = thread_buffer();
+  buffer.open_events.push_back({category, true, device_id, now_ns(), name});
+}
+
+void trace_begin(TraceCategory category, const char* name) {
+  if (!trace_enabled()) return;
+  auto& buffer = thread_buffer();
+  buffer.open_events.push_back({category, false, 0, now_ns(), name});
+}
+
+void trace_end(TraceCategory category) {
+  if (!trace_enabled()) return;
+  auto const end = now_ns();
+  auto& buffer   = thread_buffer();
+  auto& open     = buffer.open_events;
+  // Events of one category are properly nested on a given host thread, but
+  // e.g. a region may be popped while a fence it contains is still open.
+  for (auto it = open.rbegin(); it != open.rend(); ++it) {
+    if (it->category == category) {
+      push_event(buffer, category, it->on_instance_track, it->device_id,
+                 it->start_ns, end - it->start_ns, it->name.c_str());
+      open.erase(std::next(it).base());
+      return;
+    }
+  }
+}
+
+void trace_instant(const char* name) {
+  if (!trace_enabled()) return;
+  auto& buffer = thread_buffer();
+  push_event(buffer, TraceCategory::profile_event, false, 0, now_ns(),
+             instant_event_duration, name);
+}
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
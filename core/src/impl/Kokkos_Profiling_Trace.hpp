@@ -0,0 +1,74 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_IMPL_KOKKOS_PROFILING_TRACE_HPP
+#define KOKKOS_IMPL_KOKKOS_PROFILING_TRACE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace Kokkos {
+namespace Tools {
+namespace Impl {
+
+// Built-in timeline writer for the Kokkos::Tools event stream.
+//
+// When enabled (--kokkos-tools-trace-file=FILE or KOKKOS_TOOLS_TRACE_FILE),
+// kernel, fence, region and deep copy begin/end events are turned into
+// Chrome Trace Event "complete" events.  Each host thread records into its own
+// single-producer ring buffer, a background thread drains the buffers into
+// FILE, and the remaining events are flushed at Kokkos::finalize().
+// The resulting JSON can be opened with chrome://tracing or ui.perfetto.dev.
+//
+// Kernels and fences are placed on one track per execution space instance
+// (decoded from the device id passed to the hooks), regions, deep copies and
+// markers on one track per host thread.  A full ring buffer drops events
+// rather than blocking the submitting thread; the number of dropped events is
+// recorded in the trace metadata.
+
+enum class TraceCategory : std::uint8_t {
+  parallel_for,
+  parallel_reduce,
+  parallel_scan,
+  fence,
+  region,
+  deep_copy,
+  profile_event
+};
+
+extern std::atomic<bool> g_trace_enabled;
+
+inline bool trace_enabled() noexcept {
+  return g_trace_enabled.load(std::memory_order_relaxed);
+}
+
+void initialize_trace(const std::string& file_name);
+void finalize_trace();
+
+// Kernels and fences carry the device id of the instance they target.
+void trace_begin(TraceCategory category, const char* name,
+                 std::uint32_t device_id);
+// Regions and deep copies are attributed to the calling host thread.
+void trace_begin(TraceCategory category, const char* name);
+void trace_end(TraceCategory category);
+void trace_instant(const char* name);
+
+}  // namespace Impl
+}  // namespace Tools
+}  // namespace Kokkos
+
+#endif
@@ -20,11 +20,52 @@
 
 #include <Kokkos_Core.hpp>
 #include <iomanip>
+#include <mutex>
 
 namespace Kokkos {
 namespace Impl {
 
 #ifdef KOKKOS_ENABLE_DEBUG
+namespace {
+
+// Live records are kept in intrusive doubly-linked lists, sharded by record
+// address, so that threads allocating and deallocating concurrently only
+// contend when their records hash to the same shard.  Queries over the set of
+// records of a memory space lock every shard and merge the lists.
+
+constexpr int record_shard_count = 64;
+
+struct alignas(64) RecordShard {
+  std::mutex mutex;
+  SharedAllocationRecord<void, void>* head = nullptr;
+};
+
+RecordShard g_record_shards[record_shard_count];
+
+RecordShard& record_shard(const SharedAllocationRecord<void, void>* rec) {
+  // Fibonacci hashing of the address, records are heap allocated
+  const std::uint64_t bits = reinterpret_cast<std::uintptr_t>(rec);
+  return g_record_shards[(bits * 0x9E3779B97F4A7C15ull) >> 58];
+}
+static_assert(record_shard_count == 64, "record_shard() assumes 64 shards");
+
+// Lock all shards, always in the same order
+class RecordRegistryLock {
+ public:
+  RecordRegistryLock() {
+    for (auto& shard : g_record_shards) shard.mutex.lock();
+  }
+  ~RecordRegistryLock() {
+    for (int i = record_shard_count; 0 < i--;) {
+      g_record_shards[i].mutex.unlock();
+    }
+  }
+  RecordRegistryLock(const RecordRegistryLock&) = delete;
+  RecordRegistryLock& operator=(const RecordRegistryLock&) = delete;
+};
+
+}  // namespace
+
 bool SharedAllocationRecord<void, void>::is_sane(
     SharedAllocationRecord<void, void>* arg_record) {
   SharedAllocationRecord* const root =
@@ -33,60 +74,49 @@ bool SharedAllocationRecord<void, void>::is_sane(
   bool ok = root != nullptr && root->use_count() == 0;
 
   if (ok) {
-    SharedAllocationRecord* root_next             = nullptr;
-    static constexpr SharedAllocationRecord* zero = nullptr;
-    // Lock the list:
-    while ((root_next = Kokkos::atomic_exchange(&root->m_next, zero)) ==
-           nullptr)
-      ;
-
-    for (SharedAllocationRecord* rec = root_next; ok && rec != root;
-         rec                         = rec->m_next) {
-      const bool ok_non_null =
-          rec && rec->m_prev && (rec == root || rec->m_next);
-      const bool ok_root = ok_non_null && rec->m_root == root;
-      const bool ok_prev_next =
-          ok_non_null &&
-          (rec->m_prev != root ? rec->m_prev->m_next == rec : root_next == rec);
-      const bool ok_next_prev = ok_non_null && rec->m_next->m_prev == rec;
-      const bool ok_count     = ok_non_null && 0 <= rec->use_count();
-
-      ok = ok_root && ok_prev_next && ok_next_prev && ok_count;
-
-      if (!ok) {
-        // Formatting dependent on sizeof(uintptr_t)
-        const char* format_string;
-
-        if (sizeof(uintptr_t) == sizeof(unsigned long)) {
-          format_string =
-              "Kokkos::Impl::SharedAllocationRecord failed is_sane: "
-              "rec(0x%.12lx){ m_count(%d) m_root(0x%.12lx) m_next(0x%.12lx) "
-              "m_prev(0x%.12lx) m_next->m_prev(0x%.12lx) "
-              "m_prev->m_next(0x%.12lx) }\n";
-        } else if (sizeof(uintptr_t) == sizeof(unsigned long long)) {
-          format_string =
-              "Kokkos::Impl::SharedAllocationRecord failed is_sane: "
-              "rec(0x%.12llx){ m_count(%d) m_root(0x%.12llx) m_next(0x%.12llx) "
-              "m_prev(0x%.12llx) m_next->m_prev(0x%.12llx) "
-              "m_prev->m_next(0x%.12llx) }\n";
+    RecordRegistryLock lock;
+
+    for (auto& shard : g_record_shards) {
+      for (SharedAllocationRecord* rec = shard.head; ok && rec;
+           rec                         = rec->m_next) {
+        const bool ok_root      = rec->m_root != nullptr;
+        const bool ok_prev_next = rec->m_prev ? rec->m_prev->m_next == rec
+                                              : shard.head == rec;
+        const bool ok_next_prev = !rec->m_next || rec->m_next->m_prev == rec;
+        const bool ok_count     = 0 <= rec->use_count();
+
+        ok = ok_root && ok_prev_next && ok_next_prev && ok_count;
+
+        if (!ok) {
+          // Formatting dependent on sizeof(uintptr_t)
+          const char* format_string;
+
+          if (sizeof(uintptr_t) == sizeof(unsigned long)) {
+            format_string =
+                "Kokkos::Impl::SharedAllocationRecord failed is_sane: "
+                "rec(0x%.12lx){ m_count(%d) m_root(0x%.12lx) m_next(0x%.12lx) "
+                "m_prev(0x%.12lx) m_next->m_prev(0x%.12lx) "
+                "m_prev->m_next(0x%.12lx) }\n";
+          } else if (sizeof(uintptr_t) == sizeof(unsigned long long)) {
+            format_string =
+                "Kokkos::Impl::SharedAllocationRecord failed is_sane: "
+                "rec(0x%.12llx){ m_count(%d) m_root(0x%.12llx) "
+                "m_next(0x%.12llx) m_prev(0x%.12llx) m_next->m_prev(0x%.12llx) "
+                "m_prev->m_next(0x%.12llx) }\n";
+          }
+
+          fprintf(stderr, format_string, reinterpret_cast<uintptr_t>(rec),
+                  rec->use_count(), reinterpret_cast<uintptr_t>(rec->m_root),
+                  reinterpret_cast<uintptr_t>(rec->m_next),
+                  reinterpret_cast<uintptr_t>(rec->m_prev),
+                  reinterpret_cast<uintptr_t>(
+                      rec->m_next != nullptr ? rec->m_next->m_prev : nullptr),
+                  reinterpret_cast<uintptr_t>(rec->m_prev != nullptr
+                                                  ? rec->m_prev->m_next
+                                                  : shard.head));
         }
-
-        fprintf(stderr, format_string, reinterpret_cast<uintptr_t>(rec),
-                rec->use_count(), reinterpret_cast<uintptr_t>(rec->m_root),
-                reinterpret_cast<uintptr_t>(rec->m_next),
-                reinterpret_cast<uintptr_t>(rec->m_prev),
-                reinterpret_cast<uintptr_t>(
-                    rec->m_next != nullptr ? rec->m_next->m_prev : nullptr),
-                reinterpret_cast<uintptr_t>(rec->m_prev != rec->m_root
-                                                ? rec->m_prev->m_next
-                                                : root_next));
       }
     }
-
-    if (nullptr != Kokkos::atomic_exchange(&root->m_next, root_next)) {
-      Kokkos::Impl::throw_runtime_exception(
-          "Kokkos::Impl::SharedAllocationRecord failed is_sane unlocking");
-    }
   }
   return ok;
 }
@@ -106,31 +136,27 @@ bool SharedAllocationRecord<void, void>::is_sane(
 SharedAllocationRecord<void, void>* SharedAllocationRecord<void, void>::find(
     SharedAllocationRecord<void, void>* const arg_root,
     void* const arg_data_ptr) {
-  SharedAllocationRecord* root_next             = nullptr;
-  static constexpr SharedAllocationRecord* zero = nullptr;
-
-  // Lock the list:
-  while ((root_next = Kokkos::atomic_exchange(&arg_root->m_next, zero)) ==
-         nullptr)
-    ;
+  RecordRegistryLock lock;
 
   // Iterate searching for the record with this data pointer
-
-  SharedAllocationRecord* r = root_next;
-
-  while ((r != arg_root) && (r->data() != arg_data_ptr)) {
-    r = r->m_next;
+  for (auto& shard : g_record_shards) {
+    for (SharedAllocationRecord* r = shard.head; r; r = r->m_next) {
+      if (r->m_root == arg_root && r->data() == arg_data_ptr) return r;
+    }
   }
+  return nullptr;
+}
 
-  if (r == arg_root) {
-    r = nullptr;
-  }
+void SharedAllocationRecord<void, void>::for_each_record(
+    const SharedAllocationRecord<void, void>* const root,
+    void (*f)(const SharedAllocationRecord<void, void>*, void*), void* arg) {
+  RecordRegistryLock lock;
 
-  if (nullptr != Kokkos::atomic_exchange(&arg_root->m_next, root_next)) {
-    Kokkos::Impl::throw_runtime_exception(
-        "Kokkos::Impl::SharedAllocationRecord failed locking/unlocking");
+  for (auto& shard : g_record_shards) {
+    for (const SharedAllocationRecord* r = shard.head; r; r = r->m_next) {
+      if (r->m_root == root) (*f)(r, arg);
+    }
   }
-  return r;
 }
 #else
 SharedAllocationRecord<void, void>* SharedAllocationRecord<void, void>::find(
@@ -141,6 +167,14 @@ SharedAllocationRecord<void, void>* SharedAllocationRecord<void, void>::find(
       "enabled");
   return nullptr;
 }
+
+void SharedAllocationRecord<void, void>::for_each_record(
+    const SharedAllocationRecord<void, void>* const,
+    void (*)(const SharedAllocationRecord<void, void>*, void*), void*) {
+  Kokkos::Impl::throw_runtime_exception(
+      "Kokkos::Impl::SharedAllocationRecord::for_each_record only works with "
+      "KOKKOS_ENABLE_DEBUG enabled");
+}
 #endif
 
 /**\brief  Construct and insert into 'arg_root' tracking set.
@@ -167,28 +201,18 @@ SharedAllocationRecord<void, void>::SharedAllocationRecord(
       m_label(label) {
   if (nullptr != arg_alloc_ptr) {
 #ifdef KOKKOS_ENABLE_DEBUG
-    // Insert into the root double-linked list for tracking
+    // Insert at the head of this record's shard for tracking
     //
-    // before:  arg_root->m_next == next ; next->m_prev == arg_root
-    // after:   arg_root->m_next == this ; this->m_prev == arg_root ;
+    // before:  shard.head == next ; next->m_prev == nullptr
+    // after:   shard.head == this ; this->m_prev == nullptr ;
     //              this->m_next == next ; next->m_prev == this
 
-    m_prev                                        = m_root;
-    static constexpr SharedAllocationRecord* zero = nullptr;
+    RecordShard& shard = record_shard(this);
+    std::lock_guard<std::mutex> lock(shard.mutex);
 
-    // Read root->m_next and lock by setting to nullptr
-    while ((m_next = Kokkos::atomic_exchange(&m_root->m_next, zero)) == nullptr)
-      ;
-
-    m_next->m_prev = this;
-
-    // memory fence before completing insertion into linked list
-    Kokkos::memory_fence();
-
-    if (nullptr != Kokkos::atomic_exchange(&m_root->m_next, this)) {
-      Kokkos::Impl::throw_runtime_exception(
-          "Kokkos::Impl::SharedAllocationRecord failed locking/unlocking");
-    }
+    m_next = shard.head;
+    if (m_next) m_next->m_prev = this;
+    shard.head = this;
 #endif
 
   } else {
@@ -227,35 +251,20 @@ SharedAllocationRecord<void, void>* SharedAllocationRecord<
     //
     // after:   arg_record->m_prev->m_next == arg_record->m_next  &&
     //          arg_record->m_next->m_prev == arg_record->m_prev
-
-    SharedAllocationRecord* root_next             = nullptr;
-    static constexpr SharedAllocationRecord* zero = nullptr;
-
-    // Lock the list:
-    while ((root_next = Kokkos::atomic_exchange(&arg_record->m_root->m_next,
-                                                zero)) == nullptr)
-      ;
-    // We need a memory_fence() here so that the following update
-    // is properly sequenced
-    Kokkos::memory_fence();
-
-    arg_record->m_next->m_prev = arg_record->m_prev;
-
-    if (root_next != arg_record) {
-      arg_record->m_prev->m_next = arg_record->m_next;
-    } else {
-      // before:  arg_record->m_root == arg_record->m_prev
-      // after:   arg_record->m_root == arg_record->m_next
-      root_next = arg_record->m_next;
-    }
-
-    Kokkos::memory_fence();
-
-    // Unlock the list:
-    if (nullptr !=
-        Kokkos::atomic_exchange(&arg_record->m_root->m_next, root_next)) {
-      Kokkos::Impl::throw_runtime_exception(
-          "Kokkos::Impl::SharedAllocationRecord failed decrement unlocking");
+    //
+    // where a null m_prev stands for the head of the shard.
+    {
+      RecordShard& shard = record_shard(arg_record);
+      std::lock_guard<std::mutex> lock(shard.mutex);
+
+      if (arg_record->m_prev) {
+        arg_record->m_prev->m_next = arg_record->m_next;
+      } else {
+        shard.head = arg_record->m_next;
+      }
+      if (arg_record->m_next) {
+        arg_record->m_next->m_prev = arg_record->m_prev;
+      }
     }
 
     arg_record->m_next = nullptr;
@@ -282,30 +291,27 @@ SharedAllocationRecord<void, void>* SharedAllocationRecord<
 void SharedAllocationRecord<void, void>::print_host_accessible_records(
     std::ostream& s, const char* const space_name,
     const SharedAllocationRecord* const root, const bool detail) {
-  // Print every node except the root, which does not represent an actual
-  // allocation.
-  const SharedAllocationRecord<void, void>* r = root->m_next;
-
+  // The root does not represent an actual allocation and is not linked.
   std::ios_base::fmtflags saved_flags = s.flags();
 #define KOKKOS_PAD_HEX(ptr)                              \
   "0x" << std::hex << std::setw(12) << std::setfill('0') \
        << reinterpret_cast<uintptr_t>(ptr)
-  if (detail) {
-    while (r != root) {
-      s << space_name << " addr( " << KOKKOS_PAD_HEX(r) << " ) list ( "
-        << KOKKOS_PAD_HEX(r->m_prev) << ' ' << KOKKOS_PAD_HEX(r->m_next)
-        << " ) extent[ " << KOKKOS_PAD_HEX(r->m_alloc_ptr) << " + " << std::dec
-        << std::setw(8) << r->m_alloc_size << " ] count(" << r->use_count()
-        << ") dealloc(" << KOKKOS_PAD_HEX(r->m_dealloc) << ") "
-        << r->m_alloc_ptr->m_label << '\n';
-
-      r = r->m_next;
-    }
-  } else {
-    while (r != root) {
-      s << space_name << " [ " << KOKKOS_PAD_HEX(r->data()) << " + " << std::dec
-        << r->size() << " ] " << r->m_alloc_ptr->m_label << '\n';
-      r = r->m_next;
+  RecordRegistryLock lock;
+  for (auto& shard : g_record_shards) {
+    for (const SharedAllocationRecord* r = shard.head; r; r = r->m_next) {
+      if (r->m_root != root) continue;
+      if (detail) {
+        s << space_name << " addr( " << KOKKOS_PAD_HEX(r) << " ) list ( "
+          << KOKKOS_PAD_HEX(r->m_prev) << ' ' << KOKKOS_PAD_HEX(r->m_next)
+          << " ) extent[ " << KOKKOS_PAD_HEX(r->m_alloc_ptr) << " + "
+          << std::dec << std::setw(8) << r->m_alloc_size << " ] count("
+          << r->use_count() << ") dealloc(" << KOKKOS_PAD_HEX(r->m_dealloc)
+          << ") " << r->m_alloc_ptr->m_label << '\n';
+      } else {
+        s << space_name << " [ " << KOKKOS_PAD_HEX(r->data()) << " + "
+          << std::dec << r->size() << " ] " << r->m_alloc_ptr->m_label
+          << '\n';
+      }
     }
   }
 #undef KOKKOS_PAD_HEX
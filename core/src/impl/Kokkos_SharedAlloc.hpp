@@ -91,6 +91,8 @@ class SharedAllocationRecord<void, void> {
   size_t const m_alloc_size;
   function_type const m_dealloc;
 #ifdef KOKKOS_ENABLE_DEBUG
+  // Live records are linked into one of several lists sharded by record
+  // address, see Kokkos_SharedAlloc.cpp.  Root records are not linked.
   SharedAllocationRecord* const m_root;
   SharedAllocationRecord* m_prev;
   SharedAllocationRecord* m_next;
@@ -189,6 +191,14 @@ class SharedAllocationRecord<void, void> {
    */
   static bool is_sane(SharedAllocationRecord*);
 
+  /*  Call 'f(record, arg)' for every record of the set rooted in 'root'.
+   * Insertion and removal of records block until the iteration is complete,
+   * so 'f' must not allocate or deallocate tracked memory.
+   */
+  static void for_each_record(const SharedAllocationRecord* const root,
+                              void (*f)(const SharedAllocationRecord*, void*),
+                              void* arg);
+
   /*  Print host-accessible records */
   static void print_host_accessible_records(
       std::ostream&, const char* const space_name,
@@ -506,6 +516,34 @@ union SharedAllocationTracker {
 #undef KOKKOS_IMPL_SHARED_ALLOCATION_TRACKER_DECREMENT
 };
 
+/** \brief  Disable shared allocation tracking on the calling host thread
+ *          for the lifetime of the guard and restore the previous state on
+ *          destruction.
+ *
+ *  The host backends hold one of these on every thread executing a parallel
+ *  region so that View copies made inside the functor (subviews, Views passed
+ *  by value, ...) do not touch the shared reference count, the same way View
+ *  copies behave in device code.  Guards nest.
+ */
+class SharedAllocationDisableTrackingGuard {
+  int m_was_enabled;
+
+ public:
+  SharedAllocationDisableTrackingGuard()
+      : m_was_enabled(SharedAllocationRecord<void, void>::tracking_enabled()) {
+    SharedAllocationRecord<void, void>::tracking_disable();
+  }
+
+  ~SharedAllocationDisableTrackingGuard() {
+    if (m_was_enabled) SharedAllocationRecord<void, void>::tracking_enable();
+  }
+
+  SharedAllocationDisableTrackingGuard(
+      const SharedAllocationDisableTrackingGuard&) = delete;
+  SharedAllocationDisableTrackingGuard& operator=(
+      const SharedAllocationDisableTrackingGuard&) = delete;
+};
+
 } /* namespace Impl */
 } /* namespace Kokkos */
 #endif
@@ -27,6 +27,7 @@
 #include <cstring>
 #include <ostream>
 #include <string>
+#include <vector>
 
 namespace Kokkos {
 namespace Impl {
@@ -145,24 +146,40 @@ void HostInaccessibleSharedAllocationRecordCommon<MemorySpace>::print_records(
   (void)s;
   (void)detail;
 #ifdef KOKKOS_ENABLE_DEBUG
-  SharedAllocationRecord<void, void>* r = &derived_t::s_root_record;
+  // Copy what is printed while the registry is locked; the headers live in
+  // MemorySpace and are fetched afterwards since that requires a fence.
+  struct RecordInfo {
+    const record_base_t* record;
+    const record_base_t* prev;
+    const record_base_t* next;
+    SharedAllocationHeader* alloc_ptr;
+    size_t alloc_size;
+    int count;
+    typename record_base_t::function_type dealloc;
+  };
+  std::vector<RecordInfo> records;
+
+  record_base_t::for_each_record(
+      &derived_t::s_root_record,
+      [](const record_base_t* r, void* arg) {
+        static_cast<std::vector<RecordInfo>*>(arg)->push_back(
+            {r, r->m_prev, r->m_next, r->m_alloc_ptr, r->m_alloc_size,
+             r->use_count(), r->m_dealloc});
+      },
+      &records);
 
   char buffer[256];
 
   SharedAllocationHeader head;
 
-  if (detail) {
-    do {
-      if (r->m_alloc_ptr) {
-        Kokkos::Impl::DeepCopy<HostSpace, MemorySpace>(
-            &head, r->m_alloc_ptr, sizeof(SharedAllocationHeader));
-        Kokkos::fence(
-            "HostInaccessibleSharedAllocationRecordCommon::print_records(): "
-            "fence after copying header to HostSpace");
-      } else {
-        head.m_label[0] = 0;
-      }
+  for (auto const& r : records) {
+    Kokkos::Impl::DeepCopy<HostSpace, MemorySpace>(
+        &head, r.alloc_ptr, sizeof(SharedAllocationHeader));
+    Kokkos::fence(
+        "HostInaccessibleSharedAllocationRecordCommon::print_records(): "
+        "fence after copying header to HostSpace");
 
+    if (detail) {
       // Formatting dependent on sizeof(uintptr_t)
       const char* format_string;
 
@@ -177,43 +194,26 @@ void HostInaccessibleSharedAllocationRecordCommon<MemorySpace>::print_records(
       }
 
       snprintf(buffer, 256, format_string, MemorySpace::execution_space::name(),
-               reinterpret_cast<uintptr_t>(r),
-               reinterpret_cast<uintptr_t>(r->m_prev),
-               reinterpret_cast<uintptr_t>(r->m_next),
-               reinterpret_cast<uintptr_t>(r->m_alloc_ptr), r->m_alloc_size,
-               r->m_count, reinterpret_cast<uintptr_t>(r->m_dealloc),
-               head.m_label);
-      s << buffer;
-      r = r->m_next;
-    } while (r != &derived_t::s_root_record);
-  } else {
-    do {
-      if (r->m_alloc_ptr) {
-        Kokkos::Impl::DeepCopy<HostSpace, MemorySpace>(
-            &head, r->m_alloc_ptr, sizeof(SharedAllocationHeader));
-        Kokkos::fence(
-            "HostInaccessibleSharedAllocationRecordCommon::print_records(): "
-            "fence after copying header to HostSpace");
-
-        // Formatting dependent on sizeof(uintptr_t)
-        const char* format_string;
-
-        if (sizeof(uintptr_t) == sizeof(unsigned long)) {
-          format_string = "%s [ 0x%.12lx + %ld ] %s\n";
-        } else if (sizeof(uintptr_t) == sizeof(unsigned long long)) {
-          format_string = "%s [ 0x%.12llx + %ld ] %s\n";
-        }
-
-        snprintf(
-            buffer, 256, format_string, MemorySpace::execution_space::name(),
-            reinterpret_cast<uintptr_t>(r->data()), r->size(), head.m_label);
-      } else {
-        snprintf(buffer, 256, "%s [ 0 + 0 ]\n",
-                 MemorySpace::execution_space::name());
+               reinterpret_cast<uintptr_t>(r.record),
+               reinterpret_cast<uintptr_t>(r.prev),
+               reinterpret_cast<uintptr_t>(r.next),
+               reinterpret_cast<uintptr_t>(r.alloc_ptr), r.alloc_size, r.count,
+               reinterpret_cast<uintptr_t>(r.dealloc), head.m_label);
+    } else {
+      // Formatting dependent on sizeof(uintptr_t)
+      const char* format_string;
+
+      if (sizeof(uintptr_t) == sizeof(unsigned long)) {
+        format_string = "%s [ 0x%.12lx + %ld ] %s\n";
+      } else if (sizeof(uintptr_t) == sizeof(unsigned long long)) {
+        format_string = "%s [ 0x%.12llx + %ld ] %s\n";
       }
-      s << buffer;
-      r = r->m_next;
-    } while (r != &derived_t::s_root_record);
+
+      snprintf(buffer, 256, format_string, MemorySpace::execution_space::name(),
+               reinterpret_cast<uintptr_t>(r.alloc_ptr + 1),
+               r.alloc_size - sizeof(SharedAllocationHeader), head.m_label);
+    }
+    s << buffer;
   }
 #else
   Kokkos::Impl::throw_runtime_exception(
@@ -0,0 +1,148 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Two instances, distinct unless there is a single thread to partition
+std::vector<TEST_EXECSPACE> make_instances() {
+  if (TEST_EXECSPACE().concurrency() < 2) {
+    return {TEST_EXECSPACE(), TEST_EXECSPACE()};
+  }
+  return Kokkos::Experimental::partition_space(TEST_EXECSPACE(), 1, 1);
+}
+
+TEST(TEST_CATEGORY, global_fence_count) {
+  auto const count = Kokkos::Experimental::global_fence_count();
+  TEST_EXECSPACE().fence();
+  EXPECT_EQ(Kokkos::Experimental::global_fence_count(), count);
+  Kokkos::fence();
+  Kokkos::fence("global_fence_count");
+  EXPECT_EQ(Kokkos::Experimental::global_fence_count(), count + 2);
+}
+
+TEST(TEST_CATEGORY, event_wait) {
+  Kokkos::Experimental::Event<TEST_EXECSPACE> unrecorded;
+  EXPECT_FALSE(unrecorded.is_recorded());
+  unrecorded.wait();
+
+  auto instances = make_instances();
+  Kokkos::View<int*, TEST_EXECSPACE> a("a", 1000);
+  Kokkos::View<int*, TEST_EXECSPACE> b("b", 1000);
+
+  auto const count = Kokkos::Experimental::global_fence_count();
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(instances[0], 0, a.extent(0)),
+      KOKKOS_LAMBDA(int i) { a(i) = i; });
+  Kokkos::Experimental::Event<TEST_EXECSPACE> event(instances[0]);
+  EXPECT_TRUE(event.is_recorded());
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(instances[1], 0, b.extent(0)),
+      KOKKOS_LAMBDA(int i) { b(i) = 2 * i; });
+  event.wait("event_wait");
+  event.record(instances[1]);
+  event.wait();
+  EXPECT_EQ(Kokkos::Experimental::global_fence_count(), count);
+
+  int errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, a.extent(0)),
+      KOKKOS_LAMBDA(int i, int& local) {
+        local += (a(i) != i) + (b(i) != 2 * i);
+      },
+      errors);
+  EXPECT_EQ(errors, 0);
+}
+
+// A kernel on one partition waits for an event of a kernel still running on
+// another partition without blocking the thread that recorded the event.
+TEST(TEST_CATEGORY, event_cross_instance) {
+  auto instances                = make_instances();
+  TEST_EXECSPACE const producer = instances[0];
+  TEST_EXECSPACE const consumer = instances[1];
+  if (!Kokkos::Impl::ExecSpaceCompletion<TEST_EXECSPACE>::get(producer)) {
+    GTEST_SKIP() << "the execution space does not track kernel completion";
+  }
+  if (producer == consumer) {
+    GTEST_SKIP() << "the execution space can not be partitioned";
+  }
+
+  // Flags: the producer started, the producer may finish, the produced value
+  Kokkos::View<int[3], TEST_EXECSPACE> flags("flags");
+  std::thread producer_thread([=]() {
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<TEST_EXECSPACE>(producer, 0, 1),
+        KOKKOS_LAMBDA(int) {
+          Kokkos::atomic_store(&flags(0), 1);
+          while (Kokkos::atomic_load(&flags(1)) == 0) {
+          }
+          Kokkos::atomic_store(&flags(2), 42);
+        });
+  });
+  while (Kokkos::atomic_load(&flags(0)) == 0) std::this_thread::yield();
+
+  Kokkos::Experimental::Event<TEST_EXECSPACE> event(producer);
+  EXPECT_FALSE(event.query());
+  event.wait(consumer);
+
+  int consumed = 0;
+  std::thread consumer_thread([=, &consumed]() {
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<TEST_EXECSPACE>(consumer, 0, 1),
+        KOKKOS_LAMBDA(int, int& value) {
+          value = Kokkos::atomic_load(&flags(2));
+        },
+        consumed);
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  Kokkos::atomic_store(&flags(1), 1);
+  producer_thread.join();
+  consumer_thread.join();
+
+  EXPECT_TRUE(event.query());
+  EXPECT_EQ(consumed, 42);
+
+  // The producer kernel completed, so waiting for a new event is free.
+  event.record(producer);
+  EXPECT_TRUE(event.query());
+  event.wait(consumer);
+  consumer.fence();
+}
+
+// Resizing a View within its capacity and initializing a new View only wait
+// for the default instance of its execution space.
+TEST(TEST_CATEGORY, view_no_global_fence) {
+  Kokkos::View<double*, TEST_EXECSPACE> v("v", 10);
+  Kokkos::Experimental::reserve(v, 100);
+
+  auto const count = Kokkos::Experimental::global_fence_count();
+  Kokkos::resize(v, 50);
+  Kokkos::resize(Kokkos::WithoutInitializing, v, 60);
+  Kokkos::View<double*, TEST_EXECSPACE> w("w", 10);
+  Kokkos::View<double*, TEST_EXECSPACE> x(
+      Kokkos::view_alloc(TEST_EXECSPACE(), "x"), 10);
+  EXPECT_EQ(Kokkos::Experimental::global_fence_count(), count);
+  EXPECT_EQ(v.extent(0), 60u);
+}
+
+}  // namespace
@@ -41,6 +41,11 @@ void check_distinctive([[maybe_unused]] ExecSpace exec1,
     ASSERT_NE(exec1, exec2);
   }
 #endif
+#ifdef KOKKOS_ENABLE_THREADS
+  if constexpr (std::is_same_v<ExecSpace, Kokkos::Threads>) {
+    ASSERT_NE(exec1, exec2);
+  }
+#endif
 #ifdef KOKKOS_ENABLE_CUDA
   if constexpr (std::is_same_v<ExecSpace, Kokkos::Cuda>) {
     ASSERT_NE(exec1.cuda_stream(), exec2.cuda_stream());
@@ -69,9 +74,9 @@ void run_threaded_test(const Lambda1 l1, const Lambda2 l2) {
     if (omp_get_thread_num() == 1) l2();
   }
 }
-// We cannot run the multithreaded test when threads or HPX is enabled because
-// we cannot launch a thread from inside another thread
-#elif !defined(KOKKOS_ENABLE_THREADS) && !defined(KOKKOS_ENABLE_HPX)
+// We cannot run the multithreaded test when HPX is enabled because we cannot
+// launch a thread from inside another thread
+#elif !defined(KOKKOS_ENABLE_HPX)
 template <class Lambda1, class Lambda2>
 void run_threaded_test(const Lambda1 l1, const Lambda2 l2) {
   std::thread t1(std::move(l1));
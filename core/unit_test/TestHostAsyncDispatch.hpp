@@ -0,0 +1,121 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using flags_type = Kokkos::View<int[3], TEST_EXECSPACE>;
+
+// Waits for the flag to be set, but gives up after a while so that a kernel
+// that is wrongly dispatched synchronously does not hang the test.
+bool wait_for_flag(int* flag) {
+  auto const start = std::chrono::steady_clock::now();
+  while (Kokkos::atomic_load(flag) == 0) {
+    if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5)) {
+      return false;
+    }
+    std::this_thread::yield();
+  }
+  return true;
+}
+
+std::vector<TEST_EXECSPACE> make_async_instances() {
+  auto instances =
+      Kokkos::Experimental::partition_space(TEST_EXECSPACE(), 1, 1);
+  for (auto const& instance : instances) {
+    Kokkos::Experimental::set_async_dispatch(instance, true);
+  }
+  return instances;
+}
+
+TEST(TEST_CATEGORY, async_dispatch_returns_before_completion) {
+  if (TEST_EXECSPACE().concurrency() < 2) {
+    GTEST_SKIP() << "partitioning needs at least two threads";
+  }
+  auto const instances = make_async_instances();
+
+  flags_type flags("flags");
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(instances[0], 0, 1),
+      [=](int) { flags(1) = wait_for_flag(&flags(0)) ? 1 : -1; });
+  Kokkos::atomic_store(&flags(0), 1);
+  instances[0].fence();
+  EXPECT_EQ(flags(1), 1);
+}
+
+// Kernels launched one after the other from the same thread run concurrently
+// on different instances.
+TEST(TEST_CATEGORY, async_dispatch_overlap) {
+  if (TEST_EXECSPACE().concurrency() < 2) {
+    GTEST_SKIP() << "partitioning needs at least two threads";
+  }
+  auto const instances = make_async_instances();
+
+  flags_type flags("flags");
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(instances[0], 0, 1),
+      [=](int) { flags(1) = wait_for_flag(&flags(0)) ? 1 : -1; });
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(instances[1], 0, 1),
+      [=](int) { Kokkos::atomic_store(&flags(0), 1); });
+  Kokkos::fence();
+  EXPECT_EQ(flags(1), 1);
+}
+
+// Queued kernels, copies and events keep the order of their launches.
+TEST(TEST_CATEGORY, async_dispatch_order) {
+  if (TEST_EXECSPACE().concurrency() < 2) {
+    GTEST_SKIP() << "partitioning needs at least two threads";
+  }
+  auto const instances       = make_async_instances();
+  TEST_EXECSPACE const& exec = instances[0];
+  int const n                = 100000;
+
+  Kokkos::View<int*, TEST_EXECSPACE> a("a", n);
+  Kokkos::View<int*, TEST_EXECSPACE> b("b", n);
+  Kokkos::View<int*, TEST_EXECSPACE> c("c", n);
+  for (int repeat = 0; repeat < 10; ++repeat) {
+    Kokkos::parallel_for(Kokkos::RangePolicy<TEST_EXECSPACE>(exec, 0, n),
+                         [=](int i) { a(i) = i + repeat; });
+    Kokkos::parallel_for(Kokkos::RangePolicy<TEST_EXECSPACE>(exec, 0, n),
+                         [=](int i) { b(i) = a(i) + 1; });
+    Kokkos::deep_copy(exec, c, b);
+
+    Kokkos::Experimental::Event<TEST_EXECSPACE> event(exec);
+    event.wait(instances[1]);
+    int errors = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<TEST_EXECSPACE>(instances[1], 0, n),
+        [=](int i, int& local) { local += (c(i) != i + repeat + 1); },
+        errors);
+    EXPECT_EQ(errors, 0);
+    EXPECT_TRUE(event.query());
+  }
+
+  Kokkos::Experimental::set_async_dispatch(exec, false);
+  Kokkos::parallel_for(Kokkos::RangePolicy<TEST_EXECSPACE>(exec, 0, n),
+                       [=](int i) { a(i) = -i; });
+  EXPECT_EQ(a(n - 1), 1 - n);
+}
+
+}  // namespace
@@ -0,0 +1,170 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+
+#include <functional>
+#include <string>
+
+#include "tools/include/ToolTestingUtilities.hpp"
+
+namespace {
+
+using team_policy      = Kokkos::TeamPolicy<TEST_EXECSPACE>;
+using team_errors_type = Kokkos::View<int*, TEST_EXECSPACE>;
+using scratch_view =
+    Kokkos::View<int*, TEST_EXECSPACE::scratch_memory_space,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+// Fills level 0 and level 1 scratch of n0 and n1 ints and counts the values
+// not read back per team.
+void run_team_scratch_kernel(team_errors_type const& errors, int n0, int n1) {
+  team_policy policy(TEST_EXECSPACE(), errors.extent(0), 1);
+  policy.set_scratch_size(0, Kokkos::PerTeam(scratch_view::shmem_size(n0)))
+      .set_scratch_size(1, Kokkos::PerTeam(scratch_view::shmem_size(n1)));
+  Kokkos::parallel_for(
+      policy, KOKKOS_LAMBDA(team_policy::member_type const& member) {
+        scratch_view level0(member.team_scratch(0), n0);
+        scratch_view level1(member.team_scratch(1), n1);
+        int const team = member.league_rank();
+        for (int i = 0; i < n0; ++i) level0(i) = team + i;
+        for (int i = 0; i < n1; ++i) level1(i) = team - i;
+        int count = 0;
+        for (int i = 0; i < n0; ++i) count += (level0(i) != team + i);
+        for (int i = 0; i < n1; ++i) count += (level1(i) != team - i);
+        errors(team) = count;
+      });
+}
+
+int count_errors(team_errors_type const& errors) {
+  int total = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, errors.extent(0)),
+      KOKKOS_LAMBDA(int i, int& local) { local += errors(i); }, total);
+  return total;
+}
+
+bool allocates(std::function<void()> const& launch) {
+  using namespace Kokkos::Test::Tools;
+  listen_tool_events(Config::DisableAll(), Config::EnableAllocs());
+  bool const success = validate_absence(
+      launch,
+      [](AllocateDataEvent) {
+        return MatchDiagnostic{true, {"Found alloc event"}};
+      },
+      [](DeallocateDataEvent) {
+        return MatchDiagnostic{true, {"Found dealloc event"}};
+      });
+  listen_tool_events(Config::DisableAll());
+  return !success;
+}
+
+TEST(TEST_CATEGORY, team_scratch_reserve) {
+  team_errors_type errors("errors", 16);
+  int const n0 = 100;
+  int const n1 = 10000;
+  Kokkos::Experimental::reserve_team_scratch(
+      TEST_EXECSPACE(), scratch_view::shmem_size(n0),
+      scratch_view::shmem_size(n1));
+
+  EXPECT_FALSE(allocates([&]() {
+    run_team_scratch_kernel(errors, n0, n1);
+    run_team_scratch_kernel(errors, n0 / 2, n1 / 2);
+    TEST_EXECSPACE().fence();
+  }));
+  EXPECT_EQ(count_errors(errors), 0);
+}
+
+// Kernels alternating between reductions and team scratch reuse the scratch
+// the first of them allocated.
+TEST(TEST_CATEGORY, team_scratch_alternating_kernels) {
+  team_errors_type errors("errors", 16);
+  auto const launch = [&]() {
+    run_team_scratch_kernel(errors, 10, 5000);
+    int sum = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::RangePolicy<TEST_EXECSPACE>(0, 100),
+        KOKKOS_LAMBDA(int i, int& local) { local += i; }, sum);
+    EXPECT_EQ(sum, 4950);
+    TEST_EXECSPACE().fence();
+  };
+  launch();
+
+  EXPECT_FALSE(allocates(launch));
+  EXPECT_EQ(count_errors(errors), 0);
+}
+
+TEST(TEST_CATEGORY, team_scratch_shrink) {
+  team_errors_type errors("errors", 16);
+  int const reserved = 1000;
+  Kokkos::Experimental::reserve_team_scratch(
+      TEST_EXECSPACE(), 0, scratch_view::shmem_size(reserved));
+  run_team_scratch_kernel(errors, 0, 100 * reserved);
+  EXPECT_EQ(count_errors(errors), 0);
+
+  EXPECT_TRUE(allocates(
+      [&]() { Kokkos::Experimental::shrink_team_scratch(TEST_EXECSPACE()); }));
+  EXPECT_FALSE(allocates([&]() {
+    Kokkos::Experimental::shrink_team_scratch(TEST_EXECSPACE());
+    run_team_scratch_kernel(errors, 0, reserved);
+    TEST_EXECSPACE().fence();
+  }));
+  EXPECT_EQ(count_errors(errors), 0);
+
+  run_team_scratch_kernel(errors, 0, 10 * reserved);
+  EXPECT_EQ(count_errors(errors), 0);
+}
+
+// Level 1 scratch comes from an arena of its own, large level 1 requests do
+// not grow the thread data holding level 0 scratch.
+TEST(TEST_CATEGORY, team_scratch_level1_arena) {
+  using namespace Kokkos::Test::Tools;
+  team_errors_type errors("errors", 16);
+  int const n0 = 100;
+  int const n1 = 1 << 18;
+  run_team_scratch_kernel(errors, n0, 0);
+  TEST_EXECSPACE().fence();
+
+  listen_tool_events(Config::DisableAll(), Config::EnableAllocs());
+  bool const level0_unchanged = validate_absence(
+      [&]() {
+        run_team_scratch_kernel(errors, n0, n1);
+        TEST_EXECSPACE().fence();
+      },
+      [](AllocateDataEvent event) {
+        return MatchDiagnostic{
+            event.name.find("level1_scratch") == std::string::npos,
+            {"Found level 0 scratch allocation"}};
+      });
+  bool const level1_allocated = validate_existence(
+      [&]() {
+        run_team_scratch_kernel(errors, n0, 2 * n1);
+        TEST_EXECSPACE().fence();
+      },
+      [](AllocateDataEvent event) {
+        return MatchDiagnostic{event.name.find("level1_scratch") !=
+                               std::string::npos};
+      });
+  listen_tool_events(Config::DisableAll());
+
+  EXPECT_TRUE(level0_unchanged);
+  EXPECT_TRUE(level1_allocated);
+  EXPECT_EQ(count_errors(errors), 0);
+}
+
+}  // namespace
@@ -0,0 +1,186 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sched.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#include <impl/Kokkos_HostTopology.hpp>
+
+namespace {
+
+using Kokkos::Impl::HostThreadBinding;
+
+void make_directories(std::string const& path) {
+  for (auto pos = path.find('/', 1); pos != std::string::npos;
+       pos      = path.find('/', pos + 1)) {
+    mkdir(path.substr(0, pos).c_str(), 0755);
+  }
+  mkdir(path.c_str(), 0755);
+}
+
+void write_file(std::string const& path, std::string const& contents) {
+  make_directories(path.substr(0, path.rfind('/')));
+  std::ofstream(path) << contents << '\n';
+}
+
+// Fake sysfs tree of a machine with two sockets, one NUMA node per socket,
+// two cores per socket and two hardware threads per core.  CPUs are numbered
+// the way Linux usually does: first all cores, then their SMT siblings.
+class FakeSysfs {
+  std::string m_root;
+
+ public:
+  FakeSysfs() {
+    char name[] = "/tmp/kokkos_host_topology_XXXXXX";
+    m_root      = mkdtemp(name);
+    write_file(m_root + "/node/node0/cpulist", "0-1,4-5");
+    write_file(m_root + "/node/node1/cpulist", "2-3,6-7");
+    for (int cpu = 0; cpu < 8; ++cpu) {
+      std::string const dir = m_root + "/cpu/cpu" + std::to_string(cpu);
+      int const package     = (cpu % 4) / 2;
+      write_file(dir + "/topology/physical_package_id",
+                 std::to_string(package));
+      write_file(dir + "/topology/core_id", std::to_string(cpu % 2));
+      write_file(dir + "/cache/index0/level", "1");
+      write_file(dir + "/cache/index0/type", "Instruction");
+      write_file(dir + "/cache/index0/shared_cpu_list",
+                 std::to_string(cpu % 4) + "," + std::to_string(cpu % 4 + 4));
+      write_file(dir + "/cache/index1/level", "3");
+      write_file(dir + "/cache/index1/type", "Unified");
+      write_file(dir + "/cache/index1/shared_cpu_list",
+                 package == 0 ? "0-1,4-5" : "2-3,6-7");
+    }
+  }
+  ~FakeSysfs() {
+    std::string const command = "rm -rf " + m_root;
+    (void)std::system(command.c_str());
+  }
+  std::string const& root() const { return m_root; }
+};
+
+std::vector<int> placement(Kokkos::Impl::HostTopology const& topology,
+                           HostThreadBinding binding, int num_threads) {
+  return Kokkos::Impl::host_thread_placement(topology, binding, num_threads);
+}
+
+TEST(host_topology, read_sysfs) {
+  FakeSysfs sysfs;
+  auto const topology =
+      Kokkos::Impl::read_host_topology(sysfs.root(), {0, 1, 2, 3, 4, 5, 6, 7});
+
+  ASSERT_EQ(topology.processing_units.size(), 8u);
+  EXPECT_EQ(topology.num_numa_nodes, 2);
+  EXPECT_EQ(topology.num_packages, 2);
+  EXPECT_EQ(topology.num_cores, 4);
+  EXPECT_EQ(topology.num_llcs, 2);
+  EXPECT_EQ(topology.max_smt, 2);
+
+  std::vector<int> const expected_order = {0, 4, 1, 5, 2, 6, 3, 7};
+  for (int i = 0; i < 8; ++i) {
+    auto const& pu = topology.processing_units[i];
+    EXPECT_EQ(pu.os_index, expected_order[i]);
+    EXPECT_EQ(pu.numa_node, i / 4);
+    EXPECT_EQ(pu.package, i / 4);
+    EXPECT_EQ(pu.core, i / 2);
+    EXPECT_EQ(pu.smt_rank, i % 2);
+    EXPECT_EQ(pu.llc, i / 4);
+  }
+  ASSERT_NE(topology.find(6), nullptr);
+  EXPECT_EQ(topology.find(6)->core, 2);
+  EXPECT_EQ(topology.find(8), nullptr);
+}
+
+TEST(host_topology, read_sysfs_restricted) {
+  FakeSysfs sysfs;
+  // e.g. a process whose affinity mask only contains the SMT siblings
+  auto const topology =
+      Kokkos::Impl::read_host_topology(sysfs.root(), {4, 5, 6, 7});
+  EXPECT_EQ(topology.num_numa_nodes, 2);
+  EXPECT_EQ(topology.num_cores, 4);
+  EXPECT_EQ(topology.max_smt, 1);
+}
+
+TEST(host_topology, read_missing_sysfs) {
+  auto const topology =
+      Kokkos::Impl::read_host_topology("/nonexistent/sysfs", {0, 1, 2});
+  EXPECT_EQ(topology.num_numa_nodes, 1);
+  EXPECT_EQ(topology.num_packages, 1);
+  EXPECT_EQ(topology.num_cores, 3);
+  EXPECT_EQ(topology.max_smt, 1);
+  EXPECT_TRUE(Kokkos::Impl::read_host_topology("/nonexistent/sysfs", {})
+                  .empty());
+}
+
+TEST(host_topology, placement) {
+  FakeSysfs sysfs;
+  auto const topology =
+      Kokkos::Impl::read_host_topology(sysfs.root(), {0, 1, 2, 3, 4, 5, 6, 7});
+
+  using V = std::vector<int>;
+  EXPECT_EQ(placement(topology, HostThreadBinding::none, 4), V{});
+  EXPECT_EQ(placement(topology, HostThreadBinding::compact, 3), (V{0, 1, 2}));
+  EXPECT_EQ(placement(topology, HostThreadBinding::compact, 8),
+            (V{0, 1, 2, 3, 4, 5, 6, 7}));
+  EXPECT_EQ(placement(topology, HostThreadBinding::compact, 10),
+            (V{0, 1, 2, 3, 4, 5, 6, 7, 0, 1}));
+  EXPECT_EQ(placement(topology, HostThreadBinding::spread, 2), (V{0, 2}));
+  EXPECT_EQ(placement(topology, HostThreadBinding::spread, 4),
+            (V{0, 1, 2, 3}));
+  EXPECT_EQ(placement(topology, HostThreadBinding::spread, 6),
+            (V{0, 1, 2, 3, 4, 5}));
+  EXPECT_EQ(placement(topology, HostThreadBinding::numa, 3), (V{0, 1, 2}));
+  EXPECT_EQ(placement(topology, HostThreadBinding::numa, 6),
+            (V{0, 1, 4, 2, 3, 6}));
+  EXPECT_EQ(placement(Kokkos::Impl::HostTopology{},
+                      HostThreadBinding::compact, 4),
+            V{});
+}
+
+TEST(host_topology, binding_names) {
+  for (auto name : {"none", "compact", "spread", "numa"}) {
+    EXPECT_TRUE(Kokkos::Impl::is_valid_host_thread_binding(name));
+    EXPECT_STREQ(Kokkos::Impl::to_string(
+                     Kokkos::Impl::host_thread_binding_from_string(name)),
+                 name);
+  }
+  EXPECT_FALSE(Kokkos::Impl::is_valid_host_thread_binding("scatter"));
+  EXPECT_FALSE(Kokkos::Impl::is_valid_host_thread_binding(""));
+}
+
+TEST(host_topology, bind_this_thread) {
+  auto const& topology = Kokkos::Impl::host_topology();
+  ASSERT_FALSE(topology.empty());
+
+  int const cpu = topology.processing_units.back().os_index;
+  std::thread thread([cpu]() {
+    ASSERT_TRUE(Kokkos::Impl::bind_this_thread_to_cpu(cpu));
+    EXPECT_EQ(sched_getcpu(), cpu);
+    EXPECT_TRUE(Kokkos::Impl::restore_this_thread_affinity());
+  });
+  thread.join();
+}
+
+}  // namespace
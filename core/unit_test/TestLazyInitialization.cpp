@@ -0,0 +1,66 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+
+#include <Kokkos_Core.hpp>
+#include <gtest/gtest.h>
+
+#include <sstream>
+
+namespace {
+
+// The host backends start their threads when the first kernel is launched
+TEST(initialization, lazy_initialization) {
+  Kokkos::initialize(Kokkos::InitializationSettings()
+                         .set_lazy_initialization(true)
+                         .set_disable_warnings(true));
+  EXPECT_TRUE(Kokkos::is_initialized());
+
+  {
+    int const concurrency = Kokkos::DefaultHostExecutionSpace().concurrency();
+    EXPECT_GE(concurrency, 1);
+
+    std::ostringstream before;
+    Kokkos::print_configuration(before);
+    EXPECT_NE(before.str().find("Startup:"), std::string::npos);
+
+    Kokkos::View<int*> d("d", 1000);
+    Kokkos::deep_copy(d, 1);
+    int result = 0;
+    Kokkos::parallel_reduce(
+        d.extent(0), KOKKOS_LAMBDA(int i, int& sum) { sum += d(i); }, result);
+    EXPECT_EQ(result, d.extent_int(0));
+
+    using policy_type = Kokkos::TeamPolicy<Kokkos::DefaultHostExecutionSpace>;
+    Kokkos::View<int*, Kokkos::HostSpace> league("league", 8);
+    Kokkos::parallel_for(
+        policy_type(league.extent(0), Kokkos::AUTO),
+        [=](policy_type::member_type const& member) {
+          Kokkos::single(Kokkos::PerTeam(member),
+                         [&]() { league(member.league_rank()) = 1; });
+        });
+    Kokkos::fence();
+    for (std::size_t i = 0; i < league.extent(0); ++i) {
+      EXPECT_EQ(league(i), 1);
+    }
+    EXPECT_EQ(Kokkos::DefaultHostExecutionSpace().concurrency(), concurrency);
+  }
+
+  Kokkos::finalize();
+  EXPECT_FALSE(Kokkos::is_initialized());
+}
+
+}  // namespace
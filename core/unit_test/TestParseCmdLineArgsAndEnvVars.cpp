@@ -208,6 +208,31 @@ TEST(defaultdevicetype, cmd_line_args_tune_internals) {
   EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
 }
 
+TEST(defaultdevicetype, cmd_line_args_bind_threads) {
+  CmdLineArgsHelper cla = {{
+      "--kokkos-bind-threads=compact",
+      "--kokkos-bind-threads=numa",
+      "--foo",
+  }};
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_bind_threads());
+  EXPECT_EQ(settings.get_bind_threads(), "numa");
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {"--foo"});
+}
+
+TEST(defaultdevicetype, cmd_line_args_lazy_initialization) {
+  CmdLineArgsHelper cla = {{
+      "--kokkos-lazy-initialization",
+      "--foo",
+  }};
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_lazy_initialization());
+  EXPECT_TRUE(settings.get_lazy_initialization());
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {"--foo"});
+}
+
 TEST(defaultdevicetype, cmd_line_args_help) {
   CmdLineArgsHelper cla = {{
       "--help",
@@ -266,6 +291,25 @@ TEST(defaultdevicetype, cmd_line_args_tools_arguments) {
   EXPECT_TRUE(settings.has_tools_libs());
   EXPECT_EQ(settings.get_tools_libs(), "ich_tue_nur.so");
   EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
+
+  cla      = {{
+      "--kokkos-tools-trace-file=timeline.json",
+  }};
+  settings = {};
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_tools_trace_file());
+  EXPECT_EQ(settings.get_tools_trace_file(), "timeline.json");
+  EXPECT_FALSE(settings.has_tools_libs());
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
+
+  cla      = {{
+      "--kokkos-tools-perf-counters",
+  }};
+  settings = {};
+  Kokkos::Impl::parse_command_line_arguments(cla.argc(), cla.argv(), settings);
+  EXPECT_TRUE(settings.has_tools_perf_counters());
+  EXPECT_TRUE(settings.get_tools_perf_counters());
+  EXPECT_REMAINING_COMMAND_LINE_ARGUMENTS(cla, {});
 }
 
 TEST(defaultdevicetype, cmd_line_args_unrecognized_flag) {
@@ -365,6 +409,39 @@ TEST(defaultdevicetype, env_vars_num_devices) {
   EXPECT_EQ(settings.get_skip_device(), 1);
 }
 
+TEST(defaultdevicetype, env_vars_tools_trace_file) {
+  EnvVarsHelper ev = {{
+      {"KOKKOS_TOOLS_TRACE_FILE", "timeline.json"},
+  }};
+  SKIP_IF_ENVIRONMENT_VARIABLE_ALREADY_SET(ev);
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_environment_variables(settings);
+  EXPECT_TRUE(settings.has_tools_trace_file());
+  EXPECT_EQ(settings.get_tools_trace_file(), "timeline.json");
+}
+
+TEST(defaultdevicetype, env_vars_bind_threads) {
+  EnvVarsHelper ev = {{
+      {"KOKKOS_BIND_THREADS", "spread"},
+  }};
+  SKIP_IF_ENVIRONMENT_VARIABLE_ALREADY_SET(ev);
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_environment_variables(settings);
+  EXPECT_TRUE(settings.has_bind_threads());
+  EXPECT_EQ(settings.get_bind_threads(), "spread");
+}
+
+TEST(defaultdevicetype, env_vars_lazy_initialization) {
+  EnvVarsHelper ev = {{
+      {"KOKKOS_LAZY_INITIALIZATION", "yes"},
+  }};
+  SKIP_IF_ENVIRONMENT_VARIABLE_ALREADY_SET(ev);
+  Kokkos::InitializationSettings settings;
+  Kokkos::Impl::parse_environment_variables(settings);
+  EXPECT_TRUE(settings.has_lazy_initialization());
+  EXPECT_TRUE(settings.get_lazy_initialization());
+}
+
 TEST(defaultdevicetype, env_vars_disable_warnings) {
   for (auto const& value_true : {"1", "true", "TRUE", "yEs"}) {
     EnvVarsHelper ev = {{
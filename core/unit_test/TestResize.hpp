@@ -369,5 +369,103 @@ void testResize() {
   }
 }
 
+// Views of int with 3 entries per index of the growth dimension.
+template <class DeviceType, class Layout>
+struct CapacityTest {
+  using view_type = Kokkos::View<int**, Layout, DeviceType>;
+  static constexpr bool right =
+      std::is_same<Layout, Kokkos::LayoutRight>::value;
+
+  static view_type make(size_t n) {
+    return right ? view_type("capacity", n, 3) : view_type("capacity", 3, n);
+  }
+
+  static void resize(view_type& v, size_t n) {
+    right ? Kokkos::resize(v, n, 3) : Kokkos::resize(v, 3, n);
+  }
+
+  static size_t extent(const view_type& v) { return v.extent(right ? 0 : 1); }
+
+  // Whether entries [0, n_old) equal old_value and [n_old, extent) are zero.
+  static bool check(const view_type& v, size_t n_old, int old_value) {
+    auto h_v = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+    for (size_t i = 0; i < extent(v); ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        const int value = right ? h_v(i, j) : h_v(j, i);
+        if (value != (i < n_old ? old_value : 0)) return false;
+      }
+    }
+    return true;
+  }
+
+  static void run() {
+    view_type v = make(10);
+    Kokkos::deep_copy(v, 7);
+    EXPECT_EQ(Kokkos::Experimental::capacity(v), 10u);
+
+    // Reserving at least doubles the capacity and keeps the contents.
+    Kokkos::Experimental::reserve(v, 12);
+    EXPECT_EQ(Kokkos::Experimental::capacity(v), 20u);
+    EXPECT_EQ(extent(v), 10u);
+    EXPECT_EQ(v.label(), "capacity");
+    EXPECT_TRUE(check(v, 10, 7));
+    const int* const reserved = v.data();
+    Kokkos::Experimental::reserve(v, 20);
+    EXPECT_EQ(v.data(), reserved);
+
+    // Resizing within the capacity reuses the allocation and initializes the
+    // new entries, also those that were exposed before.
+    resize(v, 15);
+    EXPECT_EQ(v.data(), reserved);
+    EXPECT_TRUE(check(v, 10, 7));
+    resize(v, 5);
+    EXPECT_EQ(v.data(), reserved);
+    EXPECT_EQ(Kokkos::Experimental::capacity(v), 20u);
+    resize(v, 20);
+    EXPECT_EQ(v.data(), reserved);
+    EXPECT_TRUE(check(v, 5, 7));
+
+    // Beyond the capacity, resize allocates exactly what is needed.
+    Kokkos::deep_copy(v, 7);
+    resize(v, 21);
+    EXPECT_EQ(Kokkos::Experimental::capacity(v), 21u);
+    EXPECT_TRUE(check(v, 20, 7));
+
+    // Resizing a view whose allocation is shared does not change the other
+    // views.
+    Kokkos::Experimental::reserve(v, 40);
+    view_type copy = v;
+    resize(v, 30);
+    EXPECT_NE(v.data(), copy.data());
+    EXPECT_EQ(extent(copy), 21u);
+    EXPECT_TRUE(check(v, 20, 7));
+
+    // Changing another dimension reallocates.
+    Kokkos::Experimental::reserve(v, 60);
+    const int* const before = v.data();
+    right ? Kokkos::resize(v, 30, 4) : Kokkos::resize(v, 4, 30);
+    EXPECT_NE(v.data(), before);
+    EXPECT_EQ(Kokkos::Experimental::capacity(v), 30u);
+  }
+};
+
+template <class DeviceType>
+void testResizeCapacity() {
+  CapacityTest<DeviceType, Kokkos::LayoutRight>::run();
+  CapacityTest<DeviceType, Kokkos::LayoutLeft>::run();
+
+  // Rank-1 views with and without an execution space instance.
+  Kokkos::View<double*, DeviceType> v("v", 100);
+  Kokkos::Experimental::reserve(typename DeviceType::execution_space(), v,
+                                1000);
+  const double* const reserved = v.data();
+  Kokkos::resize(Kokkos::view_alloc(typename DeviceType::execution_space(),
+                                    Kokkos::WithoutInitializing),
+                 v, 1000);
+  typename DeviceType::execution_space().fence();
+  EXPECT_EQ(v.data(), reserved);
+  EXPECT_EQ(Kokkos::Experimental::capacity(v), 1000u);
+}
+
 }  // namespace TestViewResize
 #endif  // TESTRESIZE_HPP_
@@ -226,4 +226,84 @@ TEST(TEST_CATEGORY, impl_shared_alloc) {
 #endif
 }
 
+// Host backends run functors with tracking disabled on every thread so that
+// View copies made inside a parallel region are not reference counted.
+template <class ExecutionSpace>
+void test_shared_alloc_untracked_in_parallel() {
+  using RecordBase = Kokkos::Impl::SharedAllocationRecord<void, void>;
+
+  const int N = 1000;
+  Kokkos::View<int*, Kokkos::HostSpace> tracked("tracked", N);
+  Kokkos::View<double*, Kokkos::HostSpace> data("data", 10);
+  auto const* data_ptr = &data;
+
+  ASSERT_TRUE(RecordBase::tracking_enabled());
+  ASSERT_EQ(data.use_count(), 1);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<ExecutionSpace>(0, N), [=](int i) {
+        // not a closure copy: reached through a pointer to the original
+        auto copy  = *data_ptr;
+        tracked(i) = RecordBase::tracking_enabled() + copy.use_count() - 1;
+      });
+  ExecutionSpace().fence();
+
+  int num_tracked = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<ExecutionSpace>(0, N),
+      [=](int i, int& sum) { sum += tracked(i); }, num_tracked);
+  ASSERT_EQ(num_tracked, 0);
+
+  // tracking is restored on the thread that launched the kernels
+  ASSERT_TRUE(RecordBase::tracking_enabled());
+  ASSERT_EQ(data.use_count(), 1);
+  {
+    Kokkos::Impl::SharedAllocationDisableTrackingGuard outer;
+    {
+      Kokkos::Impl::SharedAllocationDisableTrackingGuard inner;
+      ASSERT_FALSE(RecordBase::tracking_enabled());
+    }
+    ASSERT_FALSE(RecordBase::tracking_enabled());
+  }
+  ASSERT_TRUE(RecordBase::tracking_enabled());
+}
+
+TEST(TEST_CATEGORY, impl_shared_alloc_untracked_in_parallel) {
+#if defined(TEST_CATEGORY_NUMBER) && (TEST_CATEGORY_NUMBER < 3)
+  // serial threads openmp
+  test_shared_alloc_untracked_in_parallel<TEST_EXECSPACE>();
+#else
+  GTEST_SKIP() << "only host backends executing on Kokkos owned threads "
+                  "disable tracking in parallel regions";
+#endif
+}
+
+TEST(TEST_CATEGORY, view_as_unmanaged) {
+  Kokkos::View<int**, TEST_EXECSPACE> a("a", 10, 3);
+  ASSERT_EQ(a.use_count(), 1);
+
+  auto u = Kokkos::Experimental::as_unmanaged(a);
+  static_assert(!decltype(u)::traits::is_managed);
+  static_assert(std::is_same_v<typename decltype(u)::array_layout,
+                               typename decltype(a)::array_layout>);
+  static_assert(std::is_same_v<typename decltype(u)::memory_space,
+                               typename decltype(a)::memory_space>);
+  ASSERT_EQ(u.data(), a.data());
+  ASSERT_EQ(u.extent(0), 10u);
+  ASSERT_EQ(u.extent(1), 3u);
+  ASSERT_EQ(a.use_count(), 1);
+
+  auto copy = u;
+  ASSERT_EQ(a.use_count(), 1);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, 10),
+      KOKKOS_LAMBDA(int i) { copy(i, 0) = i; });
+  int sum = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<TEST_EXECSPACE>(0, 10),
+      KOKKOS_LAMBDA(int i, int& lsum) { lsum += a(i, 0); }, sum);
+  ASSERT_EQ(sum, 45);
+}
+
 }  // namespace Test
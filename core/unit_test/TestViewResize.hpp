@@ -27,6 +27,11 @@ TEST(TEST_CATEGORY, view_resize) {
   TestViewResize::testResize<ExecSpace>();
 }
 
+TEST(TEST_CATEGORY, view_resize_capacity) {
+  using ExecSpace = TEST_EXECSPACE;
+  TestViewResize::testResizeCapacity<ExecSpace>();
+}
+
 TEST(TEST_CATEGORY, view_realloc) {
   using ExecSpace = TEST_EXECSPACE;
   TestViewRealloc::testRealloc<ExecSpace>();
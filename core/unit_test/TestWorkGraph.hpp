@@ -126,8 +126,93 @@ struct TestWorkGraph {
     Kokkos::deep_copy(h_values, m_values);
     ASSERT_EQ(h_values(0), full_fibonacci(m_input));
   }
+
+  // The same policy runs the graph again without being rebuilt.
+  void test_scalable() {
+    using ScalablePolicy =
+        Kokkos::Experimental::ScalableWorkGraphPolicy<std::int32_t, ExecSpace>;
+    ScalablePolicy policy(m_graph);
+    Values initial("initial", m_values.size());
+    Kokkos::deep_copy(initial, m_values);
+    for (int run = 0; run < 3; ++run) {
+      Kokkos::deep_copy(m_values, initial);
+      Kokkos::parallel_for("fib", policy, *this);
+      Kokkos::fence();
+      auto h_values =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m_values);
+      ASSERT_EQ(h_values(0), full_fibonacci(m_input)) << run;
+    }
+  }
+};
+
+// A node with a wide fan-out whose successors all precede a single sink:
+// every node runs once and after all of its predecessors.
+template <class ExecSpace>
+struct TestWorkGraphFanOut {
+  using Policy = Kokkos::Experimental::ScalableWorkGraphPolicy<ExecSpace>;
+  using Graph  = typename Policy::graph_type;
+  using Stamps = Kokkos::View<std::int64_t*, ExecSpace>;
+
+  static_assert(std::is_same<typename Policy::index_type, std::int64_t>::value,
+                "ScalableWorkGraphPolicy defaults to 64-bit indices");
+
+  Stamps m_stamps;
+  Stamps m_clock;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(std::int64_t w) const {
+    m_stamps(w) = Kokkos::atomic_fetch_add(&m_clock(0), std::int64_t(1));
+  }
+
+  void run() {
+    constexpr std::int64_t n = 100002;  // source, n - 2 middles, sink
+    Graph graph;
+    graph.row_map = typename Graph::row_map_type("row_map", n + 1);
+    graph.entries = typename Graph::entries_type("entries", 2 * (n - 2));
+    auto h_row_map = Kokkos::create_mirror_view(graph.row_map);
+    auto h_entries = Kokkos::create_mirror_view(graph.entries);
+    h_row_map(0) = 0;
+    h_row_map(1) = n - 2;
+    for (std::int64_t i = 1; i < n - 1; ++i) {
+      h_entries(i - 1)     = i;
+      h_entries(n - 3 + i) = n - 1;
+      h_row_map(i + 1)     = n - 2 + i;
+    }
+    h_row_map(n) = 2 * (n - 2);
+    Kokkos::deep_copy(graph.row_map, h_row_map);
+    Kokkos::deep_copy(graph.entries, h_entries);
+
+    Policy policy(graph);
+    for (int run = 0; run < 2; ++run) {
+      m_stamps = Stamps("stamps", n);
+      m_clock  = Stamps("clock", 1);
+      Kokkos::parallel_for(policy, *this);
+      Kokkos::fence();
+      auto h_stamps =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m_stamps);
+      ASSERT_EQ(h_stamps(0), 0);
+      ASSERT_EQ(h_stamps(n - 1), n - 1);
+      std::vector<bool> seen(n, false);
+      for (std::int64_t i = 0; i < n; ++i) {
+        ASSERT_FALSE(seen[h_stamps(i)]) << i;
+        seen[h_stamps(i)] = true;
+      }
+    }
+  }
 };
 
+template <class ExecSpace>
+void test_scalable_workgraph() {
+  if constexpr (Kokkos::SpaceAccessibility<
+                    Kokkos::HostSpace,
+                    typename ExecSpace::memory_space>::accessible) {
+    for (int i = 0; i < 27; i += 3) TestWorkGraph<ExecSpace>(i).test_scalable();
+    TestWorkGraphFanOut<ExecSpace>().run();
+  } else {
+    GTEST_SKIP() << "ScalableWorkGraphPolicy requires a host execution space";
+  }
+}
+
 }  // anonymous namespace
 
 TEST(TEST_CATEGORY, workgraph_fib) {
@@ -140,4 +225,8 @@ TEST(TEST_CATEGORY, workgraph_fib) {
   // f.test_for();
 }
 
+TEST(TEST_CATEGORY, workgraph_scalable) {
+  test_scalable_workgraph<TEST_EXECSPACE>();
+}
+
 }  // namespace Test
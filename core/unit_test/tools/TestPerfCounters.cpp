@@ -0,0 +1,72 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Profiling_PerfCounters.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <sstream>
+
+namespace {
+
+TEST(defaultdevicetype, perf_counters) {
+  ::testing::internal::CaptureStderr();
+  bool const enabled = Kokkos::Tools::Impl::initialize_perf_counters();
+  ::testing::internal::GetCapturedStderr();
+  auto const available = Kokkos::Tools::Impl::perf_counters_available();
+  // failing to open the counters (e.g. in containers) must not be fatal
+  ASSERT_EQ(enabled, std::any_of(available.begin(), available.end(),
+                                 [](bool a) { return a; }));
+  ASSERT_EQ(enabled, Kokkos::Tools::Impl::perf_counters_enabled());
+
+  Kokkos::View<double*> a("a", 1000);
+  for (int i = 0; i < 2; ++i) {
+    Kokkos::parallel_for(
+        "counted_kernel", Kokkos::RangePolicy<>(0, 1000),
+        KOKKOS_LAMBDA(int j) { a(j) += j; });
+  }
+  Kokkos::fence();
+
+  auto const kernels = Kokkos::Tools::Impl::perf_counters_by_kernel();
+  if (!enabled) {
+    EXPECT_TRUE(kernels.empty());
+    GTEST_SKIP() << "hardware performance counters are not available";
+  }
+  auto const it =
+      std::find_if(kernels.begin(), kernels.end(), [](auto const& kernel) {
+        return kernel.name == "counted_kernel";
+      });
+  ASSERT_NE(it, kernels.end());
+  EXPECT_EQ(it->calls, 2u);
+  EXPECT_GT(it->seconds, 0.);
+  if (available[Kokkos::Tools::Impl::perf_instructions]) {
+    EXPECT_GT(it->values[Kokkos::Tools::Impl::perf_instructions], 0u);
+  }
+
+  std::stringstream summary;
+  Kokkos::Tools::Impl::print_perf_counters_summary(summary);
+  EXPECT_NE(summary.str().find("counted_kernel"), std::string::npos)
+      << summary.str();
+
+  ::testing::internal::CaptureStdout();
+  Kokkos::Tools::Impl::finalize_perf_counters();
+  ::testing::internal::GetCapturedStdout();
+  EXPECT_FALSE(Kokkos::Tools::Impl::perf_counters_enabled());
+}
+
+}  // namespace
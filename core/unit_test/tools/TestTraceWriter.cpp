@@ -0,0 +1,107 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+#include <impl/Kokkos_Profiling_Trace.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+std::string read_file(std::string const& file_name) {
+  std::ifstream in(file_name);
+  std::stringstream ss;
+  ss << in.rdbuf();
+  return ss.str();
+}
+
+std::size_t count_occurrences(std::string const& str, std::string const& sub) {
+  std::size_t count = 0;
+  for (auto pos = str.find(sub); pos != std::string::npos;
+       pos      = str.find(sub, pos + sub.size())) {
+    ++count;
+  }
+  return count;
+}
+
+TEST(defaultdevicetype, trace_writer) {
+  std::string const file_name = "kokkos_trace_writer_test.json";
+  Kokkos::Tools::Impl::initialize_trace(file_name);
+  ASSERT_TRUE(Kokkos::Tools::Impl::trace_enabled());
+  ASSERT_TRUE(Kokkos::Tools::profileLibraryLoaded());
+
+  {
+    Kokkos::Profiling::pushRegion("outer \"region\"");
+    Kokkos::View<int*> a("a", 10);
+    Kokkos::parallel_for(
+        "traced_for", Kokkos::RangePolicy<>(0, 10),
+        KOKKOS_LAMBDA(int i) { a(i) = i; });
+    int sum = 0;
+    Kokkos::parallel_reduce(
+        "traced_reduce", Kokkos::RangePolicy<>(0, 10),
+        KOKKOS_LAMBDA(int i, int& lsum) { lsum += a(i); }, sum);
+    ASSERT_EQ(sum, 45);
+    Kokkos::fence("traced_fence");
+    Kokkos::Profiling::markEvent("traced_marker");
+    Kokkos::Profiling::popRegion();
+  }
+  // events recorded from another host thread go onto their own buffer
+  std::thread([] {
+    Kokkos::Profiling::pushRegion("other_thread");
+    Kokkos::Profiling::popRegion();
+  }).join();
+
+  Kokkos::Tools::Impl::finalize_trace();
+  ASSERT_FALSE(Kokkos::Tools::Impl::trace_enabled());
+
+  auto const trace = read_file(file_name);
+  std::remove(file_name.c_str());
+
+  ASSERT_EQ(trace.find("{\"traceEvents\":["), 0u) << trace;
+  EXPECT_NE(trace.find("\"dropped_events\":0}}"), std::string::npos) << trace;
+  EXPECT_EQ(count_occurrences(trace, "\"name\":\"traced_for\""), 1u) << trace;
+  EXPECT_EQ(count_occurrences(trace, "\"name\":\"traced_reduce\""), 1u)
+      << trace;
+  EXPECT_EQ(count_occurrences(trace, "\"name\":\"traced_fence\""), 1u)
+      << trace;
+  EXPECT_EQ(count_occurrences(trace, "\"name\":\"outer \\\"region\\\"\""), 1u)
+      << trace;
+  EXPECT_EQ(count_occurrences(trace, "\"name\":\"other_thread\""), 1u)
+      << trace;
+  EXPECT_NE(trace.find("\"name\":\"traced_marker\",\"cat\":\"profile_event\","
+                       "\"ph\":\"i\""),
+            std::string::npos)
+      << trace;
+  EXPECT_NE(trace.find("\"name\":\"host thread 1\""), std::string::npos)
+      << trace;
+  EXPECT_NE(trace.find("\"name\":\"Kokkos::" +
+                       std::string(Kokkos::DefaultExecutionSpace::name()) +
+                       "\""),
+            std::string::npos)
+      << trace;
+
+  // once finalized, events are no longer recorded
+  Kokkos::Profiling::pushRegion("not_traced");
+  Kokkos::Profiling::popRegion();
+}
+
+}  // namespace
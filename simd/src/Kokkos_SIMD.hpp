@@ -0,0 +1,94 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_HPP
+#define KOKKOS_SIMD_HPP
+#ifndef KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE
+#define KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_SIMD
+#endif
+
+#include <Kokkos_SIMD_Common.hpp>
+
+#include <Kokkos_SIMD_Scalar.hpp>
+
+#if defined(KOKKOS_ARCH_AVX2) || defined(KOKKOS_ARCH_AVX512XEON)
+#if !defined(__AVX2__)
+#error "Kokkos was configured for AVX2 but the compiler does not enable it"
+#endif
+#include <Kokkos_SIMD_AVX2.hpp>
+#endif
+
+#ifdef KOKKOS_ARCH_AVX512XEON
+#if !defined(__AVX512F__) || !defined(__AVX512VL__) || !defined(__AVX512DQ__)
+#error \
+    "Kokkos was configured for AVX-512 but the compiler does not enable AVX512F, AVX512VL and AVX512DQ"
+#endif
+#include <Kokkos_SIMD_AVX512.hpp>
+#endif
+
+#if defined(__ARM_NEON) && defined(__aarch64__)
+#include <Kokkos_SIMD_NEON.hpp>
+#endif
+
+#include <Kokkos_SIMD_Common_Math.hpp>
+#include <Kokkos_SIMD_Math.hpp>
+
+namespace Kokkos {
+namespace Experimental {
+
+namespace simd_abi {
+
+namespace Impl {
+
+#if defined(KOKKOS_ARCH_AVX512XEON)
+using host_native = avx512_fixed_size<8>;
+#elif defined(KOKKOS_ARCH_AVX2)
+using host_native = avx2_fixed_size<4>;
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+using host_native = neon_fixed_size<2>;
+#else
+using host_native = scalar;
+#endif
+
+}  // namespace Impl
+
+// The widest ABI that code running in Space can use. Device backends use the
+// scalar ABI, which gets its parallelism from the vector lanes of the team
+// instead.
+template <class Space>
+using ForSpace = std::conditional_t<
+    SpaceAccessibility<typename Space::execution_space, HostSpace>::accessible,
+    Impl::host_native, scalar>;
+
+template <class T>
+using native = ForSpace<Kokkos::DefaultExecutionSpace>;
+
+}  // namespace simd_abi
+
+template <class T>
+using native_simd = simd<T, simd_abi::native<T>>;
+template <class T>
+using native_simd_mask = simd_mask<T, simd_abi::native<T>>;
+
+}  // namespace Experimental
+}  // namespace Kokkos
+
+#ifdef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_SIMD
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE
+#undef KOKKOS_IMPL_PUBLIC_INCLUDE_NOTDEFINED_SIMD
+#endif
+#endif
@@ -0,0 +1,1109 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_AVX2_HPP
+#define KOKKOS_SIMD_AVX2_HPP
+
+#include <functional>
+#include <type_traits>
+
+#include <Kokkos_SIMD_Common.hpp>
+
+#include <immintrin.h>
+
+namespace Kokkos {
+
+namespace Experimental {
+
+namespace simd_abi {
+
+// All value types use the same number of lanes so that a double simd can be
+// indexed, masked and converted with the int32 simd of the same ABI.
+template <int N>
+class avx2_fixed_size {};
+
+}  // namespace simd_abi
+
+// The mask of every value type is kept as four 64-bit lanes of all ones or
+// all zeros. The 4-lane float and int32 types, which live in 128-bit
+// registers, convert to and from the 32-bit lane layout when they blend.
+template <class T>
+class simd_mask<T, simd_abi::avx2_fixed_size<4>> {
+  __m256i m_value;
+
+ public:
+  using value_type = bool;
+  using simd_type  = simd<T, simd_abi::avx2_fixed_size<4>>;
+  using abi_type   = simd_abi::avx2_fixed_size<4>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd_mask() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(value_type value)
+      : m_value(_mm256_set1_epi64x(-std::int64_t(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen)
+      : m_value(_mm256_setr_epi64x(
+            -std::int64_t(bool(gen(std::integral_constant<std::size_t, 0>()))),
+            -std::int64_t(bool(gen(std::integral_constant<std::size_t, 1>()))),
+            -std::int64_t(bool(gen(std::integral_constant<std::size_t, 2>()))),
+            -std::int64_t(
+                bool(gen(std::integral_constant<std::size_t, 3>()))))) {}
+  template <class U>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask(
+      simd_mask<U, abi_type> const& other)
+      : m_value(static_cast<__m256i>(other)) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(
+      __m256i const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator __m256i() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION __m128i impl_packed() const {
+    return _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(
+        m_value, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static simd_mask impl_from_packed(
+      __m128i const& value) {
+    return simd_mask(_mm256_cvtepi32_epi64(value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION int impl_movemask() const {
+    return _mm256_movemask_pd(_mm256_castsi256_pd(m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return (impl_movemask() >> i) & 1;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask
+  operator||(simd_mask const& other) const {
+    return simd_mask(_mm256_or_si256(m_value, other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask
+  operator&&(simd_mask const& other) const {
+    return simd_mask(_mm256_and_si256(m_value, other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(_mm256_xor_si256(m_value, _mm256_set1_epi64x(-1)));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator==(
+      simd_mask const& other) const {
+    return impl_movemask() == other.impl_movemask();
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator!=(
+      simd_mask const& other) const {
+    return impl_movemask() != other.impl_movemask();
+  }
+};
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<T, simd_abi::avx2_fixed_size<4>> const& mask) {
+  return mask.impl_movemask() == 0xF;
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<T, simd_abi::avx2_fixed_size<4>> const& mask) {
+  return mask.impl_movemask() != 0;
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<T, simd_abi::avx2_fixed_size<4>> const& mask) {
+  return mask.impl_movemask() == 0;
+}
+
+template <>
+class simd<float, simd_abi::avx2_fixed_size<4>>;
+
+template <>
+class simd<std::int32_t, simd_abi::avx2_fixed_size<4>>;
+
+template <>
+class simd<std::int64_t, simd_abi::avx2_fixed_size<4>>;
+
+template <>
+class simd<double, simd_abi::avx2_fixed_size<4>> {
+  __m256d m_value;
+
+ public:
+  using value_type = double;
+  using abi_type   = simd_abi::avx2_fixed_size<4>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm256_set1_pd(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(_mm256_setr_pd(gen(std::integral_constant<std::size_t, 0>()),
+                               gen(std::integral_constant<std::size_t, 1>()),
+                               gen(std::integral_constant<std::size_t, 2>()),
+                               gen(std::integral_constant<std::size_t, 3>()))) {
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(__m256d const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<float, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int32_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int64_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator __m256d() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[4];
+    _mm256_storeu_pd(lanes, m_value);
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = _mm256_loadu_pd(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm256_load_pd(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm256_storeu_pd(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    _mm256_store_pd(ptr, m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm256_xor_pd(m_value, _mm256_set1_pd(-0.0)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_add_pd(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_sub_pd(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_mul_pd(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_div_pd(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_castpd_si256(
+        _mm256_cmp_pd(lhs.m_value, rhs.m_value, _CMP_EQ_OQ)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_castpd_si256(
+        _mm256_cmp_pd(lhs.m_value, rhs.m_value, _CMP_NEQ_UQ)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_castpd_si256(
+        _mm256_cmp_pd(lhs.m_value, rhs.m_value, _CMP_LT_OQ)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_castpd_si256(
+        _mm256_cmp_pd(lhs.m_value, rhs.m_value, _CMP_LE_OQ)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_castpd_si256(
+        _mm256_cmp_pd(lhs.m_value, rhs.m_value, _CMP_GT_OQ)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_castpd_si256(
+        _mm256_cmp_pd(lhs.m_value, rhs.m_value, _CMP_GE_OQ)));
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx2_fixed_size<4>>
+    condition(simd_mask<double, simd_abi::avx2_fixed_size<4>> const& mask,
+              simd<double, simd_abi::avx2_fixed_size<4>> const& a,
+              simd<double, simd_abi::avx2_fixed_size<4>> const& b) {
+  return simd<double, simd_abi::avx2_fixed_size<4>>(_mm256_blendv_pd(
+      static_cast<__m256d>(b), static_cast<__m256d>(a),
+      _mm256_castsi256_pd(static_cast<__m256i>(mask))));
+}
+
+template <>
+class simd<float, simd_abi::avx2_fixed_size<4>> {
+  __m128 m_value;
+
+ public:
+  using value_type = float;
+  using abi_type   = simd_abi::avx2_fixed_size<4>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm_set1_ps(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(_mm_setr_ps(gen(std::integral_constant<std::size_t, 0>()),
+                            gen(std::integral_constant<std::size_t, 1>()),
+                            gen(std::integral_constant<std::size_t, 2>()),
+                            gen(std::integral_constant<std::size_t, 3>()))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(__m128 const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<double, abi_type> const& other)
+      : m_value(_mm256_cvtpd_ps(static_cast<__m256d>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int32_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator __m128() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[4];
+    _mm_storeu_ps(lanes, m_value);
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = _mm_loadu_ps(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm_load_ps(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm_storeu_ps(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    _mm_store_ps(ptr, m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm_xor_ps(m_value, _mm_set1_ps(-0.0f)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm_add_ps(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm_sub_ps(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm_mul_ps(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm_div_ps(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(
+        _mm_castps_si128(_mm_cmp_ps(lhs.m_value, rhs.m_value, _CMP_EQ_OQ)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(
+        _mm_castps_si128(_mm_cmp_ps(lhs.m_value, rhs.m_value, _CMP_NEQ_UQ)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(
+        _mm_castps_si128(_mm_cmp_ps(lhs.m_value, rhs.m_value, _CMP_LT_OQ)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(
+        _mm_castps_si128(_mm_cmp_ps(lhs.m_value, rhs.m_value, _CMP_LE_OQ)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(
+        _mm_castps_si128(_mm_cmp_ps(lhs.m_value, rhs.m_value, _CMP_GT_OQ)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(
+        _mm_castps_si128(_mm_cmp_ps(lhs.m_value, rhs.m_value, _CMP_GE_OQ)));
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<float, simd_abi::avx2_fixed_size<4>>
+    condition(simd_mask<float, simd_abi::avx2_fixed_size<4>> const& mask,
+              simd<float, simd_abi::avx2_fixed_size<4>> const& a,
+              simd<float, simd_abi::avx2_fixed_size<4>> const& b) {
+  return simd<float, simd_abi::avx2_fixed_size<4>>(
+      _mm_blendv_ps(static_cast<__m128>(b), static_cast<__m128>(a),
+                    _mm_castsi128_ps(mask.impl_packed())));
+}
+
+template <>
+class simd<std::int32_t, simd_abi::avx2_fixed_size<4>> {
+  __m128i m_value;
+
+ public:
+  using value_type = std::int32_t;
+  using abi_type   = simd_abi::avx2_fixed_size<4>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm_set1_epi32(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(_mm_setr_epi32(gen(std::integral_constant<std::size_t, 0>()),
+                               gen(std::integral_constant<std::size_t, 1>()),
+                               gen(std::integral_constant<std::size_t, 2>()),
+                               gen(std::integral_constant<std::size_t, 3>()))) {
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(__m128i const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<double, abi_type> const& other)
+      : m_value(_mm256_cvttpd_epi32(static_cast<__m256d>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<float, abi_type> const& other)
+      : m_value(_mm_cvttps_epi32(static_cast<__m128>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int64_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator __m128i() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[4];
+    copy_to(lanes, element_aligned_tag());
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm_load_si128(reinterpret_cast<__m128i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(ptr), m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    _mm_store_si128(reinterpret_cast<__m128i*>(ptr), m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm_sub_epi32(_mm_setzero_si128(), m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm_add_epi32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm_sub_epi32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm_mullo_epi32(lhs.m_value, rhs.m_value));
+  }
+  // There is no packed integer division; divide lane by lane.
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    value_type a[4], b[4];
+    lhs.copy_to(a, element_aligned_tag());
+    rhs.copy_to(b, element_aligned_tag());
+    return simd(_mm_setr_epi32(a[0] / b[0], a[1] / b[1], a[2] / b[2],
+                               a[3] / b[3]));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator<<(
+      simd const& lhs, int rhs) {
+    return simd(_mm_sll_epi32(lhs.m_value, _mm_cvtsi32_si128(rhs)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator>>(
+      simd const& lhs, int rhs) {
+    return simd(_mm_sra_epi32(lhs.m_value, _mm_cvtsi32_si128(rhs)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(
+        _mm_cmpeq_epi32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return !(lhs == rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(
+        _mm_cmplt_epi32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(
+        _mm_cmpgt_epi32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return !(lhs > rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return !(lhs < rhs);
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx2_fixed_size<4>>
+    condition(simd_mask<std::int32_t, simd_abi::avx2_fixed_size<4>> const& mask,
+              simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& a,
+              simd<std::int32_t, simd_abi::avx2_fixed_size<4>> const& b) {
+  return simd<std::int32_t, simd_abi::avx2_fixed_size<4>>(
+      _mm_blendv_epi8(static_cast<__m128i>(b), static_cast<__m128i>(a),
+                      mask.impl_packed()));
+}
+
+template <>
+class simd<std::int64_t, simd_abi::avx2_fixed_size<4>> {
+  __m256i m_value;
+
+ public:
+  using value_type = std::int64_t;
+  using abi_type   = simd_abi::avx2_fixed_size<4>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 4;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm256_set1_epi64x(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(
+            _mm256_setr_epi64x(gen(std::integral_constant<std::size_t, 0>()),
+                               gen(std::integral_constant<std::size_t, 1>()),
+                               gen(std::integral_constant<std::size_t, 2>()),
+                               gen(std::integral_constant<std::size_t, 3>()))) {
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(__m256i const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int32_t, abi_type> const& other)
+      : m_value(_mm256_cvtepi32_epi64(static_cast<__m128i>(other))) {}
+  // AVX2 has no conversion between packed doubles and 64-bit integers.
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<double, abi_type> const& other) {
+    double lanes[4];
+    other.copy_to(lanes, element_aligned_tag());
+    m_value = _mm256_setr_epi64x(value_type(lanes[0]), value_type(lanes[1]),
+                                 value_type(lanes[2]), value_type(lanes[3]));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator __m256i() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[4];
+    copy_to(lanes, element_aligned_tag());
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm256_sub_epi64(_mm256_setzero_si256(), m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_add_epi64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_sub_epi64(lhs.m_value, rhs.m_value));
+  }
+  // AVX2 lacks 64-bit multiplication and division; these are computed lane by
+  // lane.
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    value_type a[4], b[4];
+    lhs.copy_to(a, element_aligned_tag());
+    rhs.copy_to(b, element_aligned_tag());
+    return simd(_mm256_setr_epi64x(a[0] * b[0], a[1] * b[1], a[2] * b[2],
+                                   a[3] * b[3]));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    value_type a[4], b[4];
+    lhs.copy_to(a, element_aligned_tag());
+    rhs.copy_to(b, element_aligned_tag());
+    return simd(_mm256_setr_epi64x(a[0] / b[0], a[1] / b[1], a[2] / b[2],
+                                   a[3] / b[3]));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator<<(
+      simd const& lhs, int rhs) {
+    return simd(_mm256_sll_epi64(lhs.m_value, _mm_cvtsi32_si128(rhs)));
+  }
+  // AVX2 has no 64-bit arithmetic right shift: shift logically and then
+  // sign-extend from the bit the sign bit landed on.
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator>>(
+      simd const& lhs, int rhs) {
+    __m128i const count = _mm_cvtsi32_si128(rhs);
+    __m256i const sign =
+        _mm256_srl_epi64(_mm256_set1_epi64x(INT64_MIN), count);
+    return simd(_mm256_sub_epi64(
+        _mm256_xor_si256(_mm256_srl_epi64(lhs.m_value, count), sign), sign));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_cmpeq_epi64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return !(lhs == rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_cmpgt_epi64(rhs.m_value, lhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_cmpgt_epi64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return !(lhs > rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return !(lhs < rhs);
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int64_t, simd_abi::avx2_fixed_size<4>>
+    condition(simd_mask<std::int64_t, simd_abi::avx2_fixed_size<4>> const& mask,
+              simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& a,
+              simd<std::int64_t, simd_abi::avx2_fixed_size<4>> const& b) {
+  return simd<std::int64_t, simd_abi::avx2_fixed_size<4>>(
+      _mm256_blendv_epi8(static_cast<__m256i>(b), static_cast<__m256i>(a),
+                         static_cast<__m256i>(mask)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<double, simd_abi::avx2_fixed_size<4>>::simd(
+    simd<float, abi_type> const& other)
+    : m_value(_mm256_cvtps_pd(static_cast<__m128>(other))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<double, simd_abi::avx2_fixed_size<4>>::simd(
+    simd<std::int32_t, abi_type> const& other)
+    : m_value(_mm256_cvtepi32_pd(static_cast<__m128i>(other))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<double, simd_abi::avx2_fixed_size<4>>::simd(
+    simd<std::int64_t, abi_type> const& other) {
+  std::int64_t lanes[4];
+  other.copy_to(lanes, element_aligned_tag());
+  m_value = _mm256_setr_pd(value_type(lanes[0]), value_type(lanes[1]),
+                           value_type(lanes[2]), value_type(lanes[3]));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<float, simd_abi::avx2_fixed_size<4>>::simd(
+    simd<std::int32_t, abi_type> const& other)
+    : m_value(_mm_cvtepi32_ps(static_cast<__m128i>(other))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<std::int32_t, simd_abi::avx2_fixed_size<4>>::simd(
+    simd<std::int64_t, abi_type> const& other)
+    : m_value(_mm256_castsi256_si128(_mm256_permutevar8x32_epi32(
+          static_cast<__m256i>(other),
+          _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)))) {}
+
+namespace Impl {
+
+template <>
+struct simd_masked_memory<simd<double, simd_abi::avx2_fixed_size<4>>>
+    : simd_masked_memory_by_lane<simd<double, simd_abi::avx2_fixed_size<4>>> {
+  using simd_type  = simd<double, simd_abi::avx2_fixed_size<4>>;
+  using mask_type  = simd_type::mask_type;
+  using index_type = simd<std::int32_t, simd_abi::avx2_fixed_size<4>>;
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_from(
+      mask_type const& mask, simd_type& value, double const* mem) {
+    value = condition(
+        mask,
+        simd_type(_mm256_maskload_pd(mem, static_cast<__m256i>(mask))),
+        value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_to(
+      mask_type const& mask, simd_type const& value, double* mem) {
+    _mm256_maskstore_pd(mem, static_cast<__m256i>(mask),
+                        static_cast<__m256d>(value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void gather_from(
+      mask_type const& mask, simd_type& value, double const* mem,
+      index_type const& index) {
+    value = simd_type(_mm256_mask_i32gather_pd(
+        static_cast<__m256d>(value), mem, static_cast<__m128i>(index),
+        _mm256_castsi256_pd(static_cast<__m256i>(mask)), 8));
+  }
+};
+
+template <>
+struct simd_masked_memory<simd<float, simd_abi::avx2_fixed_size<4>>>
+    : simd_masked_memory_by_lane<simd<float, simd_abi::avx2_fixed_size<4>>> {
+  using simd_type  = simd<float, simd_abi::avx2_fixed_size<4>>;
+  using mask_type  = simd_type::mask_type;
+  using index_type = simd<std::int32_t, simd_abi::avx2_fixed_size<4>>;
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_from(
+      mask_type const& mask, simd_type& value, float const* mem) {
+    value = condition(mask,
+                      simd_type(_mm_maskload_ps(mem, mask.impl_packed())),
+                      value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_to(
+      mask_type const& mask, simd_type const& value, float* mem) {
+    _mm_maskstore_ps(mem, mask.impl_packed(), static_cast<__m128>(value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void gather_from(
+      mask_type const& mask, simd_type& value, float const* mem,
+      index_type const& index) {
+    value = simd_type(_mm_mask_i32gather_ps(
+        static_cast<__m128>(value), mem, static_cast<__m128i>(index),
+        _mm_castsi128_ps(mask.impl_packed()), 4));
+  }
+};
+
+template <>
+struct simd_masked_memory<simd<std::int32_t, simd_abi::avx2_fixed_size<4>>>
+    : simd_masked_memory_by_lane<
+          simd<std::int32_t, simd_abi::avx2_fixed_size<4>>> {
+  using simd_type  = simd<std::int32_t, simd_abi::avx2_fixed_size<4>>;
+  using mask_type  = simd_type::mask_type;
+  using index_type = simd_type;
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_from(
+      mask_type const& mask, simd_type& value, std::int32_t const* mem) {
+    value = condition(mask,
+                      simd_type(_mm_maskload_epi32(mem, mask.impl_packed())),
+                      value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_to(
+      mask_type const& mask, simd_type const& value, std::int32_t* mem) {
+    _mm_maskstore_epi32(mem, mask.impl_packed(), static_cast<__m128i>(value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void gather_from(
+      mask_type const& mask, simd_type& value, std::int32_t const* mem,
+      index_type const& index) {
+    value = simd_type(_mm_mask_i32gather_epi32(
+        static_cast<__m128i>(value), mem, static_cast<__m128i>(index),
+        mask.impl_packed(), 4));
+  }
+};
+
+template <>
+struct simd_masked_memory<simd<std::int64_t, simd_abi::avx2_fixed_size<4>>>
+    : simd_masked_memory_by_lane<
+          simd<std::int64_t, simd_abi::avx2_fixed_size<4>>> {
+  using simd_type  = simd<std::int64_t, simd_abi::avx2_fixed_size<4>>;
+  using mask_type  = simd_type::mask_type;
+  using index_type = simd<std::int32_t, simd_abi::avx2_fixed_size<4>>;
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_from(
+      mask_type const& mask, simd_type& value, std::int64_t const* mem) {
+    value = condition(
+        mask,
+        simd_type(_mm256_maskload_epi64(
+            reinterpret_cast<long long const*>(mem),
+            static_cast<__m256i>(mask))),
+        value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_to(
+      mask_type const& mask, simd_type const& value, std::int64_t* mem) {
+    _mm256_maskstore_epi64(reinterpret_cast<long long*>(mem),
+                           static_cast<__m256i>(mask),
+                           static_cast<__m256i>(value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void gather_from(
+      mask_type const& mask, simd_type& value, std::int64_t const* mem,
+      index_type const& index) {
+    value = simd_type(_mm256_mask_i32gather_epi64(
+        static_cast<__m256i>(value), reinterpret_cast<long long const*>(mem),
+        static_cast<__m128i>(index), static_cast<__m256i>(mask), 8));
+  }
+};
+
+}  // namespace Impl
+
+}  // namespace Experimental
+
+// Math functions that map to AVX2 instructions. round() is computed as
+// trunc(x + copysign(0.5 - ulp, x)) since the hardware rounding mode breaks
+// ties to even rather than away from zero.
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+    abs(Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& a) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm256_andnot_pd(_mm256_set1_pd(-0.0), static_cast<__m256d>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+    sqrt(Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+             const& a) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm256_sqrt_pd(static_cast<__m256d>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+    floor(Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+              const& a) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm256_round_pd(static_cast<__m256d>(a),
+                      _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+    ceil(Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+             const& a) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm256_round_pd(static_cast<__m256d>(a),
+                      _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+    trunc(Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+              const& a) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm256_round_pd(static_cast<__m256d>(a),
+                      _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+    copysign(
+        Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& a,
+        Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& b) {
+  __m256d const sign_mask = _mm256_set1_pd(-0.0);
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm256_or_pd(_mm256_andnot_pd(sign_mask, static_cast<__m256d>(a)),
+                   _mm256_and_pd(sign_mask, static_cast<__m256d>(b))));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+    round(Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+              const& a) {
+  return Kokkos::trunc(a + Kokkos::copysign(
+                               Experimental::simd<
+                                   double,
+                                   Experimental::simd_abi::avx2_fixed_size<4>>(
+                                   0.49999999999999994),
+                               a));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+    min(Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& a,
+        Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& b) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm256_min_pd(static_cast<__m256d>(b), static_cast<__m256d>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+    max(Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& a,
+        Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& b) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm256_max_pd(static_cast<__m256d>(b), static_cast<__m256d>(a)));
+}
+
+#ifdef __FMA__
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+    fma(Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& a,
+        Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& b,
+        Experimental::simd<double, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& c) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm256_fmadd_pd(static_cast<__m256d>(a), static_cast<__m256d>(b),
+                      static_cast<__m256d>(c)));
+}
+#endif
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+    abs(Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_andnot_ps(_mm_set1_ps(-0.0f), static_cast<__m128>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+    sqrt(Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+             const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_sqrt_ps(static_cast<__m128>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+    floor(Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+              const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_round_ps(static_cast<__m128>(a),
+                   _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+    ceil(Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+             const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_round_ps(static_cast<__m128>(a),
+                   _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+    trunc(Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+              const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_round_ps(static_cast<__m128>(a),
+                   _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+    copysign(
+        Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& a,
+        Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& b) {
+  __m128 const sign_mask = _mm_set1_ps(-0.0f);
+  return Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_or_ps(_mm_andnot_ps(sign_mask, static_cast<__m128>(a)),
+                _mm_and_ps(sign_mask, static_cast<__m128>(b))));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+    round(Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+              const& a) {
+  return Kokkos::trunc(
+      a + Kokkos::copysign(
+              Experimental::simd<float,
+                                 Experimental::simd_abi::avx2_fixed_size<4>>(
+                  0.49999997f),
+              a));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+    min(Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& a,
+        Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& b) {
+  return Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_min_ps(static_cast<__m128>(b), static_cast<__m128>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+    max(Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& a,
+        Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& b) {
+  return Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_max_ps(static_cast<__m128>(b), static_cast<__m128>(a)));
+}
+
+#ifdef __FMA__
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+    fma(Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& a,
+        Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& b,
+        Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>
+            const& c) {
+  return Experimental::simd<float, Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_fmadd_ps(static_cast<__m128>(a), static_cast<__m128>(b),
+                   static_cast<__m128>(c)));
+}
+#endif
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int32_t,
+                       Experimental::simd_abi::avx2_fixed_size<4>>
+    abs(Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::avx2_fixed_size<4>> const&
+            a) {
+  return Experimental::simd<std::int32_t,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_abs_epi32(static_cast<__m128i>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int32_t,
+                       Experimental::simd_abi::avx2_fixed_size<4>>
+    min(Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::avx2_fixed_size<4>> const& a,
+        Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::avx2_fixed_size<4>> const&
+            b) {
+  return Experimental::simd<std::int32_t,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_min_epi32(static_cast<__m128i>(a), static_cast<__m128i>(b)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int32_t,
+                       Experimental::simd_abi::avx2_fixed_size<4>>
+    max(Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::avx2_fixed_size<4>> const& a,
+        Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::avx2_fixed_size<4>> const&
+            b) {
+  return Experimental::simd<std::int32_t,
+                            Experimental::simd_abi::avx2_fixed_size<4>>(
+      _mm_max_epi32(static_cast<__m128i>(a), static_cast<__m128i>(b)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int64_t,
+                       Experimental::simd_abi::avx2_fixed_size<4>>
+    abs(Experimental::simd<std::int64_t,
+                           Experimental::simd_abi::avx2_fixed_size<4>> const&
+            a) {
+  return Experimental::condition(
+      a < Experimental::simd<std::int64_t,
+                             Experimental::simd_abi::avx2_fixed_size<4>>(0),
+      -a, a);
+}
+
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,1172 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_AVX512_HPP
+#define KOKKOS_SIMD_AVX512_HPP
+
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+#include <Kokkos_SIMD_Common.hpp>
+
+#include <immintrin.h>
+
+namespace Kokkos {
+
+namespace Experimental {
+
+namespace simd_abi {
+
+template <int N>
+class avx512_fixed_size {};
+
+}  // namespace simd_abi
+
+// Masks of every value type are held in a k-register with one bit per lane,
+// so they convert freely between the value types of the ABI.
+template <class T>
+class simd_mask<T, simd_abi::avx512_fixed_size<8>> {
+  __mmask8 m_value;
+
+  template <class G, std::size_t... Lanes>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static __mmask8 impl_from_generator(
+      G& gen, std::index_sequence<Lanes...>) {
+    return __mmask8(
+        ((unsigned(bool(gen(std::integral_constant<std::size_t, Lanes>())))
+          << Lanes) |
+         ...));
+  }
+
+ public:
+  using value_type = bool;
+  using simd_type  = simd<T, simd_abi::avx512_fixed_size<8>>;
+  using abi_type   = simd_abi::avx512_fixed_size<8>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd_mask() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 8;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(value_type value)
+      : m_value(value ? 0xFF : 0) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen)
+      : m_value(impl_from_generator(gen, std::make_index_sequence<8>())) {}
+  template <class U>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask(
+      simd_mask<U, abi_type> const& other)
+      : m_value(static_cast<__mmask8>(other)) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(
+      __mmask8 const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator __mmask8() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    return (m_value >> i) & 1;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask
+  operator||(simd_mask const& other) const {
+    return simd_mask(__mmask8(m_value | other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask
+  operator&&(simd_mask const& other) const {
+    return simd_mask(__mmask8(m_value & other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(__mmask8(~m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator==(
+      simd_mask const& other) const {
+    return m_value == other.m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator!=(
+      simd_mask const& other) const {
+    return m_value != other.m_value;
+  }
+};
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<T, simd_abi::avx512_fixed_size<8>> const& mask) {
+  return static_cast<__mmask8>(mask) == 0xFF;
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<T, simd_abi::avx512_fixed_size<8>> const& mask) {
+  return static_cast<__mmask8>(mask) != 0;
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<T, simd_abi::avx512_fixed_size<8>> const& mask) {
+  return static_cast<__mmask8>(mask) == 0;
+}
+
+template <>
+class simd<float, simd_abi::avx512_fixed_size<8>>;
+
+template <>
+class simd<std::int32_t, simd_abi::avx512_fixed_size<8>>;
+
+template <>
+class simd<std::int64_t, simd_abi::avx512_fixed_size<8>>;
+
+template <>
+class simd<double, simd_abi::avx512_fixed_size<8>> {
+  __m512d m_value;
+
+ public:
+  using value_type = double;
+  using abi_type   = simd_abi::avx512_fixed_size<8>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 8;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm512_set1_pd(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(_mm512_setr_pd(gen(std::integral_constant<std::size_t, 0>()),
+                               gen(std::integral_constant<std::size_t, 1>()),
+                               gen(std::integral_constant<std::size_t, 2>()),
+                               gen(std::integral_constant<std::size_t, 3>()),
+                               gen(std::integral_constant<std::size_t, 4>()),
+                               gen(std::integral_constant<std::size_t, 5>()),
+                               gen(std::integral_constant<std::size_t, 6>()),
+                               gen(std::integral_constant<std::size_t, 7>()))) {
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(__m512d const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<float, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int32_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int64_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator __m512d() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[8];
+    _mm512_storeu_pd(lanes, m_value);
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = _mm512_loadu_pd(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm512_load_pd(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm512_storeu_pd(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    _mm512_store_pd(ptr, m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm512_xor_pd(m_value, _mm512_set1_pd(-0.0)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm512_add_pd(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm512_sub_pd(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm512_mul_pd(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm512_div_pd(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm512_cmp_pd_mask(lhs.m_value, rhs.m_value, _CMP_EQ_OQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm512_cmp_pd_mask(lhs.m_value, rhs.m_value, _CMP_NEQ_UQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm512_cmp_pd_mask(lhs.m_value, rhs.m_value, _CMP_LT_OQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm512_cmp_pd_mask(lhs.m_value, rhs.m_value, _CMP_LE_OQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm512_cmp_pd_mask(lhs.m_value, rhs.m_value, _CMP_GT_OQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm512_cmp_pd_mask(lhs.m_value, rhs.m_value, _CMP_GE_OQ));
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::avx512_fixed_size<8>>
+    condition(simd_mask<double, simd_abi::avx512_fixed_size<8>> const& mask,
+              simd<double, simd_abi::avx512_fixed_size<8>> const& a,
+              simd<double, simd_abi::avx512_fixed_size<8>> const& b) {
+  return simd<double, simd_abi::avx512_fixed_size<8>>(
+      _mm512_mask_blend_pd(static_cast<__mmask8>(mask),
+                           static_cast<__m512d>(b), static_cast<__m512d>(a)));
+}
+
+template <>
+class simd<float, simd_abi::avx512_fixed_size<8>> {
+  __m256 m_value;
+
+ public:
+  using value_type = float;
+  using abi_type   = simd_abi::avx512_fixed_size<8>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 8;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm256_set1_ps(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(_mm256_setr_ps(gen(std::integral_constant<std::size_t, 0>()),
+                               gen(std::integral_constant<std::size_t, 1>()),
+                               gen(std::integral_constant<std::size_t, 2>()),
+                               gen(std::integral_constant<std::size_t, 3>()),
+                               gen(std::integral_constant<std::size_t, 4>()),
+                               gen(std::integral_constant<std::size_t, 5>()),
+                               gen(std::integral_constant<std::size_t, 6>()),
+                               gen(std::integral_constant<std::size_t, 7>()))) {
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(__m256 const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<double, abi_type> const& other)
+      : m_value(_mm512_cvtpd_ps(static_cast<__m512d>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int32_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator __m256() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[8];
+    _mm256_storeu_ps(lanes, m_value);
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = _mm256_loadu_ps(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm256_load_ps(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm256_storeu_ps(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    _mm256_store_ps(ptr, m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm256_xor_ps(m_value, _mm256_set1_ps(-0.0f)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_add_ps(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_sub_ps(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_mul_ps(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_div_ps(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_cmp_ps_mask(lhs.m_value, rhs.m_value, _CMP_EQ_OQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm256_cmp_ps_mask(lhs.m_value, rhs.m_value, _CMP_NEQ_UQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_cmp_ps_mask(lhs.m_value, rhs.m_value, _CMP_LT_OQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_cmp_ps_mask(lhs.m_value, rhs.m_value, _CMP_LE_OQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_cmp_ps_mask(lhs.m_value, rhs.m_value, _CMP_GT_OQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type(_mm256_cmp_ps_mask(lhs.m_value, rhs.m_value, _CMP_GE_OQ));
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<float, simd_abi::avx512_fixed_size<8>>
+    condition(simd_mask<float, simd_abi::avx512_fixed_size<8>> const& mask,
+              simd<float, simd_abi::avx512_fixed_size<8>> const& a,
+              simd<float, simd_abi::avx512_fixed_size<8>> const& b) {
+  return simd<float, simd_abi::avx512_fixed_size<8>>(
+      _mm256_mask_blend_ps(static_cast<__mmask8>(mask), static_cast<__m256>(b),
+                           static_cast<__m256>(a)));
+}
+
+template <>
+class simd<std::int32_t, simd_abi::avx512_fixed_size<8>> {
+  __m256i m_value;
+
+ public:
+  using value_type = std::int32_t;
+  using abi_type   = simd_abi::avx512_fixed_size<8>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 8;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm256_set1_epi32(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(
+            _mm256_setr_epi32(gen(std::integral_constant<std::size_t, 0>()),
+                              gen(std::integral_constant<std::size_t, 1>()),
+                              gen(std::integral_constant<std::size_t, 2>()),
+                              gen(std::integral_constant<std::size_t, 3>()),
+                              gen(std::integral_constant<std::size_t, 4>()),
+                              gen(std::integral_constant<std::size_t, 5>()),
+                              gen(std::integral_constant<std::size_t, 6>()),
+                              gen(std::integral_constant<std::size_t, 7>()))) {
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(__m256i const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<double, abi_type> const& other)
+      : m_value(_mm512_cvttpd_epi32(static_cast<__m512d>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<float, abi_type> const& other)
+      : m_value(_mm256_cvttps_epi32(static_cast<__m256>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int64_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator __m256i() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[8];
+    copy_to(lanes, element_aligned_tag());
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm256_load_si256(reinterpret_cast<__m256i const*>(ptr));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    _mm256_store_si256(reinterpret_cast<__m256i*>(ptr), m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm256_sub_epi32(_mm256_setzero_si256(), m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_add_epi32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_sub_epi32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm256_mullo_epi32(lhs.m_value, rhs.m_value));
+  }
+  // There is no packed integer division; divide lane by lane.
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    value_type a[8], b[8];
+    lhs.copy_to(a, element_aligned_tag());
+    rhs.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 8; ++i) a[i] /= b[i];
+    simd result;
+    result.copy_from(a, element_aligned_tag());
+    return result;
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator<<(
+      simd const& lhs, int rhs) {
+    return simd(_mm256_sll_epi32(lhs.m_value, _mm_cvtsi32_si128(rhs)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator>>(
+      simd const& lhs, int rhs) {
+    return simd(_mm256_sra_epi32(lhs.m_value, _mm_cvtsi32_si128(rhs)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm256_cmp_epi32_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_EQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm256_cmp_epi32_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_NE));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm256_cmp_epi32_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_LT));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm256_cmp_epi32_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_LE));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm256_cmp_epi32_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_NLE));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm256_cmp_epi32_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_NLT));
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::avx512_fixed_size<8>>
+    condition(
+        simd_mask<std::int32_t, simd_abi::avx512_fixed_size<8>> const& mask,
+        simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& a,
+        simd<std::int32_t, simd_abi::avx512_fixed_size<8>> const& b) {
+  return simd<std::int32_t, simd_abi::avx512_fixed_size<8>>(
+      _mm256_mask_blend_epi32(static_cast<__mmask8>(mask),
+                              static_cast<__m256i>(b),
+                              static_cast<__m256i>(a)));
+}
+
+template <>
+class simd<std::int64_t, simd_abi::avx512_fixed_size<8>> {
+  __m512i m_value;
+
+ public:
+  using value_type = std::int64_t;
+  using abi_type   = simd_abi::avx512_fixed_size<8>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 8;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(_mm512_set1_epi64(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen)
+      : m_value(
+            _mm512_setr_epi64(gen(std::integral_constant<std::size_t, 0>()),
+                              gen(std::integral_constant<std::size_t, 1>()),
+                              gen(std::integral_constant<std::size_t, 2>()),
+                              gen(std::integral_constant<std::size_t, 3>()),
+                              gen(std::integral_constant<std::size_t, 4>()),
+                              gen(std::integral_constant<std::size_t, 5>()),
+                              gen(std::integral_constant<std::size_t, 6>()),
+                              gen(std::integral_constant<std::size_t, 7>()))) {
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(__m512i const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int32_t, abi_type> const& other)
+      : m_value(_mm512_cvtepi32_epi64(static_cast<__m256i>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<double, abi_type> const& other)
+      : m_value(_mm512_cvttpd_epi64(static_cast<__m512d>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator __m512i() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[8];
+    copy_to(lanes, element_aligned_tag());
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = _mm512_loadu_si512(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = _mm512_load_si512(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    _mm512_storeu_si512(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    _mm512_store_si512(ptr, m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(_mm512_sub_epi64(_mm512_setzero_si512(), m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm512_add_epi64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm512_sub_epi64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(_mm512_mullo_epi64(lhs.m_value, rhs.m_value));
+  }
+  // There is no packed integer division; divide lane by lane.
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    value_type a[8], b[8];
+    lhs.copy_to(a, element_aligned_tag());
+    rhs.copy_to(b, element_aligned_tag());
+    for (int i = 0; i < 8; ++i) a[i] /= b[i];
+    simd result;
+    result.copy_from(a, element_aligned_tag());
+    return result;
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator<<(
+      simd const& lhs, int rhs) {
+    return simd(_mm512_sll_epi64(lhs.m_value, _mm_cvtsi32_si128(rhs)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator>>(
+      simd const& lhs, int rhs) {
+    return simd(_mm512_sra_epi64(lhs.m_value, _mm_cvtsi32_si128(rhs)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm512_cmp_epi64_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_EQ));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm512_cmp_epi64_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_NE));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm512_cmp_epi64_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_LT));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm512_cmp_epi64_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_LE));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm512_cmp_epi64_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_NLE));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type(
+        _mm512_cmp_epi64_mask(lhs.m_value, rhs.m_value, _MM_CMPINT_NLT));
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int64_t, simd_abi::avx512_fixed_size<8>>
+    condition(
+        simd_mask<std::int64_t, simd_abi::avx512_fixed_size<8>> const& mask,
+        simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& a,
+        simd<std::int64_t, simd_abi::avx512_fixed_size<8>> const& b) {
+  return simd<std::int64_t, simd_abi::avx512_fixed_size<8>>(
+      _mm512_mask_blend_epi64(static_cast<__mmask8>(mask),
+                              static_cast<__m512i>(b),
+                              static_cast<__m512i>(a)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<double, simd_abi::avx512_fixed_size<8>>::simd(
+    simd<float, abi_type> const& other)
+    : m_value(_mm512_cvtps_pd(static_cast<__m256>(other))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<double, simd_abi::avx512_fixed_size<8>>::simd(
+    simd<std::int32_t, abi_type> const& other)
+    : m_value(_mm512_cvtepi32_pd(static_cast<__m256i>(other))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<double, simd_abi::avx512_fixed_size<8>>::simd(
+    simd<std::int64_t, abi_type> const& other)
+    : m_value(_mm512_cvtepi64_pd(static_cast<__m512i>(other))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<float, simd_abi::avx512_fixed_size<8>>::simd(
+    simd<std::int32_t, abi_type> const& other)
+    : m_value(_mm256_cvtepi32_ps(static_cast<__m256i>(other))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<std::int32_t, simd_abi::avx512_fixed_size<8>>::simd(
+    simd<std::int64_t, abi_type> const& other)
+    : m_value(_mm512_cvtepi64_epi32(static_cast<__m512i>(other))) {}
+
+namespace Impl {
+
+template <>
+struct simd_masked_memory<simd<double, simd_abi::avx512_fixed_size<8>>> {
+  using simd_type  = simd<double, simd_abi::avx512_fixed_size<8>>;
+  using mask_type  = simd_type::mask_type;
+  using index_type = simd<std::int32_t, simd_abi::avx512_fixed_size<8>>;
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_from(
+      mask_type const& mask, simd_type& value, double const* mem) {
+    value = simd_type(_mm512_mask_loadu_pd(static_cast<__m512d>(value),
+                                           static_cast<__mmask8>(mask), mem));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_to(
+      mask_type const& mask, simd_type const& value, double* mem) {
+    _mm512_mask_storeu_pd(mem, static_cast<__mmask8>(mask),
+                          static_cast<__m512d>(value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void gather_from(
+      mask_type const& mask, simd_type& value, double const* mem,
+      index_type const& index) {
+    value = simd_type(_mm512_mask_i32gather_pd(
+        static_cast<__m512d>(value), static_cast<__mmask8>(mask),
+        static_cast<__m256i>(index), mem, 8));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void scatter_to(
+      mask_type const& mask, simd_type const& value, double* mem,
+      index_type const& index) {
+    _mm512_mask_i32scatter_pd(mem, static_cast<__mmask8>(mask),
+                              static_cast<__m256i>(index),
+                              static_cast<__m512d>(value), 8);
+  }
+};
+
+template <>
+struct simd_masked_memory<simd<float, simd_abi::avx512_fixed_size<8>>> {
+  using simd_type  = simd<float, simd_abi::avx512_fixed_size<8>>;
+  using mask_type  = simd_type::mask_type;
+  using index_type = simd<std::int32_t, simd_abi::avx512_fixed_size<8>>;
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_from(
+      mask_type const& mask, simd_type& value, float const* mem) {
+    value = simd_type(_mm256_mask_loadu_ps(static_cast<__m256>(value),
+                                           static_cast<__mmask8>(mask), mem));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_to(
+      mask_type const& mask, simd_type const& value, float* mem) {
+    _mm256_mask_storeu_ps(mem, static_cast<__mmask8>(mask),
+                          static_cast<__m256>(value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void gather_from(
+      mask_type const& mask, simd_type& value, float const* mem,
+      index_type const& index) {
+    value = simd_type(_mm256_mmask_i32gather_ps(
+        static_cast<__m256>(value), static_cast<__mmask8>(mask),
+        static_cast<__m256i>(index), mem, 4));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void scatter_to(
+      mask_type const& mask, simd_type const& value, float* mem,
+      index_type const& index) {
+    _mm256_mask_i32scatter_ps(mem, static_cast<__mmask8>(mask),
+                              static_cast<__m256i>(index),
+                              static_cast<__m256>(value), 4);
+  }
+};
+
+template <>
+struct simd_masked_memory<simd<std::int32_t, simd_abi::avx512_fixed_size<8>>> {
+  using simd_type  = simd<std::int32_t, simd_abi::avx512_fixed_size<8>>;
+  using mask_type  = simd_type::mask_type;
+  using index_type = simd_type;
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_from(
+      mask_type const& mask, simd_type& value, std::int32_t const* mem) {
+    value = simd_type(_mm256_mask_loadu_epi32(
+        static_cast<__m256i>(value), static_cast<__mmask8>(mask), mem));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_to(
+      mask_type const& mask, simd_type const& value, std::int32_t* mem) {
+    _mm256_mask_storeu_epi32(mem, static_cast<__mmask8>(mask),
+                             static_cast<__m256i>(value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void gather_from(
+      mask_type const& mask, simd_type& value, std::int32_t const* mem,
+      index_type const& index) {
+    value = simd_type(_mm256_mmask_i32gather_epi32(
+        static_cast<__m256i>(value), static_cast<__mmask8>(mask),
+        static_cast<__m256i>(index), mem, 4));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void scatter_to(
+      mask_type const& mask, simd_type const& value, std::int32_t* mem,
+      index_type const& index) {
+    _mm256_mask_i32scatter_epi32(mem, static_cast<__mmask8>(mask),
+                                 static_cast<__m256i>(index),
+                                 static_cast<__m256i>(value), 4);
+  }
+};
+
+template <>
+struct simd_masked_memory<simd<std::int64_t, simd_abi::avx512_fixed_size<8>>> {
+  using simd_type  = simd<std::int64_t, simd_abi::avx512_fixed_size<8>>;
+  using mask_type  = simd_type::mask_type;
+  using index_type = simd<std::int32_t, simd_abi::avx512_fixed_size<8>>;
+
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_from(
+      mask_type const& mask, simd_type& value, std::int64_t const* mem) {
+    value = simd_type(_mm512_mask_loadu_epi64(
+        static_cast<__m512i>(value), static_cast<__mmask8>(mask), mem));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void copy_to(
+      mask_type const& mask, simd_type const& value, std::int64_t* mem) {
+    _mm512_mask_storeu_epi64(mem, static_cast<__mmask8>(mask),
+                             static_cast<__m512i>(value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void gather_from(
+      mask_type const& mask, simd_type& value, std::int64_t const* mem,
+      index_type const& index) {
+    value = simd_type(_mm512_mask_i32gather_epi64(
+        static_cast<__m512i>(value), static_cast<__mmask8>(mask),
+        static_cast<__m256i>(index), mem, 8));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static void scatter_to(
+      mask_type const& mask, simd_type const& value, std::int64_t* mem,
+      index_type const& index) {
+    _mm512_mask_i32scatter_epi64(mem, static_cast<__mmask8>(mask),
+                                 static_cast<__m256i>(index),
+                                 static_cast<__m512i>(value), 8);
+  }
+};
+
+}  // namespace Impl
+
+}  // namespace Experimental
+
+// Math functions that map to AVX-512 instructions. The rounding functions use
+// vrndscale; round() is computed as trunc(x + copysign(0.5 - ulp, x)) since
+// the hardware rounding mode breaks ties to even rather than away from zero.
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx512_fixed_size<8>>
+    abs(Experimental::simd<double,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_abs_pd(static_cast<__m512d>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx512_fixed_size<8>>
+    sqrt(Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>> const&
+             a) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_sqrt_pd(static_cast<__m512d>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx512_fixed_size<8>>
+    floor(Experimental::simd<
+          double, Experimental::simd_abi::avx512_fixed_size<8>> const& a) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_roundscale_pd(static_cast<__m512d>(a),
+                           _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx512_fixed_size<8>>
+    ceil(Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>> const&
+             a) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_roundscale_pd(static_cast<__m512d>(a),
+                           _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx512_fixed_size<8>>
+    trunc(Experimental::simd<
+          double, Experimental::simd_abi::avx512_fixed_size<8>> const& a) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_roundscale_pd(static_cast<__m512d>(a),
+                           _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx512_fixed_size<8>>
+    copysign(Experimental::simd<
+                 double, Experimental::simd_abi::avx512_fixed_size<8>> const& a,
+             Experimental::simd<
+                 double, Experimental::simd_abi::avx512_fixed_size<8>> const&
+                 b) {
+  __m512d const sign_mask = _mm512_set1_pd(-0.0);
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_or_pd(_mm512_andnot_pd(sign_mask, static_cast<__m512d>(a)),
+                   _mm512_and_pd(sign_mask, static_cast<__m512d>(b))));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx512_fixed_size<8>>
+    round(Experimental::simd<
+          double, Experimental::simd_abi::avx512_fixed_size<8>> const& a) {
+  return Kokkos::trunc(
+      a + Kokkos::copysign(
+              Experimental::simd<double,
+                                 Experimental::simd_abi::avx512_fixed_size<8>>(
+                  0.49999999999999994),
+              a));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx512_fixed_size<8>>
+    min(Experimental::simd<double,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a,
+        Experimental::simd<double,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            b) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_min_pd(static_cast<__m512d>(b), static_cast<__m512d>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx512_fixed_size<8>>
+    max(Experimental::simd<double,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a,
+        Experimental::simd<double,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            b) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_max_pd(static_cast<__m512d>(b), static_cast<__m512d>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::avx512_fixed_size<8>>
+    fma(Experimental::simd<double,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a,
+        Experimental::simd<double,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            b,
+        Experimental::simd<double,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            c) {
+  return Experimental::simd<double,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_fmadd_pd(static_cast<__m512d>(a), static_cast<__m512d>(b),
+                      static_cast<__m512d>(c)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx512_fixed_size<8>>
+    abs(Experimental::simd<float,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a) {
+  return Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_andnot_ps(_mm256_set1_ps(-0.0f), static_cast<__m256>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx512_fixed_size<8>>
+    sqrt(Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>> const&
+             a) {
+  return Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_sqrt_ps(static_cast<__m256>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx512_fixed_size<8>>
+    floor(Experimental::simd<
+          float, Experimental::simd_abi::avx512_fixed_size<8>> const& a) {
+  return Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_round_ps(static_cast<__m256>(a),
+                      _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx512_fixed_size<8>>
+    ceil(Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>> const&
+             a) {
+  return Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_round_ps(static_cast<__m256>(a),
+                      _MM_FROUND_TO_POS_INF | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx512_fixed_size<8>>
+    trunc(Experimental::simd<
+          float, Experimental::simd_abi::avx512_fixed_size<8>> const& a) {
+  return Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_round_ps(static_cast<__m256>(a),
+                      _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx512_fixed_size<8>>
+    copysign(Experimental::simd<
+                 float, Experimental::simd_abi::avx512_fixed_size<8>> const& a,
+             Experimental::simd<
+                 float, Experimental::simd_abi::avx512_fixed_size<8>> const&
+                 b) {
+  __m256 const sign_mask = _mm256_set1_ps(-0.0f);
+  return Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_or_ps(_mm256_andnot_ps(sign_mask, static_cast<__m256>(a)),
+                   _mm256_and_ps(sign_mask, static_cast<__m256>(b))));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx512_fixed_size<8>>
+    round(Experimental::simd<
+          float, Experimental::simd_abi::avx512_fixed_size<8>> const& a) {
+  return Kokkos::trunc(
+      a + Kokkos::copysign(
+              Experimental::simd<float,
+                                 Experimental::simd_abi::avx512_fixed_size<8>>(
+                  0.49999997f),
+              a));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx512_fixed_size<8>>
+    min(Experimental::simd<float,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a,
+        Experimental::simd<float,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            b) {
+  return Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_min_ps(static_cast<__m256>(b), static_cast<__m256>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx512_fixed_size<8>>
+    max(Experimental::simd<float,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a,
+        Experimental::simd<float,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            b) {
+  return Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_max_ps(static_cast<__m256>(b), static_cast<__m256>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::avx512_fixed_size<8>>
+    fma(Experimental::simd<float,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a,
+        Experimental::simd<float,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            b,
+        Experimental::simd<float,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            c) {
+  return Experimental::simd<float,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_fmadd_ps(static_cast<__m256>(a), static_cast<__m256>(b),
+                      static_cast<__m256>(c)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int32_t,
+                       Experimental::simd_abi::avx512_fixed_size<8>>
+    abs(Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a) {
+  return Experimental::simd<std::int32_t,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_abs_epi32(static_cast<__m256i>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int32_t,
+                       Experimental::simd_abi::avx512_fixed_size<8>>
+    min(Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a,
+        Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            b) {
+  return Experimental::simd<std::int32_t,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_min_epi32(static_cast<__m256i>(a), static_cast<__m256i>(b)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int32_t,
+                       Experimental::simd_abi::avx512_fixed_size<8>>
+    max(Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a,
+        Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            b) {
+  return Experimental::simd<std::int32_t,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm256_max_epi32(static_cast<__m256i>(a), static_cast<__m256i>(b)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int64_t,
+                       Experimental::simd_abi::avx512_fixed_size<8>>
+    abs(Experimental::simd<std::int64_t,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a) {
+  return Experimental::simd<std::int64_t,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_abs_epi64(static_cast<__m512i>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int64_t,
+                       Experimental::simd_abi::avx512_fixed_size<8>>
+    min(Experimental::simd<std::int64_t,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a,
+        Experimental::simd<std::int64_t,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            b) {
+  return Experimental::simd<std::int64_t,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_min_epi64(static_cast<__m512i>(a), static_cast<__m512i>(b)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int64_t,
+                       Experimental::simd_abi::avx512_fixed_size<8>>
+    max(Experimental::simd<std::int64_t,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            a,
+        Experimental::simd<std::int64_t,
+                           Experimental::simd_abi::avx512_fixed_size<8>> const&
+            b) {
+  return Experimental::simd<std::int64_t,
+                            Experimental::simd_abi::avx512_fixed_size<8>>(
+      _mm512_max_epi64(static_cast<__m512i>(a), static_cast<__m512i>(b)));
+}
+
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,398 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_COMMON_HPP
+#define KOKKOS_SIMD_COMMON_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#include <Kokkos_Core.hpp>
+
+namespace Kokkos {
+
+namespace Experimental {
+
+template <class T, class Abi>
+class simd;
+
+template <class T, class Abi>
+class simd_mask;
+
+struct element_aligned_tag {};
+
+// Loads and stores tagged with vector_aligned_tag require the address to be
+// aligned to sizeof(simd<T, Abi>). The data of a View in HostSpace is aligned
+// to Kokkos::Impl::MEMORY_ALIGNMENT, so &v(i) qualifies whenever i is a
+// multiple of the simd width.
+struct vector_aligned_tag {};
+
+template <class T>
+struct is_simd : std::false_type {};
+
+template <class T, class Abi>
+struct is_simd<simd<T, Abi>> : std::true_type {};
+
+template <class T>
+inline constexpr bool is_simd_v = is_simd<T>::value;
+
+template <class T>
+struct is_simd_mask : std::false_type {};
+
+template <class T, class Abi>
+struct is_simd_mask<simd_mask<T, Abi>> : std::true_type {};
+
+template <class T>
+inline constexpr bool is_simd_mask_v = is_simd_mask<T>::value;
+
+namespace Impl {
+
+// Proxy returned by the non-const operator[] of register-backed simd types.
+// The lane is read and written through a stack copy of the register so that
+// no type punning of the intrinsic type is required.
+template <class Simd>
+class simd_lane_reference {
+  Simd& m_value;
+  std::size_t m_lane;
+
+ public:
+  using value_type = typename Simd::value_type;
+
+  KOKKOS_FORCEINLINE_FUNCTION simd_lane_reference(Simd& value,
+                                                  std::size_t lane)
+      : m_value(value), m_lane(lane) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION simd_lane_reference const& operator=(
+      value_type value) const {
+    value_type lanes[Simd::size()];
+    m_value.copy_to(lanes, element_aligned_tag());
+    lanes[m_lane] = value;
+    m_value.copy_from(lanes, element_aligned_tag());
+    return *this;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION operator value_type() const {
+    value_type lanes[Simd::size()];
+    m_value.copy_to(lanes, element_aligned_tag());
+    return lanes[m_lane];
+  }
+};
+
+// Lane-by-lane implementation of the masked memory operations behind
+// where_expression. ABIs with native masked loads, gathers or scatters
+// specialize simd_masked_memory and inherit the rest from here.
+template <class Simd>
+struct simd_masked_memory_by_lane {
+  using value_type = typename Simd::value_type;
+  using mask_type  = typename Simd::mask_type;
+  using index_type = simd<std::int32_t, typename Simd::abi_type>;
+
+  KOKKOS_FORCEINLINE_FUNCTION static void copy_from(mask_type const& mask,
+                                                    Simd& value,
+                                                    value_type const* mem) {
+    value_type lanes[Simd::size()];
+    value.copy_to(lanes, element_aligned_tag());
+    for (std::size_t i = 0; i < Simd::size(); ++i) {
+      if (mask[i]) lanes[i] = mem[i];
+    }
+    value.copy_from(lanes, element_aligned_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION static void copy_to(mask_type const& mask,
+                                                  Simd const& value,
+                                                  value_type* mem) {
+    value_type lanes[Simd::size()];
+    value.copy_to(lanes, element_aligned_tag());
+    for (std::size_t i = 0; i < Simd::size(); ++i) {
+      if (mask[i]) mem[i] = lanes[i];
+    }
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION static void gather_from(
+      mask_type const& mask, Simd& value, value_type const* mem,
+      index_type const& index) {
+    value_type lanes[Simd::size()];
+    std::int32_t offsets[Simd::size()];
+    value.copy_to(lanes, element_aligned_tag());
+    index.copy_to(offsets, element_aligned_tag());
+    for (std::size_t i = 0; i < Simd::size(); ++i) {
+      if (mask[i]) lanes[i] = mem[offsets[i]];
+    }
+    value.copy_from(lanes, element_aligned_tag());
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION static void scatter_to(mask_type const& mask,
+                                                     Simd const& value,
+                                                     value_type* mem,
+                                                     index_type const& index) {
+    value_type lanes[Simd::size()];
+    std::int32_t offsets[Simd::size()];
+    value.copy_to(lanes, element_aligned_tag());
+    index.copy_to(offsets, element_aligned_tag());
+    for (std::size_t i = 0; i < Simd::size(); ++i) {
+      if (mask[i]) mem[offsets[i]] = lanes[i];
+    }
+  }
+};
+
+template <class Simd>
+struct simd_masked_memory : simd_masked_memory_by_lane<Simd> {};
+
+}  // namespace Impl
+
+template <class M, class T>
+class const_where_expression {
+ protected:
+  T& m_value;
+  M const& m_mask;
+
+ public:
+  using abi_type   = typename T::abi_type;
+  using value_type = T;
+  using mask_type  = M;
+
+  KOKKOS_FORCEINLINE_FUNCTION const_where_expression(M const& mask,
+                                                     T const& value)
+      : m_value(const_cast<T&>(value)), m_mask(mask) {}
+
+  KOKKOS_FORCEINLINE_FUNCTION constexpr M const& impl_get_mask() const {
+    return m_mask;
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION constexpr T const& impl_get_value() const {
+    return m_value;
+  }
+
+  template <class Flags>
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(typename T::value_type* mem,
+                                           Flags) const {
+    Impl::simd_masked_memory<T>::copy_to(m_mask, m_value, mem);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void scatter_to(
+      typename T::value_type* mem,
+      simd<std::int32_t, abi_type> const& index) const {
+    Impl::simd_masked_memory<T>::scatter_to(m_mask, m_value, mem, index);
+  }
+};
+
+template <class M, class T>
+class where_expression : public const_where_expression<M, T> {
+  using base_type = const_where_expression<M, T>;
+
+ public:
+  using typename base_type::abi_type;
+  using typename base_type::value_type;
+
+  KOKKOS_FORCEINLINE_FUNCTION where_expression(M const& mask, T& value)
+      : base_type(mask, value) {}
+
+  template <class Flags>
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(
+      typename T::value_type const* mem, Flags) {
+    Impl::simd_masked_memory<T>::copy_from(this->m_mask, this->m_value, mem);
+  }
+
+  KOKKOS_FORCEINLINE_FUNCTION void gather_from(
+      typename T::value_type const* mem,
+      simd<std::int32_t, abi_type> const& index) {
+    Impl::simd_masked_memory<T>::gather_from(this->m_mask, this->m_value, mem,
+                                             index);
+  }
+
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, T>, bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION void operator=(U&& x) {
+    this->m_value =
+        condition(this->m_mask, static_cast<T>(std::forward<U>(x)),
+                  static_cast<T const&>(this->m_value));
+  }
+
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, T>, bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION void operator+=(U&& x) {
+    *this = this->m_value + static_cast<T>(std::forward<U>(x));
+  }
+
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, T>, bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION void operator-=(U&& x) {
+    *this = this->m_value - static_cast<T>(std::forward<U>(x));
+  }
+
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, T>, bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION void operator*=(U&& x) {
+    *this = this->m_value * static_cast<T>(std::forward<U>(x));
+  }
+
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, T>, bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION void operator/=(U&& x) {
+    *this = this->m_value / static_cast<T>(std::forward<U>(x));
+  }
+};
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION
+    where_expression<simd_mask<T, Abi>, simd<T, Abi>>
+    where(typename simd<T, Abi>::mask_type const& mask, simd<T, Abi>& value) {
+  return where_expression<simd_mask<T, Abi>, simd<T, Abi>>(mask, value);
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION
+    const_where_expression<simd_mask<T, Abi>, simd<T, Abi>>
+    where(typename simd<T, Abi>::mask_type const& mask,
+          simd<T, Abi> const& value) {
+  return const_where_expression<simd_mask<T, Abi>, simd<T, Abi>>(mask, value);
+}
+
+// Compound assignment is written in terms of the binary operators every ABI
+// provides; the right-hand side is not deduced so that scalars broadcast.
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi>& operator+=(
+    simd<T, Abi>& lhs, std::common_type_t<simd<T, Abi>> const& rhs) {
+  lhs = lhs + rhs;
+  return lhs;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi>& operator-=(
+    simd<T, Abi>& lhs, std::common_type_t<simd<T, Abi>> const& rhs) {
+  lhs = lhs - rhs;
+  return lhs;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi>& operator*=(
+    simd<T, Abi>& lhs, std::common_type_t<simd<T, Abi>> const& rhs) {
+  lhs = lhs * rhs;
+  return lhs;
+}
+
+template <class T, class Abi>
+KOKKOS_FORCEINLINE_FUNCTION simd<T, Abi>& operator/=(
+    simd<T, Abi>& lhs, std::common_type_t<simd<T, Abi>> const& rhs) {
+  lhs = lhs / rhs;
+  return lhs;
+}
+
+// Mask reductions. The ABI headers overload these where the ISA can test all
+// lanes at once.
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<T, Abi> const& mask) {
+  for (std::size_t i = 0; i < simd_mask<T, Abi>::size(); ++i) {
+    if (!mask[i]) return false;
+  }
+  return true;
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<T, Abi> const& mask) {
+  for (std::size_t i = 0; i < simd_mask<T, Abi>::size(); ++i) {
+    if (mask[i]) return true;
+  }
+  return false;
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<T, Abi> const& mask) {
+  return !any_of(mask);
+}
+
+// Horizontal reductions
+
+template <class T, class Abi, class BinaryOperation = std::plus<>>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T
+reduce(simd<T, Abi> const& x, BinaryOperation op = BinaryOperation()) {
+  T lanes[simd<T, Abi>::size()];
+  x.copy_to(lanes, element_aligned_tag());
+  T result = lanes[0];
+  for (std::size_t i = 1; i < simd<T, Abi>::size(); ++i) {
+    result = op(result, lanes[i]);
+  }
+  return result;
+}
+
+template <class T, class Abi, class BinaryOperation = std::plus<>>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T
+reduce(const_where_expression<simd_mask<T, Abi>, simd<T, Abi>> const& x,
+       T identity_element, BinaryOperation op = BinaryOperation()) {
+  auto const& mask = x.impl_get_mask();
+  T lanes[simd<T, Abi>::size()];
+  x.impl_get_value().copy_to(lanes, element_aligned_tag());
+  T result = identity_element;
+  for (std::size_t i = 0; i < simd<T, Abi>::size(); ++i) {
+    if (mask[i]) result = op(result, lanes[i]);
+  }
+  return result;
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T hmin(simd<T, Abi> const& x) {
+  return reduce(x, [](T a, T b) { return Kokkos::min(a, b); });
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T hmax(simd<T, Abi> const& x) {
+  return reduce(x, [](T a, T b) { return Kokkos::max(a, b); });
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T
+hmin(const_where_expression<simd_mask<T, Abi>, simd<T, Abi>> const& x) {
+  return reduce(x, Kokkos::reduction_identity<T>::min(),
+                [](T a, T b) { return Kokkos::min(a, b); });
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION T
+hmax(const_where_expression<simd_mask<T, Abi>, simd<T, Abi>> const& x) {
+  return reduce(x, Kokkos::reduction_identity<T>::max(),
+                [](T a, T b) { return Kokkos::max(a, b); });
+}
+
+}  // namespace Experimental
+
+// Allows simd values to be accumulated with Kokkos::Sum, Kokkos::Prod, ... in
+// parallel_reduce, including over ThreadVectorRange and TeamThreadRange.
+template <class T, class Abi>
+struct reduction_identity<Experimental::simd<T, Abi>> {
+  KOKKOS_FORCEINLINE_FUNCTION static Experimental::simd<T, Abi> sum() {
+    return Experimental::simd<T, Abi>(reduction_identity<T>::sum());
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Experimental::simd<T, Abi> prod() {
+    return Experimental::simd<T, Abi>(reduction_identity<T>::prod());
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Experimental::simd<T, Abi> max() {
+    return Experimental::simd<T, Abi>(reduction_identity<T>::max());
+  }
+  KOKKOS_FORCEINLINE_FUNCTION static Experimental::simd<T, Abi> min() {
+    return Experimental::simd<T, Abi>(reduction_identity<T>::min());
+  }
+};
+
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,143 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_COMMON_MATH_HPP
+#define KOKKOS_SIMD_COMMON_MATH_HPP
+
+#include <Kokkos_SIMD_Common.hpp>
+
+// Overloads of the Kokkos mathematical functions for simd arguments. These
+// apply the scalar function lane by lane; the ABI headers provide more
+// specialized overloads for the functions that map to a single instruction
+// (abs, sqrt, fma, min, max, copysign and the rounding functions),
+// Kokkos_SIMD_Math.hpp vectorizes exp, expm1, log, pow, sin, cos, tanh and erf
+// for floating-point types, and the scalar ABI provides device-callable ones.
+
+namespace Kokkos {
+
+#define KOKKOS_IMPL_SIMD_UNARY_FUNCTION(FUNC)                              \
+  template <class T, class Abi>                                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                      \
+      Experimental::simd<T, Abi>                                           \
+      FUNC(Experimental::simd<T, Abi> const& a) {                          \
+    T lanes[Experimental::simd<T, Abi>::size()];                           \
+    a.copy_to(lanes, Experimental::element_aligned_tag());                 \
+    for (std::size_t i = 0; i < Experimental::simd<T, Abi>::size(); ++i) { \
+      lanes[i] = Kokkos::FUNC(lanes[i]);                                   \
+    }                                                                      \
+    Experimental::simd<T, Abi> result;                                     \
+    result.copy_from(lanes, Experimental::element_aligned_tag());          \
+    return result;                                                         \
+  }
+
+#define KOKKOS_IMPL_SIMD_BINARY_FUNCTION(FUNC)                             \
+  template <class T, class Abi>                                            \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                      \
+      Experimental::simd<T, Abi>                                           \
+      FUNC(Experimental::simd<T, Abi> const& a,                            \
+           std::common_type_t<Experimental::simd<T, Abi>> const& b) {      \
+    T lhs[Experimental::simd<T, Abi>::size()];                             \
+    T rhs[Experimental::simd<T, Abi>::size()];                             \
+    a.copy_to(lhs, Experimental::element_aligned_tag());                   \
+    b.copy_to(rhs, Experimental::element_aligned_tag());                   \
+    for (std::size_t i = 0; i < Experimental::simd<T, Abi>::size(); ++i) { \
+      lhs[i] = Kokkos::FUNC(lhs[i], rhs[i]);                               \
+    }                                                                      \
+    Experimental::simd<T, Abi> result;                                     \
+    result.copy_from(lhs, Experimental::element_aligned_tag());            \
+    return result;                                                         \
+  }
+
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(abs)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(exp)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(exp2)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(expm1)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(log)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(log10)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(log2)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(log1p)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(sqrt)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(cbrt)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(sin)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(cos)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(tan)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(asin)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(acos)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(atan)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(sinh)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(cosh)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(tanh)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(asinh)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(acosh)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(atanh)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(erf)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(erfc)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(tgamma)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(lgamma)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(ceil)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(floor)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(trunc)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(round)
+KOKKOS_IMPL_SIMD_UNARY_FUNCTION(nearbyint)
+
+KOKKOS_IMPL_SIMD_BINARY_FUNCTION(pow)
+KOKKOS_IMPL_SIMD_BINARY_FUNCTION(hypot)
+KOKKOS_IMPL_SIMD_BINARY_FUNCTION(atan2)
+KOKKOS_IMPL_SIMD_BINARY_FUNCTION(copysign)
+KOKKOS_IMPL_SIMD_BINARY_FUNCTION(fmod)
+KOKKOS_IMPL_SIMD_BINARY_FUNCTION(fmin)
+KOKKOS_IMPL_SIMD_BINARY_FUNCTION(fmax)
+
+#undef KOKKOS_IMPL_SIMD_UNARY_FUNCTION
+#undef KOKKOS_IMPL_SIMD_BINARY_FUNCTION
+
+// min and max take both arguments by the same deduced type so that they are
+// more specialized than the generic Kokkos::min(T const&, T const&).
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION Experimental::simd<T, Abi>
+min(Experimental::simd<T, Abi> const& a, Experimental::simd<T, Abi> const& b) {
+  return condition(b < a, b, a);
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION Experimental::simd<T, Abi>
+max(Experimental::simd<T, Abi> const& a, Experimental::simd<T, Abi> const& b) {
+  return condition(a < b, b, a);
+}
+
+template <class T, class Abi>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION Experimental::simd<T, Abi>
+fma(Experimental::simd<T, Abi> const& a,
+    std::common_type_t<Experimental::simd<T, Abi>> const& b,
+    std::common_type_t<Experimental::simd<T, Abi>> const& c) {
+  T x[Experimental::simd<T, Abi>::size()];
+  T y[Experimental::simd<T, Abi>::size()];
+  T z[Experimental::simd<T, Abi>::size()];
+  a.copy_to(x, Experimental::element_aligned_tag());
+  b.copy_to(y, Experimental::element_aligned_tag());
+  c.copy_to(z, Experimental::element_aligned_tag());
+  for (std::size_t i = 0; i < Experimental::simd<T, Abi>::size(); ++i) {
+    x[i] = Kokkos::fma(x[i], y[i], z[i]);
+  }
+  Experimental::simd<T, Abi> result;
+  result.copy_from(x, Experimental::element_aligned_tag());
+  return result;
+}
+
+}  // namespace Kokkos
+
+#endif
@@ -0,0 +1,589 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_MATH_HPP
+#define KOKKOS_SIMD_MATH_HPP
+
+#include <limits>
+
+#include <Kokkos_SIMD_Common.hpp>
+
+// Vectorized exp, expm1, log, pow, sin, cos, tanh and erf for the host ABIs.
+// These replace the lane-by-lane overloads of Kokkos_SIMD_Common_Math.hpp with
+// branch-free polynomial evaluations on whole vectors; the scalar ABI keeps
+// calling the backend's math library.
+//
+// The double versions follow the classic fdlibm reductions, carrying the
+// reduced argument in extended precision where it matters, and are accurate
+// to within 1 ulp over the whole argument range. Special values (signed
+// zeros, infinities and NaNs) are handled as in C99 Annex F.
+//
+// exp and pow results in the subnormal range may lose one more ulp to double
+// rounding. sin and cos reduce their argument with a 151-bit approximation of
+// pi/2 for |x| <= 2^19 pi/2 and fall back to the lane-by-lane functions for
+// vectors with larger arguments. The float versions evaluate the double
+// kernels on converted arguments and round once, so they are correctly
+// rounded in all but rare cases.
+
+namespace Kokkos {
+namespace Experimental {
+namespace Impl {
+
+template <class Abi>
+using simd_enable_if_vectorized_math_t =
+    std::enable_if_t<!std::is_same_v<Abi, simd_abi::scalar>, bool>;
+
+template <class Abi, class F>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_math_by_lane(
+    simd<double, Abi> const& x, F const& f) {
+  double lanes[simd<double, Abi>::size()];
+  x.copy_to(lanes, element_aligned_tag());
+  for (std::size_t i = 0; i < simd<double, Abi>::size(); ++i) {
+    lanes[i] = f(lanes[i]);
+  }
+  simd<double, Abi> result;
+  result.copy_from(lanes, element_aligned_tag());
+  return result;
+}
+
+// c0 + x (c1 + x (c2 + ...)) by Horner's rule.
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_polynomial(
+    simd<double, Abi> const&, double c0) {
+  return simd<double, Abi>(c0);
+}
+
+template <class Abi, class... Coefficients>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_polynomial(
+    simd<double, Abi> const& x, double c0, double c1, Coefficients... c) {
+  return simd<double, Abi>(c0) + x * simd_polynomial(x, c1, c...);
+}
+
+// 2^n for the integral n stored in the low mantissa bits of n + 0x1.8p52.
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_exp2_shifted(
+    simd<double, Abi> const& shifted) {
+  using int_type = simd<std::int64_t, Abi>;
+  return Kokkos::bit_cast<simd<double, Abi>>(
+      (Kokkos::bit_cast<int_type>(shifted) << 52) +
+      int_type(std::int64_t(1023) << 52));
+}
+
+constexpr double simd_exp_shift     = 0x1.8p52;
+constexpr double simd_exp_inv_ln2   = 1.44269504088896338700e+00;
+constexpr double simd_exp_ln2_hi    = 6.93147180369123816490e-01;
+constexpr double simd_exp_ln2_lo    = 1.90821492927058770002e-10;
+constexpr double simd_exp_overflow  = 7.09782712893383973096e+02;
+constexpr double simd_exp_underflow = -7.45133219101941108420e+02;
+
+// exp(x + xlo) where xlo is a correction much smaller than ulp(x).
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_exp_kernel(
+    simd<double, Abi> const& x, simd<double, Abi> const& xlo) {
+  using simd_type = simd<double, Abi>;
+  // x = n ln2 + r with |r| <= ln2/2; n ln2_hi is exact.
+  simd_type const kd =
+      x * simd_type(simd_exp_inv_ln2) + simd_type(simd_exp_shift);
+  simd_type const n = kd - simd_type(simd_exp_shift);
+  simd_type const rh = x - n * simd_type(simd_exp_ln2_hi);
+  simd_type const rl = xlo - n * simd_type(simd_exp_ln2_lo);
+  // r + c = rh + rl, where c carries the rounding error of r into the result
+  // as exp(r + c) ~ exp(r) + c (1 + r).
+  simd_type const r = rh + rl;
+  simd_type const c = (rh - r) + rl;
+  // exp(r) by its Taylor series to degree 13, whose truncation error is below
+  // 2^-60 for |r| <= ln2/2.
+  simd_type const p =
+      simd_type(1.0) +
+      (r + ((r * r) * simd_polynomial(
+                          r, 0.5, 1.6666666666666666e-01,
+                          4.1666666666666664e-02, 8.333333333333333e-03,
+                          1.388888888888889e-03, 1.984126984126984e-04,
+                          2.48015873015873e-05, 2.7557319223985893e-06,
+                          2.755731922398589e-07, 2.505210838544172e-08,
+                          2.08767569878681e-09, 1.6059043836821613e-10) +
+            (c + c * r)));
+  // 2^n is a normal number only for -1022 <= n <= 1023: near the ends of the
+  // range scale by 2^(n +- 1000) and multiply the bias back out afterwards.
+  auto const big      = Kokkos::abs(x) > simd_type(708.0);
+  auto const negative = x < simd_type(0.0);
+  simd_type const bias =
+      condition(big, condition(negative, simd_type(1000.0), simd_type(-1000.0)),
+                simd_type(0.0));
+  simd_type const unbias = condition(
+      big, condition(negative, simd_type(0x1p-1000), simd_type(0x1p1000)),
+      simd_type(1.0));
+  simd_type const result = (p * simd_exp2_shifted(kd + bias)) * unbias;
+  return condition(
+      x < simd_type(simd_exp_underflow), simd_type(0.0),
+      condition(x > simd_type(simd_exp_overflow),
+                simd_type(std::numeric_limits<double>::infinity()), result));
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_exp(
+    simd<double, Abi> const& x) {
+  return simd_exp_kernel(x, simd<double, Abi>(0.0));
+}
+
+// expm1(x) = hi + lo with |lo| <= ulp(hi) / 2 for -40 <= x <= 710.
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void simd_expm1_extended(
+    simd<double, Abi> const& x, simd<double, Abi>& hi, simd<double, Abi>& lo) {
+  using simd_type = simd<double, Abi>;
+  // Taking n = 0 for |x| < ln2 rather than rounding avoids the cancellation
+  // in 2^n (1 + q) - 1 for n = +-1 and q of the opposite sign.
+  simd_type const kd =
+      condition(Kokkos::abs(x) < simd_type(simd_exp_ln2_hi),
+                simd_type(simd_exp_shift),
+                x * simd_type(simd_exp_inv_ln2) + simd_type(simd_exp_shift));
+  simd_type const n  = kd - simd_type(simd_exp_shift);
+  simd_type const rh = x - n * simd_type(simd_exp_ln2_hi);
+  simd_type const rl = -n * simd_type(simd_exp_ln2_lo);
+  simd_type const r  = rh + rl;
+  simd_type const cr = (rh - r) + rl;
+  // expm1(r) = r + r^2/2 + r^3 P(r) by its Taylor series to degree 17, whose
+  // truncation error is below 2^-60 for |r| <= ln2. r + r^2/2 and the
+  // reduction error are carried in double-double so that q rounds once.
+  simd_type const hr  = simd_type(0.5) * r;
+  simd_type const h   = hr * r;
+  simd_type const hl  = Kokkos::fma(hr, r, -h);
+  simd_type const rh2 = r + h;
+  simd_type const tail =
+      (r * r * r) *
+      simd_polynomial(r, 1.6666666666666666e-01, 4.1666666666666664e-02,
+                      8.333333333333333e-03, 1.388888888888889e-03,
+                      1.984126984126984e-04, 2.48015873015873e-05,
+                      2.7557319223985893e-06, 2.755731922398589e-07,
+                      2.505210838544172e-08, 2.08767569878681e-09,
+                      1.6059043836821613e-10, 1.1470745597729725e-11,
+                      7.647163731819816e-13, 4.779477332387385e-14,
+                      2.8114572543455206e-15);
+  simd_type const ql = (((r - rh2) + h) + hl) + (tail + (cr + cr * r));
+  simd_type const q  = rh2 + ql;
+  // expm1(x) = 2 t ((q + c2) + c1) with t = 2^(n-1), which stays a normal
+  // number up to the overflow threshold, and c1 + c2 = 1 - 2^-n split so that
+  // both are exact. |c1| >= |q + c2| unless c1 = 0, so the rounding error of
+  // the last sum is exact as well.
+  simd_type const t  = simd_exp2_shifted(kd - simd_type(1.0));
+  simd_type const m1 = simd_exp2_shifted(simd_type(simd_exp_shift) -
+                                         Kokkos::min(n, simd_type(53.0)));
+  simd_type const m2 = simd_exp2_shifted(simd_type(simd_exp_shift) -
+                                         Kokkos::min(n, simd_type(60.0)));
+  simd_type const c1  = simd_type(1.0) - m1;
+  simd_type const s   = q + (m1 - m2);
+  simd_type const sum = c1 + s;
+  hi = simd_type(2.0) * (t * sum);
+  lo = simd_type(2.0) * (t * (((c1 - sum) + s) + ((rh2 - q) + ql)));
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_expm1(
+    simd<double, Abi> const& x) {
+  using simd_type = simd<double, Abi>;
+  // expm1(x) rounds to -1 below -38; clamping keeps 2^n a normal number.
+  simd_type hi, lo;
+  simd_expm1_extended(Kokkos::max(x, simd_type(-40.0)), hi, lo);
+  return condition(
+      x < simd_type(-40.0), simd_type(-1.0),
+      condition(x > simd_type(simd_exp_overflow),
+                simd_type(std::numeric_limits<double>::infinity()),
+                condition(x == simd_type(0.0), x, hi)));
+}
+
+// Splits positive finite x into 2^k z with sqrt(2)/2 <= z < sqrt(2).
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void simd_log_reduce(
+    simd<double, Abi> const& x, simd<double, Abi>& k, simd<double, Abi>& z) {
+  using simd_type      = simd<double, Abi>;
+  using int_type       = simd<std::int64_t, Abi>;
+  auto const subnormal = x < simd_type(0x1p-1022);
+  int_type const bits  = Kokkos::bit_cast<int_type>(
+      condition(subnormal, x * simd_type(0x1p52), x));
+  // 0x3fe6a09e667f3bcd is the bit pattern of sqrt(2)/2.
+  int_type const ik =
+      (bits - int_type(std::int64_t(0x3fe6a09e667f3bcd))) >> 52;
+  z = Kokkos::bit_cast<simd_type>(bits - (ik << 52));
+  k = simd_type(simd<std::int32_t, Abi>(ik)) -
+      condition(subnormal, simd_type(52.0), simd_type(0.0));
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_log(
+    simd<double, Abi> const& x) {
+  using simd_type      = simd<double, Abi>;
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  simd_type k, z;
+  simd_log_reduce(x, k, z);
+  // log(1 + f) = f - f^2/2 + s (f^2/2 + R(s^2)) with s = f / (2 + f), as in
+  // fdlibm's e_log.c.
+  simd_type const f  = z - simd_type(1.0);
+  simd_type const s  = f / (simd_type(2.0) + f);
+  simd_type const s2 = s * s;
+  simd_type const s4 = s2 * s2;
+  simd_type const r =
+      s2 * simd_polynomial(s4, 6.666666666666735130e-01,
+                           2.857142874366239149e-01, 1.818357216161805012e-01,
+                           1.479819860511658591e-01) +
+      s4 * simd_polynomial(s4, 3.999999999940941908e-01,
+                           2.222219843214978396e-01, 1.531383769920937332e-01);
+  simd_type const hfsq   = simd_type(0.5) * f * f;
+  simd_type const result = k * simd_type(simd_exp_ln2_hi) -
+                           ((hfsq - (s * (hfsq + r) +
+                                     k * simd_type(simd_exp_ln2_lo))) -
+                            f);
+  return condition(
+      !(x >= simd_type(0.0)),
+      simd_type(std::numeric_limits<double>::quiet_NaN()),
+      condition(x == simd_type(0.0), simd_type(-inf),
+                condition(x == simd_type(inf), simd_type(inf), result)));
+}
+
+// log(x) as an unevaluated sum hi + lo with a relative error of about 2^-62,
+// which pow needs to stay within a few ulp for results near the overflow and
+// underflow thresholds. x must be positive and finite.
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void simd_log_extended(
+    simd<double, Abi> const& x, simd<double, Abi>& hi, simd<double, Abi>& lo) {
+  using simd_type = simd<double, Abi>;
+  simd_type k, z;
+  simd_log_reduce(x, k, z);
+  // log(z) = 2 atanh(s) = 2 s + 2/3 s^3 + s^5 P(s^2) with s = f / (2 + f),
+  // where s and the s^3 term are carried in double-double arithmetic.
+  simd_type const f   = z - simd_type(1.0);
+  simd_type const d   = simd_type(2.0) + f;
+  simd_type const dl  = f - (d - simd_type(2.0));
+  simd_type const sh  = f / d;
+  simd_type const sl  = (Kokkos::fma(-sh, d, f) - sh * dl) / d;
+  simd_type const s2h = sh * sh;
+  simd_type const s2l = Kokkos::fma(sh, sh, -s2h) + simd_type(2.0) * sh * sl;
+  simd_type const s3h = s2h * sh;
+  simd_type const s3l = Kokkos::fma(s2h, sh, -s3h) + s2h * sl + s2l * sh;
+  // 2/3 = two_thirds + 3.700743415417188e-17.
+  simd_type const two_thirds(6.666666666666666e-01);
+  simd_type const bh = two_thirds * s3h;
+  simd_type const bl = Kokkos::fma(two_thirds, s3h, -bh) + two_thirds * s3l +
+                       simd_type(3.700743415417188e-17) * s3h;
+  simd_type const c =
+      s3h * s2h *
+      simd_polynomial(s2h, 4.0e-01, 2.857142857142857e-01,
+                      2.2222222222222222e-01, 1.8181818181818182e-01,
+                      1.5384615384615385e-01, 1.3333333333333333e-01,
+                      1.1764705882352941e-01, 1.0526315789473684e-01,
+                      9.523809523809523e-02, 8.695652173913043e-02);
+  // Add the terms from the largest down, collecting the rounding errors.
+  simd_type const a  = simd_type(2.0) * sh;
+  simd_type const ab = a + bh;
+  simd_type const el = (bh - (ab - a)) + simd_type(2.0) * sl + bl + c;
+  simd_type const kh = k * simd_type(simd_exp_ln2_hi);
+  simd_type const th = kh + ab;
+  simd_type const tl =
+      (ab - (th - kh)) + el + k * simd_type(simd_exp_ln2_lo);
+  hi = th + tl;
+  lo = tl - (hi - th);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_pow(
+    simd<double, Abi> const& x, simd<double, Abi> const& y) {
+  using simd_type      = simd<double, Abi>;
+  constexpr double inf = std::numeric_limits<double>::infinity();
+  simd_type const ax   = Kokkos::abs(x);
+  auto const finite    = ax < simd_type(inf);
+  simd_type lh, ll;
+  simd_log_extended(
+      condition(finite && ax > simd_type(0.0), ax, simd_type(1.0)), lh, ll);
+  lh = condition(ax == simd_type(0.0), simd_type(-inf),
+                 condition(finite, lh, simd_type(inf)));
+  // y log|x| = th + tl; the product's rounding error is recovered with fma.
+  simd_type const th = y * lh;
+  simd_type const tl =
+      condition(Kokkos::abs(th) < simd_type(inf),
+                Kokkos::fma(y, lh, -th) + y * ll, simd_type(0.0));
+  simd_type result = simd_exp_kernel(th, tl);
+  // The sign of the result and the special cases of C99 Annex F.
+  auto const integral = Kokkos::trunc(y) == y;
+  auto const odd =
+      integral && Kokkos::trunc(simd_type(0.5) * y) != simd_type(0.5) * y;
+  auto const negative = Kokkos::copysign(simd_type(1.0), x) < simd_type(0.0);
+  result              = condition(negative && odd, -result, result);
+  result              = condition(
+      x < simd_type(0.0) && finite && !integral &&
+          Kokkos::abs(y) < simd_type(inf),
+      simd_type(std::numeric_limits<double>::quiet_NaN()), result);
+  result = condition(x != x || y != y, x + y, result);
+  result = condition(ax == simd_type(1.0) && Kokkos::abs(y) == simd_type(inf),
+                     simd_type(1.0), result);
+  return condition(x == simd_type(1.0) || y == simd_type(0.0), simd_type(1.0),
+                   result);
+}
+
+// sin(x + y) and cos(x + y) for |x + y| <= pi/4, where y is a correction to x,
+// with the polynomials of fdlibm's k_sin.c and k_cos.c.
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_sin_kernel(
+    simd<double, Abi> const& x, simd<double, Abi> const& y) {
+  using simd_type = simd<double, Abi>;
+  simd_type const z = x * x;
+  simd_type const v = z * x;
+  simd_type const r = simd_polynomial(
+      z, 8.33333333332248946124e-03, -1.98412698298579493134e-04,
+      2.75573137070700676789e-06, -2.50507602534068634195e-08,
+      1.58969099521155010221e-10);
+  return x - ((z * (simd_type(0.5) * y - v * r) - y) -
+              v * simd_type(-1.66666666666666324348e-01));
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_cos_kernel(
+    simd<double, Abi> const& x, simd<double, Abi> const& y) {
+  using simd_type = simd<double, Abi>;
+  simd_type const z = x * x;
+  simd_type const w = z * z;
+  simd_type const r =
+      z * simd_polynomial(z, 4.16666666666666019037e-02,
+                          -1.38888888888741095749e-03,
+                          2.48015872894767294178e-05) +
+      w * w *
+          simd_polynomial(z, -2.75573143513906633035e-07,
+                          2.08757232129817482790e-09,
+                          -1.13596475577881948265e-11);
+  simd_type const hz = simd_type(0.5) * z;
+  simd_type const c  = simd_type(1.0) - hz;
+  return c + (((simd_type(1.0) - c) - hz) + (z * r - x * y));
+}
+
+constexpr double simd_rem_pio2_limit = 0x1p19 * 1.57079632679489661923;
+
+// x = n pi/2 + y0 + y1 with |y0 + y1| <= pi/4 and q = n mod 4. pi/2 is split
+// into 33-bit pieces as in fdlibm's e_rem_pio2.c so that n times each piece
+// is exact, and the differences are accumulated with error-free sums; this is
+// accurate for every |x| <= simd_rem_pio2_limit.
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void simd_rem_pio2(
+    simd<double, Abi> const& x, simd<double, Abi>& y0, simd<double, Abi>& y1,
+    simd<double, Abi>& q) {
+  using simd_type = simd<double, Abi>;
+  simd_type const n = (x * simd_type(6.36619772367581382433e-01) +
+                       simd_type(simd_exp_shift)) -
+                      simd_type(simd_exp_shift);
+  simd_type const t  = x - n * simd_type(1.57079632673412561417e+00);
+  simd_type const w2 = -n * simd_type(6.07710050630396597660e-11);
+  simd_type const w3 = -n * simd_type(2.02226624871116645580e-21);
+  // (r2, e2) = t + w2 and (r3, e3) = r2 + w3 exactly.
+  simd_type const r2 = t + w2;
+  simd_type const b2 = r2 - t;
+  simd_type const e2 = (t - (r2 - b2)) + (w2 - b2);
+  simd_type const r3 = r2 + w3;
+  simd_type const b3 = r3 - r2;
+  simd_type const e3 = (r2 - (r3 - b3)) + (w3 - b3);
+  simd_type const lo = (e2 + e3) - n * simd_type(8.47842766036889956997e-32);
+  y0 = r3 + lo;
+  y1 = (r3 - y0) + lo;
+  q  = n - simd_type(4.0) * Kokkos::floor(simd_type(0.25) * n);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_sin(
+    simd<double, Abi> const& x) {
+  using simd_type = simd<double, Abi>;
+  if (any_of(Kokkos::abs(x) > simd_type(simd_rem_pio2_limit))) {
+    return simd_math_by_lane(x, [](double v) { return Kokkos::sin(v); });
+  }
+  simd_type y0, y1, q;
+  simd_rem_pio2(x, y0, y1, q);
+  simd_type const result =
+      condition(q == simd_type(1.0) || q == simd_type(3.0),
+                simd_cos_kernel(y0, y1), simd_sin_kernel(y0, y1));
+  // The reduction loses the sign of -0.
+  return condition(x == simd_type(0.0), x,
+                   condition(q >= simd_type(2.0), -result, result));
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_cos(
+    simd<double, Abi> const& x) {
+  using simd_type = simd<double, Abi>;
+  if (any_of(Kokkos::abs(x) > simd_type(simd_rem_pio2_limit))) {
+    return simd_math_by_lane(x, [](double v) { return Kokkos::cos(v); });
+  }
+  simd_type y0, y1, q;
+  simd_rem_pio2(x, y0, y1, q);
+  simd_type const result =
+      condition(q == simd_type(1.0) || q == simd_type(3.0),
+                simd_sin_kernel(y0, y1), simd_cos_kernel(y0, y1));
+  return condition(q == simd_type(1.0) || q == simd_type(2.0), -result,
+                   result);
+}
+
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_tanh(
+    simd<double, Abi> const& x) {
+  using simd_type = simd<double, Abi>;
+  // tanh(a) = t / (t + 2) with t = expm1(2a) = th + tl, which keeps the
+  // relative error of t for small a and rounds to 1 from a = 22 on.
+  simd_type th, tl;
+  simd_expm1_extended(
+      simd_type(2.0) * Kokkos::min(Kokkos::abs(x), simd_type(22.0)), th, tl);
+  // t + 2 = d + e + tl exactly; the residual of the quotient q is computed
+  // with an fma so that only the final correction rounds.
+  simd_type const d      = th + simd_type(2.0);
+  simd_type const dt     = d - th;
+  simd_type const e      = (th - (d - dt)) + (simd_type(2.0) - dt);
+  simd_type const q      = th / d;
+  simd_type const res    = Kokkos::fma(-q, d, th) + (tl - q * (e + tl));
+  simd_type const result = q + res / d;
+  return Kokkos::copysign(result, x);
+}
+
+// erf with the rational approximations of fdlibm's s_erf.c on [0, 0.84375),
+// [0.84375, 1.25), [1.25, 1/0.35) and [1/0.35, 6); erf rounds to 1 above 6.
+// Only the intervals that hold a lane of x are evaluated.
+template <class Abi>
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd<double, Abi> simd_erf(
+    simd<double, Abi> const& x) {
+  using simd_type      = simd<double, Abi>;
+  using int_type       = simd<std::int64_t, Abi>;
+  simd_type const a    = Kokkos::abs(x);
+  auto const in_small  = a < simd_type(0.84375);
+  auto const in_middle = !in_small && a < simd_type(1.25);
+  auto const in_tail   = !in_small && !in_middle && a < simd_type(6.0);
+  simd_type result(1.0);
+  if (any_of(in_small)) {
+    simd_type const z = a * a;
+    simd_type const p = simd_polynomial(
+        z, 1.28379167095512558561e-01, -3.25042107247001499370e-01,
+        -2.84817495755985104766e-02, -5.77027029648944159157e-03,
+        -2.37630166566501626084e-05);
+    simd_type const q = simd_polynomial(
+        z, 1.0, 3.97917223959155352819e-01, 6.50222499887672944485e-02,
+        5.08130628187576562776e-03, 1.32494738004321644526e-04,
+        -3.96022827877536812320e-06);
+    result = condition(in_small, a + a * (p / q), result);
+  }
+  if (any_of(in_middle)) {
+    simd_type const s = a - simd_type(1.0);
+    simd_type const p = simd_polynomial(
+        s, -2.36211856075265944077e-03, 4.14856118683748331666e-01,
+        -3.72207876035701323847e-01, 3.18346619901161753674e-01,
+        -1.10894694282396677476e-01, 3.54783043256182359371e-02,
+        -2.16637559486879084300e-03);
+    simd_type const q = simd_polynomial(
+        s, 1.0, 1.06420880400844228286e-01, 5.40397917702171048937e-01,
+        7.18286544141962662868e-02, 1.26171219808761642112e-01,
+        1.36370839120290507362e-02, 1.19844998467991074170e-02);
+    result = condition(in_middle, simd_type(8.45062911510467529297e-01) + p / q,
+                       result);
+  }
+  if (any_of(in_tail)) {
+    simd_type const s = simd_type(1.0) / (a * a);
+    auto const near   = a < simd_type(1.0 / 0.35);
+    simd_type p(0.0);
+    simd_type q(1.0);
+    if (any_of(in_tail && near)) {
+      p = simd_polynomial(
+          s, -9.86494403484714822705e-03, -6.93858572707181764372e-01,
+          -1.05586262253232909814e+01, -6.23753324503260060396e+01,
+          -1.62396669462573470355e+02, -1.84605092906711035994e+02,
+          -8.12874355063065934246e+01, -9.81432934416914548592e+00);
+      q = simd_polynomial(
+          s, 1.0, 1.96512716674392571292e+01, 1.37657754143519042600e+02,
+          4.34565877475229228821e+02, 6.45387271733267880336e+02,
+          4.29008140027567833386e+02, 1.08635005541779435134e+02,
+          6.57024977031928170135e+00, -6.04244152148580987438e-02);
+    }
+    if (any_of(in_tail && !near)) {
+      p = condition(
+          near, p,
+          simd_polynomial(
+              s, -9.86494292470009928597e-03, -7.99283237680523006574e-01,
+              -1.77579549177547519889e+01, -1.60636384855821916062e+02,
+              -6.37566443368389627722e+02, -1.02509513161107724954e+03,
+              -4.83519191608651397019e+02));
+      q = condition(
+          near, q,
+          simd_polynomial(
+              s, 1.0, 3.03380607434824582924e+01, 3.25792512996573918826e+02,
+              1.53672958608443695994e+03, 3.19985821950859553908e+03,
+              2.55305040643316442583e+03, 4.74528541206955367215e+02,
+              -2.24409524465858183362e+01));
+    }
+    // erfc(a) = exp(-a^2 - 0.5625 + p/q) / a, where a^2 is split around z,
+    // a with the low 32 bits cleared, so that z^2 is exact.
+    simd_type const z = Kokkos::bit_cast<simd_type>(
+        (Kokkos::bit_cast<int_type>(a) >> 32) << 32);
+    simd_type const erfc = simd_exp(-z * z - simd_type(0.5625)) *
+                           simd_exp((z - a) * (z + a) + p / q) / a;
+    result = condition(in_tail, simd_type(1.0) - erfc, result);
+  }
+  return Kokkos::copysign(condition(a == a, result, a), x);
+}
+
+}  // namespace Impl
+}  // namespace Experimental
+
+#define KOKKOS_IMPL_SIMD_VECTORIZED_UNARY_FUNCTION(FUNC)                     \
+  template <class Abi,                                                       \
+            Experimental::Impl::simd_enable_if_vectorized_math_t<Abi> =      \
+                false>                                                       \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                        \
+      Experimental::simd<double, Abi>                                        \
+      FUNC(Experimental::simd<double, Abi> const& a) {                       \
+    return Experimental::Impl::simd_##FUNC(a);                               \
+  }                                                                          \
+  template <class Abi,                                                       \
+            Experimental::Impl::simd_enable_if_vectorized_math_t<Abi> =      \
+                false>                                                       \
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION                        \
+      Experimental::simd<float, Abi>                                         \
+      FUNC(Experimental::simd<float, Abi> const& a) {                        \
+    return Experimental::simd<float, Abi>(                                   \
+        Experimental::Impl::simd_##FUNC(Experimental::simd<double, Abi>(a))); \
+  }
+
+KOKKOS_IMPL_SIMD_VECTORIZED_UNARY_FUNCTION(exp)
+KOKKOS_IMPL_SIMD_VECTORIZED_UNARY_FUNCTION(expm1)
+KOKKOS_IMPL_SIMD_VECTORIZED_UNARY_FUNCTION(log)
+KOKKOS_IMPL_SIMD_VECTORIZED_UNARY_FUNCTION(sin)
+KOKKOS_IMPL_SIMD_VECTORIZED_UNARY_FUNCTION(cos)
+KOKKOS_IMPL_SIMD_VECTORIZED_UNARY_FUNCTION(tanh)
+KOKKOS_IMPL_SIMD_VECTORIZED_UNARY_FUNCTION(erf)
+
+#undef KOKKOS_IMPL_SIMD_VECTORIZED_UNARY_FUNCTION
+
+template <class Abi,
+          Experimental::Impl::simd_enable_if_vectorized_math_t<Abi> = false>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Abi>
+    pow(Experimental::simd<double, Abi> const& x,
+        std::common_type_t<Experimental::simd<double, Abi>> const& y) {
+  return Experimental::Impl::simd_pow(x, y);
+}
+
+template <class Abi,
+          Experimental::Impl::simd_enable_if_vectorized_math_t<Abi> = false>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Abi>
+    pow(Experimental::simd<float, Abi> const& x,
+        std::common_type_t<Experimental::simd<float, Abi>> const& y) {
+  return Experimental::simd<float, Abi>(
+      Experimental::Impl::simd_pow(Experimental::simd<double, Abi>(x),
+                                   Experimental::simd<double, Abi>(y)));
+}
+
+}  // namespace Kokkos
+
+#endif
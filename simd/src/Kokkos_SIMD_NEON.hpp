@@ -0,0 +1,845 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_NEON_HPP
+#define KOKKOS_SIMD_NEON_HPP
+
+#include <functional>
+#include <type_traits>
+
+#include <Kokkos_SIMD_Common.hpp>
+
+#include <arm_neon.h>
+
+namespace Kokkos {
+
+namespace Experimental {
+
+namespace simd_abi {
+
+template <int N>
+class neon_fixed_size {};
+
+}  // namespace simd_abi
+
+// The mask of every value type is kept as two 64-bit lanes of all ones or all
+// zeros; the 2-lane float and int32 types narrow it to 32-bit lanes when they
+// blend.
+template <class T>
+class simd_mask<T, simd_abi::neon_fixed_size<2>> {
+  uint64x2_t m_value;
+
+ public:
+  using value_type = bool;
+  using simd_type  = simd<T, simd_abi::neon_fixed_size<2>>;
+  using abi_type   = simd_abi::neon_fixed_size<2>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd_mask() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 2;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(value_type value)
+      : m_value(vdupq_n_u64(value ? ~std::uint64_t(0) : std::uint64_t(0))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(G&& gen) {
+    std::uint64_t lanes[2] = {
+        bool(gen(std::integral_constant<std::size_t, 0>())) ? ~std::uint64_t(0)
+                                                            : std::uint64_t(0),
+        bool(gen(std::integral_constant<std::size_t, 1>())) ? ~std::uint64_t(0)
+                                                            : std::uint64_t(0)};
+    m_value = vld1q_u64(lanes);
+  }
+  template <class U>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask(
+      simd_mask<U, abi_type> const& other)
+      : m_value(static_cast<uint64x2_t>(other)) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd_mask(
+      uint64x2_t const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator uint64x2_t() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION uint32x2_t impl_packed() const {
+    return vmovn_u64(m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static simd_mask impl_from_packed(
+      uint32x2_t const& value) {
+    return simd_mask(
+        vreinterpretq_u64_s64(vmovl_s32(vreinterpret_s32_u32(value))));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    std::uint64_t lanes[2];
+    vst1q_u64(lanes, m_value);
+    return lanes[i] != 0;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask
+  operator||(simd_mask const& other) const {
+    return simd_mask(vorrq_u64(m_value, other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask
+  operator&&(simd_mask const& other) const {
+    return simd_mask(vandq_u64(m_value, other.m_value));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd_mask operator!() const {
+    return simd_mask(
+        vreinterpretq_u64_u32(vmvnq_u32(vreinterpretq_u32_u64(m_value))));
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator==(
+      simd_mask const& other) const {
+    return vminvq_u32(vreinterpretq_u32_u64(
+               vceqq_u64(m_value, other.m_value))) != 0;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool operator!=(
+      simd_mask const& other) const {
+    return !operator==(other);
+  }
+};
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool all_of(
+    simd_mask<T, simd_abi::neon_fixed_size<2>> const& mask) {
+  return vminvq_u32(vreinterpretq_u32_u64(static_cast<uint64x2_t>(mask))) != 0;
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool any_of(
+    simd_mask<T, simd_abi::neon_fixed_size<2>> const& mask) {
+  return vmaxvq_u32(vreinterpretq_u32_u64(static_cast<uint64x2_t>(mask))) != 0;
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION bool none_of(
+    simd_mask<T, simd_abi::neon_fixed_size<2>> const& mask) {
+  return !any_of(mask);
+}
+
+template <>
+class simd<float, simd_abi::neon_fixed_size<2>>;
+
+template <>
+class simd<std::int32_t, simd_abi::neon_fixed_size<2>>;
+
+template <>
+class simd<std::int64_t, simd_abi::neon_fixed_size<2>>;
+
+template <>
+class simd<double, simd_abi::neon_fixed_size<2>> {
+  float64x2_t m_value;
+
+ public:
+  using value_type = double;
+  using abi_type   = simd_abi::neon_fixed_size<2>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 2;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(vdupq_n_f64(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen) {
+    value_type lanes[2] = {gen(std::integral_constant<std::size_t, 0>()),
+                           gen(std::integral_constant<std::size_t, 1>())};
+    m_value             = vld1q_f64(lanes);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(float64x2_t const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<float, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int32_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int64_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator float64x2_t() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[2];
+    vst1q_f64(lanes, m_value);
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = vld1q_f64(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = vld1q_f64(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    vst1q_f64(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    vst1q_f64(ptr, m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(vnegq_f64(m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(vaddq_f64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(vsubq_f64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(vmulq_f64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    return simd(vdivq_f64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type(vceqq_f64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return !(lhs == rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type(vcltq_f64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type(vcleq_f64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type(vcgtq_f64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type(vcgeq_f64(lhs.m_value, rhs.m_value));
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<double, simd_abi::neon_fixed_size<2>>
+    condition(simd_mask<double, simd_abi::neon_fixed_size<2>> const& mask,
+              simd<double, simd_abi::neon_fixed_size<2>> const& a,
+              simd<double, simd_abi::neon_fixed_size<2>> const& b) {
+  return simd<double, simd_abi::neon_fixed_size<2>>(
+      vbslq_f64(static_cast<uint64x2_t>(mask), static_cast<float64x2_t>(a),
+                static_cast<float64x2_t>(b)));
+}
+
+template <>
+class simd<float, simd_abi::neon_fixed_size<2>> {
+  float32x2_t m_value;
+
+ public:
+  using value_type = float;
+  using abi_type   = simd_abi::neon_fixed_size<2>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 2;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(vdup_n_f32(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen) {
+    value_type lanes[2] = {gen(std::integral_constant<std::size_t, 0>()),
+                           gen(std::integral_constant<std::size_t, 1>())};
+    m_value             = vld1_f32(lanes);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(float32x2_t const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<double, abi_type> const& other)
+      : m_value(vcvt_f32_f64(static_cast<float64x2_t>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int32_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator float32x2_t() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[2];
+    vst1_f32(lanes, m_value);
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = vld1_f32(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = vld1_f32(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    vst1_f32(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    vst1_f32(ptr, m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(vneg_f32(m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(vadd_f32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(vsub_f32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(vmul_f32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    return simd(vdiv_f32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(vceq_f32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return !(lhs == rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(vclt_f32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(vcle_f32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(vcgt_f32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(vcge_f32(lhs.m_value, rhs.m_value));
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<float, simd_abi::neon_fixed_size<2>>
+    condition(simd_mask<float, simd_abi::neon_fixed_size<2>> const& mask,
+              simd<float, simd_abi::neon_fixed_size<2>> const& a,
+              simd<float, simd_abi::neon_fixed_size<2>> const& b) {
+  return simd<float, simd_abi::neon_fixed_size<2>>(
+      vbsl_f32(mask.impl_packed(), static_cast<float32x2_t>(a),
+               static_cast<float32x2_t>(b)));
+}
+
+template <>
+class simd<std::int32_t, simd_abi::neon_fixed_size<2>> {
+  int32x2_t m_value;
+
+ public:
+  using value_type = std::int32_t;
+  using abi_type   = simd_abi::neon_fixed_size<2>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 2;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(vdup_n_s32(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen) {
+    value_type lanes[2] = {gen(std::integral_constant<std::size_t, 0>()),
+                           gen(std::integral_constant<std::size_t, 1>())};
+    m_value             = vld1_s32(lanes);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(int32x2_t const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<double, abi_type> const& other)
+      : m_value(vmovn_s64(vcvtq_s64_f64(static_cast<float64x2_t>(other)))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<float, abi_type> const& other)
+      : m_value(vcvt_s32_f32(static_cast<float32x2_t>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int64_t, abi_type> const& other);
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator int32x2_t() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[2];
+    vst1_s32(lanes, m_value);
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = vld1_s32(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = vld1_s32(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    vst1_s32(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    vst1_s32(ptr, m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(vneg_s32(m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(vadd_s32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(vsub_s32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(vmul_s32(lhs.m_value, rhs.m_value));
+  }
+  // There is no packed integer division; divide lane by lane.
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    return simd([&](std::size_t i) { return lhs[i] / rhs[i]; });
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator<<(
+      simd const& lhs, int rhs) {
+    return simd(vshl_s32(lhs.m_value, vdup_n_s32(rhs)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator>>(
+      simd const& lhs, int rhs) {
+    return simd(vshl_s32(lhs.m_value, vdup_n_s32(-rhs)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(vceq_s32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return !(lhs == rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(vclt_s32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(vcle_s32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(vcgt_s32(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type::impl_from_packed(vcge_s32(lhs.m_value, rhs.m_value));
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int32_t, simd_abi::neon_fixed_size<2>>
+    condition(simd_mask<std::int32_t, simd_abi::neon_fixed_size<2>> const& mask,
+              simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& a,
+              simd<std::int32_t, simd_abi::neon_fixed_size<2>> const& b) {
+  return simd<std::int32_t, simd_abi::neon_fixed_size<2>>(
+      vbsl_s32(mask.impl_packed(), static_cast<int32x2_t>(a),
+               static_cast<int32x2_t>(b)));
+}
+
+template <>
+class simd<std::int64_t, simd_abi::neon_fixed_size<2>> {
+  int64x2_t m_value;
+
+ public:
+  using value_type = std::int64_t;
+  using abi_type   = simd_abi::neon_fixed_size<2>;
+  using mask_type  = simd_mask<value_type, abi_type>;
+  using reference  = Impl::simd_lane_reference<simd>;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 2;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd(U&& value)
+      : m_value(vdupq_n_s64(value_type(value))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(G&& gen) {
+    value_type lanes[2] = {gen(std::integral_constant<std::size_t, 0>()),
+                           gen(std::integral_constant<std::size_t, 1>())};
+    m_value             = vld1q_s64(lanes);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(int64x2_t const& value)
+      : m_value(value) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<std::int32_t, abi_type> const& other)
+      : m_value(vmovl_s32(static_cast<int32x2_t>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit simd(
+      simd<double, abi_type> const& other)
+      : m_value(vcvtq_s64_f64(static_cast<float64x2_t>(other))) {}
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION explicit operator int64x2_t() const {
+    return m_value;
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION reference operator[](std::size_t i) {
+    return reference(*this, i);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION value_type
+  operator[](std::size_t i) const {
+    value_type lanes[2];
+    vst1q_s64(lanes, m_value);
+    return lanes[i];
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       element_aligned_tag) {
+    m_value = vld1q_s64(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                                       vector_aligned_tag) {
+    m_value = vld1q_s64(ptr);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(
+      value_type* ptr, element_aligned_tag) const {
+    vst1q_s64(ptr, m_value);
+  }
+  KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                                     vector_aligned_tag) const {
+    vst1q_s64(ptr, m_value);
+  }
+
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION simd operator-() const {
+    return simd(vnegq_s64(m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(vaddq_s64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(vsubq_s64(lhs.m_value, rhs.m_value));
+  }
+  // NEON lacks 64-bit multiplication and division; compute lane by lane.
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd([&](std::size_t i) { return lhs[i] * rhs[i]; });
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator/(
+      simd const& lhs, simd const& rhs) {
+    return simd([&](std::size_t i) { return lhs[i] / rhs[i]; });
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator<<(
+      simd const& lhs, int rhs) {
+    return simd(vshlq_s64(lhs.m_value, vdupq_n_s64(rhs)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend simd operator>>(
+      simd const& lhs, int rhs) {
+    return simd(vshlq_s64(lhs.m_value, vdupq_n_s64(-rhs)));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type(vceqq_s64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return !(lhs == rhs);
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type(vcltq_s64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type(vcleq_s64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type(vcgtq_s64(lhs.m_value, rhs.m_value));
+  }
+  [[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION friend mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type(vcgeq_s64(lhs.m_value, rhs.m_value));
+  }
+};
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    simd<std::int64_t, simd_abi::neon_fixed_size<2>>
+    condition(simd_mask<std::int64_t, simd_abi::neon_fixed_size<2>> const& mask,
+              simd<std::int64_t, simd_abi::neon_fixed_size<2>> const& a,
+              simd<std::int64_t, simd_abi::neon_fixed_size<2>> const& b) {
+  return simd<std::int64_t, simd_abi::neon_fixed_size<2>>(
+      vbslq_s64(static_cast<uint64x2_t>(mask), static_cast<int64x2_t>(a),
+                static_cast<int64x2_t>(b)));
+}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<double, simd_abi::neon_fixed_size<2>>::simd(
+    simd<float, abi_type> const& other)
+    : m_value(vcvt_f64_f32(static_cast<float32x2_t>(other))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<double, simd_abi::neon_fixed_size<2>>::simd(
+    simd<std::int32_t, abi_type> const& other)
+    : m_value(vcvtq_f64_s64(vmovl_s32(static_cast<int32x2_t>(other)))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<double, simd_abi::neon_fixed_size<2>>::simd(
+    simd<std::int64_t, abi_type> const& other)
+    : m_value(vcvtq_f64_s64(static_cast<int64x2_t>(other))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<float, simd_abi::neon_fixed_size<2>>::simd(
+    simd<std::int32_t, abi_type> const& other)
+    : m_value(vcvt_f32_s32(static_cast<int32x2_t>(other))) {}
+
+KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+simd<std::int32_t, simd_abi::neon_fixed_size<2>>::simd(
+    simd<std::int64_t, abi_type> const& other)
+    : m_value(vmovn_s64(static_cast<int64x2_t>(other))) {}
+
+}  // namespace Experimental
+
+// Math functions that map to NEON instructions. min and max keep the generic
+// compare-and-blend overloads because vminq/vmaxq propagate NaN from either
+// argument.
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+    abs(Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+            const& a) {
+  return Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>(
+      vabsq_f64(static_cast<float64x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+    sqrt(Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+             const& a) {
+  return Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>(
+      vsqrtq_f64(static_cast<float64x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+    floor(Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+              const& a) {
+  return Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>(
+      vrndmq_f64(static_cast<float64x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+    ceil(Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+             const& a) {
+  return Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>(
+      vrndpq_f64(static_cast<float64x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+    trunc(Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+              const& a) {
+  return Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>(
+      vrndq_f64(static_cast<float64x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+    round(Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+              const& a) {
+  return Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>(
+      vrndaq_f64(static_cast<float64x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+    copysign(
+        Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+            const& a,
+        Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+            const& b) {
+  return Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>(
+      vbslq_f64(vdupq_n_u64(std::uint64_t(1) << 63),
+                static_cast<float64x2_t>(b), static_cast<float64x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+    fma(Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+            const& a,
+        Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+            const& b,
+        Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>
+            const& c) {
+  return Experimental::simd<double, Experimental::simd_abi::neon_fixed_size<2>>(
+      vfmaq_f64(static_cast<float64x2_t>(c), static_cast<float64x2_t>(a),
+                static_cast<float64x2_t>(b)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+    abs(Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+            const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>(
+      vabs_f32(static_cast<float32x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+    sqrt(Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+             const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>(
+      vsqrt_f32(static_cast<float32x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+    floor(Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+              const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>(
+      vrndm_f32(static_cast<float32x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+    ceil(Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+             const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>(
+      vrndp_f32(static_cast<float32x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+    trunc(Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+              const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>(
+      vrnd_f32(static_cast<float32x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+    round(Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+              const& a) {
+  return Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>(
+      vrnda_f32(static_cast<float32x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+    copysign(
+        Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+            const& a,
+        Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+            const& b) {
+  return Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>(
+      vbsl_f32(vdup_n_u32(std::uint32_t(1) << 31), static_cast<float32x2_t>(b),
+               static_cast<float32x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+    fma(Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+            const& a,
+        Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+            const& b,
+        Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>
+            const& c) {
+  return Experimental::simd<float, Experimental::simd_abi::neon_fixed_size<2>>(
+      vfma_f32(static_cast<float32x2_t>(c), static_cast<float32x2_t>(a),
+               static_cast<float32x2_t>(b)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int32_t, Experimental::simd_abi::neon_fixed_size<2>>
+    abs(Experimental::simd<std::int32_t,
+                           Experimental::simd_abi::neon_fixed_size<2>> const&
+            a) {
+  return Experimental::simd<std::int32_t,
+                            Experimental::simd_abi::neon_fixed_size<2>>(
+      vabs_s32(static_cast<int32x2_t>(a)));
+}
+
+[[nodiscard]] KOKKOS_IMPL_HOST_FORCEINLINE_FUNCTION
+    Experimental::simd<std::int64_t, Experimental::simd_abi::neon_fixed_size<2>>
+    abs(Experimental::simd<std::int64_t,
+                           Experimental::simd_abi::neon_fixed_size<2>> const&
+            a) {
+  return Experimental::simd<std::int64_t,
+                            Experimental::simd_abi::neon_fixed_size<2>>(
+      vabsq_s64(static_cast<int64x2_t>(a)));
+}
+
+}  // namespace Kokkos
+
+#endif
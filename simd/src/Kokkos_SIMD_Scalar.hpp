@@ -0,0 +1,310 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOS_SIMD_SCALAR_HPP
+#define KOKKOS_SIMD_SCALAR_HPP
+
+#include <type_traits>
+#include <climits>
+#include <cfloat>
+
+#include <Kokkos_SIMD_Common.hpp>
+
+namespace Kokkos {
+
+namespace Experimental {
+
+namespace simd_abi {
+
+class scalar {};
+
+}  // namespace simd_abi
+
+template <class T>
+class simd_mask<T, simd_abi::scalar> {
+  bool m_value;
+
+ public:
+  using value_type = bool;
+  using simd_type  = simd<T, simd_abi::scalar>;
+  using abi_type   = simd_abi::scalar;
+  using reference  = value_type&;
+
+  KOKKOS_DEFAULTED_FUNCTION simd_mask() = default;
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 1;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION explicit constexpr simd_mask(value_type value)
+      : m_value(value) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION constexpr explicit simd_mask(G&& gen)
+      : m_value(gen(std::integral_constant<std::size_t, 0>())) {}
+  template <class U>
+  KOKKOS_FORCEINLINE_FUNCTION constexpr simd_mask(
+      simd_mask<U, simd_abi::scalar> const& other)
+      : m_value(static_cast<bool>(other)) {}
+  KOKKOS_FORCEINLINE_FUNCTION constexpr explicit operator bool() const {
+    return m_value;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION reference operator[](std::size_t) {
+    return m_value;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr value_type operator[](
+      std::size_t) const {
+    return m_value;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr simd_mask operator||(
+      simd_mask const& other) const {
+    return simd_mask(m_value || other.m_value);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr simd_mask operator&&(
+      simd_mask const& other) const {
+    return simd_mask(m_value && other.m_value);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr simd_mask operator!() const {
+    return simd_mask(!m_value);
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr bool operator==(
+      simd_mask const& other) const {
+    return m_value == other.m_value;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr bool operator!=(
+      simd_mask const& other) const {
+    return m_value != other.m_value;
+  }
+};
+
+template <class T>
+class simd<T, simd_abi::scalar> {
+  T m_value;
+
+ public:
+  using value_type = T;
+  using abi_type   = simd_abi::scalar;
+  using mask_type  = simd_mask<T, abi_type>;
+  using reference  = value_type&;
+
+  KOKKOS_DEFAULTED_FUNCTION simd() = default;
+  KOKKOS_FORCEINLINE_FUNCTION static constexpr std::size_t size() {
+    return 1;
+  }
+  template <class U,
+            std::enable_if_t<std::is_convertible_v<U, value_type>, bool> =
+                false>
+  KOKKOS_FORCEINLINE_FUNCTION constexpr simd(U&& value)
+      : m_value(static_cast<value_type>(value)) {}
+  template <class U>
+  KOKKOS_FORCEINLINE_FUNCTION constexpr explicit simd(
+      simd<U, abi_type> const& other)
+      : m_value(static_cast<value_type>(static_cast<U>(other))) {}
+  template <class G,
+            std::enable_if_t<
+                std::is_invocable_r_v<value_type, G,
+                                      std::integral_constant<std::size_t, 0>>,
+                bool> = false>
+  KOKKOS_FORCEINLINE_FUNCTION constexpr explicit simd(G&& gen)
+      : m_value(gen(std::integral_constant<std::size_t, 0>())) {}
+  KOKKOS_FORCEINLINE_FUNCTION constexpr explicit operator value_type() const {
+    return m_value;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION reference operator[](std::size_t) {
+    return m_value;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION constexpr value_type operator[](
+      std::size_t) const {
+    return m_value;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                             element_aligned_tag) {
+    m_value = *ptr;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void copy_from(value_type const* ptr,
+                                             vector_aligned_tag) {
+    m_value = *ptr;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                           element_aligned_tag) const {
+    *ptr = m_value;
+  }
+  KOKKOS_FORCEINLINE_FUNCTION void copy_to(value_type* ptr,
+                                           vector_aligned_tag) const {
+    *ptr = m_value;
+  }
+
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION constexpr simd operator-() const {
+    return simd(-m_value);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr simd operator+(
+      simd const& lhs, simd const& rhs) {
+    return simd(lhs.m_value + rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr simd operator-(
+      simd const& lhs, simd const& rhs) {
+    return simd(lhs.m_value - rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr simd operator*(
+      simd const& lhs, simd const& rhs) {
+    return simd(lhs.m_value * rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr simd operator/(
+      simd const& lhs, simd const& rhs) {
+    return simd(lhs.m_value / rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr simd operator<<(
+      simd const& lhs, int rhs) {
+    static_assert(std::is_integral_v<T>, "shifts require an integral simd");
+    return simd(lhs.m_value << rhs);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr simd operator>>(
+      simd const& lhs, int rhs) {
+    static_assert(std::is_integral_v<T>, "shifts require an integral simd");
+    return simd(lhs.m_value >> rhs);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr mask_type
+  operator==(simd const& lhs, simd const& rhs) {
+    return mask_type(lhs.m_value == rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr mask_type
+  operator!=(simd const& lhs, simd const& rhs) {
+    return mask_type(lhs.m_value != rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr mask_type
+  operator<(simd const& lhs, simd const& rhs) {
+    return mask_type(lhs.m_value < rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr mask_type
+  operator<=(simd const& lhs, simd const& rhs) {
+    return mask_type(lhs.m_value <= rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr mask_type
+  operator>(simd const& lhs, simd const& rhs) {
+    return mask_type(lhs.m_value > rhs.m_value);
+  }
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION friend constexpr mask_type
+  operator>=(simd const& lhs, simd const& rhs) {
+    return mask_type(lhs.m_value >= rhs.m_value);
+  }
+};
+
+template <class T>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION constexpr simd<T, simd_abi::scalar>
+condition(simd_mask<T, simd_abi::scalar> const& mask,
+          simd<T, simd_abi::scalar> const& a,
+          simd<T, simd_abi::scalar> const& b) {
+  return static_cast<bool>(mask) ? a : b;
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION constexpr bool all_of(
+    simd_mask<T, simd_abi::scalar> const& mask) {
+  return static_cast<bool>(mask);
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION constexpr bool any_of(
+    simd_mask<T, simd_abi::scalar> const& mask) {
+  return static_cast<bool>(mask);
+}
+
+template <class T>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION constexpr bool none_of(
+    simd_mask<T, simd_abi::scalar> const& mask) {
+  return !static_cast<bool>(mask);
+}
+
+}  // namespace Experimental
+
+// Device-callable overloads of the math functions for the scalar ABI, which
+// is the native ABI of the device backends.
+
+#define KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(FUNC)                \
+  template <class T>                                                \
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION                         \
+      Experimental::simd<T, Experimental::simd_abi::scalar>         \
+      FUNC(Experimental::simd<T, Experimental::simd_abi::scalar> const& a) { \
+    return Kokkos::FUNC(static_cast<T>(a));                         \
+  }
+
+#define KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION(FUNC)                    \
+  template <class T>                                                     \
+  [[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION                              \
+      Experimental::simd<T, Experimental::simd_abi::scalar>              \
+      FUNC(Experimental::simd<T, Experimental::simd_abi::scalar> const& a, \
+           Experimental::simd<T, Experimental::simd_abi::scalar> const& b) { \
+    return Kokkos::FUNC(static_cast<T>(a), static_cast<T>(b));           \
+  }
+
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(abs)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(exp)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(exp2)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(expm1)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(log)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(log10)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(log2)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(log1p)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(sqrt)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(cbrt)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(sin)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(cos)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(tan)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(asin)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(acos)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(atan)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(sinh)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(cosh)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(tanh)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(asinh)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(acosh)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(atanh)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(erf)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(erfc)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(tgamma)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(lgamma)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(ceil)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(floor)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(trunc)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(round)
+KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION(nearbyint)
+
+KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION(pow)
+KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION(hypot)
+KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION(atan2)
+KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION(copysign)
+KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION(fmod)
+KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION(fmin)
+KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION(fmax)
+KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION(min)
+KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION(max)
+
+#undef KOKKOS_IMPL_SIMD_SCALAR_UNARY_FUNCTION
+#undef KOKKOS_IMPL_SIMD_SCALAR_BINARY_FUNCTION
+
+template <class T>
+[[nodiscard]] KOKKOS_FORCEINLINE_FUNCTION
+    Experimental::simd<T, Experimental::simd_abi::scalar>
+    fma(Experimental::simd<T, Experimental::simd_abi::scalar> const& a,
+        Experimental::simd<T, Experimental::simd_abi::scalar> const& b,
+        Experimental::simd<T, Experimental::simd_abi::scalar> const& c) {
+  return Kokkos::fma(static_cast<T>(a), static_cast<T>(b), static_cast<T>(c));
+}
+
+}  // namespace Kokkos
+
+#endif
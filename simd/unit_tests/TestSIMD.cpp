@@ -0,0 +1,528 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+
+#include <gtest/gtest.h>
+
+#include <Kokkos_Core.hpp>
+#include <Kokkos_SIMD.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace Test {
+
+using Kokkos::Experimental::element_aligned_tag;
+using Kokkos::Experimental::simd;
+using Kokkos::Experimental::simd_mask;
+using Kokkos::Experimental::vector_aligned_tag;
+
+template <class... Abis>
+struct abi_set {};
+
+using host_abi_set = abi_set<
+    Kokkos::Experimental::simd_abi::scalar
+#if defined(KOKKOS_ARCH_AVX2) || defined(KOKKOS_ARCH_AVX512XEON)
+    ,
+    Kokkos::Experimental::simd_abi::avx2_fixed_size<4>
+#endif
+#ifdef KOKKOS_ARCH_AVX512XEON
+    ,
+    Kokkos::Experimental::simd_abi::avx512_fixed_size<8>
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__)
+    ,
+    Kokkos::Experimental::simd_abi::neon_fixed_size<2>
+#endif
+    >;
+
+template <class Abi, class T>
+void host_check_arithmetic() {
+  using simd_type            = simd<T, Abi>;
+  constexpr std::size_t width = simd_type::size();
+  T a[width];
+  T b[width];
+  for (std::size_t i = 0; i < width; ++i) {
+    a[i] = T(3 * i + 7);
+    b[i] = (i % 2 == 0) ? T(i + 2) : -T(i + 2);
+  }
+  simd_type x;
+  simd_type y;
+  x.copy_from(a, element_aligned_tag());
+  y.copy_from(b, element_aligned_tag());
+
+  simd_type const sum  = x + y;
+  simd_type const diff = x - y;
+  simd_type const prod = x * y;
+  simd_type const quot = x / y;
+  simd_type const neg  = -y;
+  auto const lt        = x < y;
+  auto const le        = x <= x;
+  auto const gt        = x > y;
+  auto const eq        = x == y;
+  auto const ne        = x != y;
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(sum[i], T(a[i] + b[i]));
+    EXPECT_EQ(diff[i], T(a[i] - b[i]));
+    EXPECT_EQ(prod[i], T(a[i] * b[i]));
+    EXPECT_EQ(quot[i], T(a[i] / b[i]));
+    EXPECT_EQ(neg[i], T(-b[i]));
+    EXPECT_EQ(lt[i], a[i] < b[i]);
+    EXPECT_TRUE(le[i]);
+    EXPECT_EQ(gt[i], a[i] > b[i]);
+    EXPECT_EQ(eq[i], a[i] == b[i]);
+    EXPECT_EQ(ne[i], a[i] != b[i]);
+  }
+
+  simd_type z = x;
+  z += T(1);
+  z *= y;
+  z -= x;
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(z[i], T((a[i] + T(1)) * b[i] - a[i]));
+  }
+
+  simd_type lanes([](std::size_t i) { return T(i); });
+  lanes[width - 1] = T(42);
+  for (std::size_t i = 0; i + 1 < width; ++i) EXPECT_EQ(lanes[i], T(i));
+  EXPECT_EQ(lanes[width - 1], T(42));
+
+  if constexpr (std::is_integral_v<T>) {
+    simd_type const shl = x << 3;
+    simd_type const shr = y >> 1;
+    for (std::size_t i = 0; i < width; ++i) {
+      EXPECT_EQ(shl[i], T(a[i] << 3));
+      EXPECT_EQ(shr[i], T(b[i] >> 1));
+    }
+  }
+}
+
+template <class Abi, class T>
+void host_check_masks() {
+  using simd_type = simd<T, Abi>;
+  using mask_type = typename simd_type::mask_type;
+  constexpr std::size_t width = simd_type::size();
+
+  mask_type const all_true(true);
+  mask_type const all_false(false);
+  mask_type const even([](std::size_t i) { return i % 2 == 0; });
+  EXPECT_TRUE(Kokkos::Experimental::all_of(all_true));
+  EXPECT_TRUE(Kokkos::Experimental::none_of(all_false));
+  EXPECT_FALSE(Kokkos::Experimental::any_of(all_false));
+  EXPECT_TRUE(Kokkos::Experimental::any_of(even));
+  EXPECT_EQ(Kokkos::Experimental::all_of(even), width == 1);
+  EXPECT_TRUE((even || !even) == all_true);
+  EXPECT_TRUE((even && !even) == all_false);
+  EXPECT_TRUE(even != all_false);
+  for (std::size_t i = 0; i < width; ++i) EXPECT_EQ(even[i], i % 2 == 0);
+
+  // Masks of one value type select lanes of another in the same ABI.
+  simd_mask<std::int32_t, Abi> const index_mask = even;
+  simd<std::int32_t, Abi> idx([](std::size_t i) { return std::int32_t(i); });
+  where(index_mask, idx) = -1;
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(idx[i], i % 2 == 0 ? -1 : std::int32_t(i));
+  }
+}
+
+template <class Abi, class T>
+void host_check_where() {
+  using simd_type = simd<T, Abi>;
+  constexpr std::size_t width = simd_type::size();
+  using index_type = simd<std::int32_t, Abi>;
+
+  simd_type x([](std::size_t i) { return T(i); });
+  where(x < simd_type(T(width / 2)), x) = T(-1);
+  where(x > T(0), x) += T(10);
+  for (std::size_t i = 0; i < width; ++i) {
+    T const expected = i < width / 2 ? T(-1) : i > 0 ? T(i + 10) : T(i);
+    EXPECT_EQ(x[i], expected);
+  }
+
+  // Masked loads and stores only touch the selected lanes.
+  T memory[2 * width];
+  for (std::size_t i = 0; i < 2 * width; ++i) memory[i] = T(100 + i);
+  simd_type const values([](std::size_t i) { return T(i); });
+  auto const odd = !typename simd_type::mask_type(
+      [](std::size_t i) { return i % 2 == 0; });
+  where(odd, values).copy_to(memory, element_aligned_tag());
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(memory[i], i % 2 == 1 ? T(i) : T(100 + i));
+  }
+  simd_type loaded(T(-5));
+  where(odd, loaded).copy_from(memory + width, element_aligned_tag());
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(loaded[i], i % 2 == 1 ? T(100 + width + i) : T(-5));
+  }
+
+  // Gather from reversed even offsets, then scatter back to odd ones.
+  index_type const gather_index(
+      [](std::size_t i) { return std::int32_t(2 * (width - 1 - i)); });
+  simd_type gathered(T(0));
+  where(typename simd_type::mask_type(true), gathered)
+      .gather_from(memory, gather_index);
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(gathered[i], memory[2 * (width - 1 - i)]);
+  }
+  index_type const scatter_index(
+      [](std::size_t i) { return std::int32_t(2 * i + 1); });
+  T scattered[2 * width] = {};
+  where(gathered > T(100), gathered).scatter_to(scattered, scatter_index);
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(scattered[2 * i], T(0));
+    EXPECT_EQ(scattered[2 * i + 1], gathered[i] > T(100) ? gathered[i] : T(0));
+  }
+
+  EXPECT_EQ(Kokkos::Experimental::reduce(values),
+            T(width * (width - 1) / 2));
+  EXPECT_EQ(Kokkos::Experimental::hmax(values), T(width - 1));
+  EXPECT_EQ(Kokkos::Experimental::hmin(values), T(0));
+  EXPECT_EQ(Kokkos::Experimental::hmin(where(values > T(0), values)),
+            width > 1 ? T(1) : Kokkos::reduction_identity<T>::min());
+}
+
+template <class Abi>
+void host_check_conversions() {
+  using double_type = simd<double, Abi>;
+  using float_type  = simd<float, Abi>;
+  using int32_type  = simd<std::int32_t, Abi>;
+  using int64_type  = simd<std::int64_t, Abi>;
+  constexpr std::size_t width = double_type::size();
+
+  double_type const d([](std::size_t i) { return -2.75 + 1.5 * i; });
+  int32_type const i32(d);
+  int64_type const i64(d);
+  float_type const f(i32);
+  double_type const from_i32(i32);
+  double_type const from_i64(i64);
+  int64_type const widened(i32);
+  int32_type const narrowed(widened);
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_EQ(i32[i], std::int32_t(d[i]));
+    EXPECT_EQ(i64[i], std::int64_t(d[i]));
+    EXPECT_EQ(f[i], float(i32[i]));
+    EXPECT_EQ(from_i32[i], double(i32[i]));
+    EXPECT_EQ(from_i64[i], double(i64[i]));
+    EXPECT_EQ(widened[i], std::int64_t(i32[i]));
+    EXPECT_EQ(narrowed[i], i32[i]);
+  }
+}
+
+template <class Abi, class T>
+void host_check_math() {
+  using simd_type = simd<T, Abi>;
+  constexpr std::size_t width = simd_type::size();
+  T const inputs[] = {T(-2.5), T(-1.5), T(-0.5), T(-0.49999997),
+                      T(0.5),  T(1.5),  T(2.5),  T(0.75),
+                      T(-3.25), T(7),   T(1e-3), T(-0.0)};
+  constexpr std::size_t count = sizeof(inputs) / sizeof(T);
+  for (std::size_t first = 0; first < count; first += width) {
+    T a[width];
+    for (std::size_t i = 0; i < width; ++i) {
+      a[i] = inputs[(first + i) % count];
+    }
+    simd_type x;
+    x.copy_from(a, element_aligned_tag());
+    simd_type const y = -x + T(0.25);
+
+    simd_type const r_abs   = Kokkos::abs(x);
+    simd_type const r_floor = Kokkos::floor(x);
+    simd_type const r_ceil  = Kokkos::ceil(x);
+    simd_type const r_trunc = Kokkos::trunc(x);
+    simd_type const r_round = Kokkos::round(x);
+    simd_type const r_sqrt  = Kokkos::sqrt(Kokkos::abs(x));
+    simd_type const r_csign = Kokkos::copysign(y, x);
+    simd_type const r_min   = Kokkos::min(x, y);
+    simd_type const r_max   = Kokkos::max(x, y);
+    simd_type const r_fma   = Kokkos::fma(x, y, simd_type(T(3)));
+    for (std::size_t i = 0; i < width; ++i) {
+      T const b = y[i];
+      EXPECT_EQ(r_abs[i], Kokkos::abs(a[i]));
+      EXPECT_EQ(r_floor[i], Kokkos::floor(a[i]));
+      EXPECT_EQ(r_ceil[i], Kokkos::ceil(a[i]));
+      EXPECT_EQ(r_trunc[i], Kokkos::trunc(a[i]));
+      EXPECT_EQ(r_round[i], Kokkos::round(a[i])) << a[i];
+      EXPECT_EQ(r_sqrt[i], Kokkos::sqrt(Kokkos::abs(a[i])));
+      EXPECT_EQ(r_csign[i], Kokkos::copysign(b, a[i]));
+      EXPECT_EQ(r_min[i], Kokkos::min(a[i], b));
+      EXPECT_EQ(r_max[i], Kokkos::max(a[i], b));
+      EXPECT_EQ(r_fma[i], Kokkos::fma(a[i], b, T(3)));
+    }
+  }
+
+  // NaN follows the scalar Kokkos::min/max convention of returning the
+  // first argument unless the second compares less (or greater).
+  T const nan = std::numeric_limits<T>::quiet_NaN();
+  simd_type const with_nan(nan);
+  simd_type const one(T(1));
+  simd_type const min_nan_one = Kokkos::min(with_nan, one);
+  simd_type const min_one_nan = Kokkos::min(one, with_nan);
+  simd_type const max_nan_one = Kokkos::max(with_nan, one);
+  simd_type const max_one_nan = Kokkos::max(one, with_nan);
+  for (std::size_t i = 0; i < width; ++i) {
+    EXPECT_TRUE(Kokkos::isnan(min_nan_one[i]));
+    EXPECT_EQ(min_one_nan[i], T(1));
+    EXPECT_TRUE(Kokkos::isnan(max_nan_one[i]));
+    EXPECT_EQ(max_one_nan[i], T(1));
+  }
+}
+
+// Distance of result from the exact value reference in units of the last place
+// of reference rounded to T.
+template <class T, class R>
+double ulp_error(T result, R reference) {
+  if (Kokkos::isnan(reference)) {
+    return Kokkos::isnan(result) ? 0.0 : std::numeric_limits<double>::max();
+  }
+  T const rounded = T(reference);
+  if (result == rounded) return 0.0;
+  if (Kokkos::isinf(rounded) || !Kokkos::isfinite(result)) {
+    return std::numeric_limits<double>::max();
+  }
+  T const magnitude = Kokkos::abs(rounded);
+  T const ulp =
+      std::nextafter(magnitude, std::numeric_limits<T>::infinity()) - magnitude;
+  return double(Kokkos::abs(R(result) - reference) / R(ulp));
+}
+
+// Compares a vectorized math function against the scalar one evaluated in a
+// wider type on count arguments spread over [lo, hi] and on the special
+// values, and returns the largest error in ulp.
+template <class Abi, class T, class F, class G>
+double host_math_error(F const& vectorized, G const& reference, T lo, T hi,
+                       int count) {
+  using wide_type =
+      std::conditional_t<std::is_same_v<T, float>, double, long double>;
+  using simd_type             = simd<T, Abi>;
+  constexpr std::size_t width = simd_type::size();
+  std::vector<T> inputs = {T(0),
+                           T(-0.0),
+                           std::numeric_limits<T>::infinity(),
+                           -std::numeric_limits<T>::infinity(),
+                           std::numeric_limits<T>::quiet_NaN(),
+                           std::numeric_limits<T>::min(),
+                           std::numeric_limits<T>::denorm_min(),
+                           T(1),
+                           T(-1)};
+  for (int i = 0; i < count; ++i) {
+    inputs.push_back(lo + (hi - lo) * (T(i) + T(0.5)) / T(count));
+  }
+  double worst = 0.0;
+  for (std::size_t first = 0; first < inputs.size(); first += width) {
+    T a[width];
+    for (std::size_t i = 0; i < width; ++i) {
+      a[i] = inputs[(first + i) % inputs.size()];
+    }
+    simd_type x;
+    x.copy_from(a, element_aligned_tag());
+    simd_type const r = vectorized(x);
+    for (std::size_t i = 0; i < width; ++i) {
+      double const error =
+          ulp_error(T(r[i]), wide_type(reference(wide_type(a[i]))));
+      EXPECT_LT(error, std::numeric_limits<double>::max()) << a[i];
+      worst = std::max(worst, error);
+    }
+  }
+  return worst;
+}
+
+// The accuracy bound documented in Kokkos_SIMD_Math.hpp, with half an ulp of
+// slack where long double is no wider than double and the reference rounds.
+template <class Abi, class T>
+void host_check_vectorized_math() {
+  using simd_type = simd<T, Abi>;
+  double const bound =
+      (std::is_same_v<T, double> && sizeof(long double) == sizeof(double))
+          ? 1.5
+          : 1.0;
+  T const max_exp      = std::is_same_v<T, float> ? T(89) : T(710);
+  T const min_exp      = std::is_same_v<T, float> ? T(-104) : T(-746);
+  int const n          = 20000;
+  auto const exp       = [](simd_type const& x) { return Kokkos::exp(x); };
+  auto const expm1     = [](simd_type const& x) { return Kokkos::expm1(x); };
+  auto const log       = [](simd_type const& x) { return Kokkos::log(x); };
+  auto const sin       = [](simd_type const& x) { return Kokkos::sin(x); };
+  auto const cos       = [](simd_type const& x) { return Kokkos::cos(x); };
+  auto const tanh      = [](simd_type const& x) { return Kokkos::tanh(x); };
+  auto const erf       = [](simd_type const& x) { return Kokkos::erf(x); };
+  auto const ref_exp   = [](auto v) { return Kokkos::exp(v); };
+  auto const ref_expm1 = [](auto v) { return Kokkos::expm1(v); };
+  auto const ref_log   = [](auto v) { return Kokkos::log(v); };
+  auto const ref_sin   = [](auto v) { return Kokkos::sin(v); };
+  auto const ref_cos   = [](auto v) { return Kokkos::cos(v); };
+  auto const ref_tanh  = [](auto v) { return Kokkos::tanh(v); };
+  auto const ref_erf   = [](auto v) { return Kokkos::erf(v); };
+  EXPECT_LE(host_math_error<Abi>(exp, ref_exp, min_exp, max_exp, n), bound);
+  EXPECT_LE(host_math_error<Abi>(exp, ref_exp, T(-1), T(1), n), bound);
+  EXPECT_LE(host_math_error<Abi>(expm1, ref_expm1, T(-50), max_exp, n), bound);
+  EXPECT_LE(host_math_error<Abi>(expm1, ref_expm1, T(-1), T(1), n), bound);
+  EXPECT_LE(host_math_error<Abi>(log, ref_log, T(0), T(4), n), bound);
+  EXPECT_LE(host_math_error<Abi>(log, ref_log, T(0),
+                                 std::numeric_limits<T>::max(), n),
+            bound);
+  EXPECT_LE(host_math_error<Abi>(log, ref_log,
+                                 std::numeric_limits<T>::denorm_min(),
+                                 T(1000) * std::numeric_limits<T>::min(), n),
+            bound);
+  EXPECT_LE(host_math_error<Abi>(sin, ref_sin, T(-10), T(10), n), bound);
+  EXPECT_LE(host_math_error<Abi>(sin, ref_sin, T(-1e6), T(1e6), n), bound);
+  EXPECT_LE(host_math_error<Abi>(cos, ref_cos, T(-10), T(10), n), bound);
+  EXPECT_LE(host_math_error<Abi>(cos, ref_cos, T(-1e6), T(1e6), n), bound);
+  EXPECT_LE(host_math_error<Abi>(tanh, ref_tanh, T(-25), T(25), n), bound);
+  EXPECT_LE(host_math_error<Abi>(tanh, ref_tanh, T(-1), T(1), n), bound);
+  EXPECT_LE(host_math_error<Abi>(erf, ref_erf, T(-7), T(7), n), bound);
+  EXPECT_LE(host_math_error<Abi>(erf, ref_erf, T(-0.1), T(0.1), n), bound);
+  for (T const y : {T(-7.5), T(-0.5), T(0.3), T(2), T(3), T(13.7)}) {
+    auto const pow = [y](simd_type const& x) { return Kokkos::pow(x, y); };
+    auto const ref_pow = [y](auto v) {
+      return Kokkos::pow(v, decltype(v)(y));
+    };
+    EXPECT_LE(host_math_error<Abi>(pow, ref_pow, T(-10), T(10), n), bound)
+        << y;
+  }
+  // Results near the overflow and underflow thresholds.
+  for (T const x : {T(0.01), T(0.5), T(1.5), T(7)}) {
+    auto const pow = [x](simd_type const& y) {
+      return Kokkos::pow(simd_type(x), y);
+    };
+    auto const ref_pow = [x](auto v) { return Kokkos::pow(decltype(v)(x), v); };
+    T const scale = Kokkos::abs(Kokkos::log(x));
+    EXPECT_LE(host_math_error<Abi>(pow, ref_pow, min_exp / scale,
+                                   max_exp / scale, n),
+              bound)
+        << x;
+  }
+}
+
+template <class Abi>
+void host_check_view() {
+  using simd_type = simd<double, Abi>;
+  constexpr int width = simd_type::size();
+  int const n         = 16 * width;
+
+  // HostSpace allocations are aligned for every host ABI, so the rows of a
+  // LayoutRight View whose extent is a multiple of the width can be loaded
+  // with vector_aligned_tag.
+  Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace> x("x", 3, n);
+  Kokkos::View<double**, Kokkos::LayoutRight, Kokkos::HostSpace> y("y", 3, n);
+  for (int r = 0; r < 3; ++r) {
+    for (int i = 0; i < n; ++i) {
+      x(r, i) = 0.5 * i + r;
+      y(r, i) = 1.0 - i;
+    }
+  }
+  double const alpha = 2.0;
+  for (int r = 0; r < 3; ++r) {
+    for (int i = 0; i < n; i += width) {
+      simd_type xv;
+      simd_type yv;
+      xv.copy_from(&x(r, i), vector_aligned_tag());
+      yv.copy_from(&y(r, i), vector_aligned_tag());
+      yv = alpha * xv + yv;
+      yv.copy_to(&y(r, i), vector_aligned_tag());
+    }
+  }
+  for (int r = 0; r < 3; ++r) {
+    for (int i = 0; i < n; ++i) {
+      EXPECT_EQ(y(r, i), alpha * (0.5 * i + r) + (1.0 - i));
+    }
+  }
+
+  // Views of simd values.
+  Kokkos::View<simd_type*, Kokkos::HostSpace> packed("packed", 4);
+  for (int i = 0; i < 4; ++i) packed(i) = simd_type(double(i));
+  simd_type total(0.0);
+  for (int i = 0; i < 4; ++i) total += packed(i);
+  for (int i = 0; i < width; ++i) EXPECT_EQ(total[i], 6.0);
+}
+
+template <class Abi>
+void host_check_abi() {
+  host_check_arithmetic<Abi, double>();
+  host_check_arithmetic<Abi, float>();
+  host_check_arithmetic<Abi, std::int32_t>();
+  host_check_arithmetic<Abi, std::int64_t>();
+  host_check_masks<Abi, double>();
+  host_check_masks<Abi, float>();
+  host_check_masks<Abi, std::int32_t>();
+  host_check_masks<Abi, std::int64_t>();
+  host_check_where<Abi, double>();
+  host_check_where<Abi, float>();
+  host_check_where<Abi, std::int32_t>();
+  host_check_where<Abi, std::int64_t>();
+  host_check_conversions<Abi>();
+  host_check_math<Abi, double>();
+  host_check_math<Abi, float>();
+  // The scalar ABI calls the math library, whose accuracy is not ours.
+  if constexpr (!std::is_same_v<Abi,
+                                Kokkos::Experimental::simd_abi::scalar>) {
+    host_check_vectorized_math<Abi, double>();
+    host_check_vectorized_math<Abi, float>();
+  }
+  host_check_view<Abi>();
+}
+
+template <class... Abis>
+void host_check_abis(abi_set<Abis...>) {
+  (host_check_abi<Abis>(), ...);
+}
+
+TEST(simd, host) { host_check_abis(host_abi_set()); }
+
+// Each vector lane of a team accumulates a simd value; the per-lane results
+// are combined with Kokkos::Sum through reduction_identity<simd>.
+TEST(simd, team_vector_reduce) {
+  using execution_space = Kokkos::DefaultHostExecutionSpace;
+  using simd_type =
+      Kokkos::Experimental::native_simd<double>;
+  using member_type = Kokkos::TeamPolicy<execution_space>::member_type;
+  constexpr int width = simd_type::size();
+  int const league    = 8;
+  int const n         = 64;
+
+  Kokkos::View<double**, Kokkos::LayoutRight, execution_space> data(
+      "data", league, n * width);
+  Kokkos::parallel_for(
+      Kokkos::MDRangePolicy<execution_space, Kokkos::Rank<2>>(
+          {0, 0}, {league, n * width}),
+      KOKKOS_LAMBDA(int l, int i) { data(l, i) = l + 0.5 * (i % width); });
+
+  Kokkos::View<double*, execution_space> sums("sums", league);
+  Kokkos::parallel_for(
+      Kokkos::TeamPolicy<execution_space>(league, 1),
+      KOKKOS_LAMBDA(member_type const& team) {
+        int const l = team.league_rank();
+        simd_type total;
+        Kokkos::parallel_reduce(
+            Kokkos::ThreadVectorRange(team, n),
+            [&](int j, simd_type& partial) {
+              simd_type v;
+              v.copy_from(&data(l, j * width), vector_aligned_tag());
+              partial += v;
+            },
+            Kokkos::Sum<simd_type>(total));
+        sums(l) = Kokkos::Experimental::reduce(total);
+      });
+
+  auto sums_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), sums);
+  for (int l = 0; l < league; ++l) {
+    EXPECT_EQ(sums_h(l), n * (width * l + 0.25 * width * (width - 1)));
+  }
+}
+
+}  // namespace Test
@@ -12,6 +12,8 @@ SPDX-License-Identifier: (BSD-3-Clause)
 #include <desul/atomics/Common.hpp>
 #include <desul/atomics/Lock_Array.hpp>
 #include <desul/atomics/Thread_Fence_GCC.hpp>
+#include <cstdint>
+#include <cstring>
 #include <type_traits>
 
 namespace desul {
@@ -30,6 +32,68 @@ struct host_atomic_exchange_available_gcc {
       std::is_trivially_copyable<T>::value;
 };
 
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+// 16-byte types that would otherwise go through the lock array.  They are
+// updated with cmpxchg16b whenever the address is 16-byte aligned, which is a
+// property of the address, so all operations on a given object agree on
+// whether they are lock-free.  Values are compared bitwise.
+template <class T>
+struct host_atomic_cmpxchg16b_eligible {
+  constexpr static bool value = sizeof(T) == 16 && std::is_trivially_copyable<T>::value &&
+                                !host_atomic_exchange_available_gcc<T>::value;
+};
+
+__extension__ typedef unsigned __int128 host_atomic_uint128_t;
+
+inline bool host_atomic_is_16byte_aligned(const void* ptr) {
+  return (reinterpret_cast<uintptr_t>(ptr) & 15) == 0;
+}
+
+template <class T>
+inline host_atomic_uint128_t host_atomic_to_uint128(const T& val) {
+  host_atomic_uint128_t bits;
+  std::memcpy(&bits, &val, sizeof(bits));
+  return bits;
+}
+
+template <class T>
+inline T host_atomic_from_uint128(host_atomic_uint128_t bits, T val) {
+  std::memcpy(static_cast<void*>(&val), &bits, sizeof(bits));
+  return val;
+}
+
+inline host_atomic_uint128_t host_atomic_cmpxchg16b(host_atomic_uint128_t* dest,
+                                                    host_atomic_uint128_t compare,
+                                                    host_atomic_uint128_t value) {
+  // Full barrier, which satisfies every memory order
+  return __sync_val_compare_and_swap(dest, compare, value);
+}
+
+template <class T>
+T host_atomic_exchange_cmpxchg16b(T* const dest, const T& val) {
+  auto* const ptr = reinterpret_cast<host_atomic_uint128_t*>(dest);
+  host_atomic_uint128_t const newval = host_atomic_to_uint128(val);
+  host_atomic_uint128_t oldval = *ptr;
+  host_atomic_uint128_t assume;
+  do {
+    assume = oldval;
+    oldval = host_atomic_cmpxchg16b(ptr, assume, newval);
+  } while (assume != oldval);
+  return host_atomic_from_uint128(oldval, val);
+}
+
+template <class T>
+T host_atomic_compare_exchange_cmpxchg16b(T* const dest,
+                                          const T& compare,
+                                          const T& val) {
+  return host_atomic_from_uint128(
+      host_atomic_cmpxchg16b(reinterpret_cast<host_atomic_uint128_t*>(dest),
+                             host_atomic_to_uint128(compare),
+                             host_atomic_to_uint128(val)),
+      val);
+}
+#endif
+
 // clang-format off
 // Disable warning for large atomics on clang 7 and up (checked with godbolt)
 // error: large atomic operation may incur significant performance penalty [-Werror,-Watomic-alignment]
@@ -86,6 +150,12 @@ std::enable_if_t<!host_atomic_exchange_available_gcc<T>::value, T> host_atomic_e
     dont_deduce_this_parameter_t<const T> val,
     MemoryOrder /*order*/,
     MemoryScope scope) {
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+  if constexpr (host_atomic_cmpxchg16b_eligible<T>::value) {
+    if (host_atomic_is_16byte_aligned(dest))
+      return host_atomic_exchange_cmpxchg16b(dest, val);
+  }
+#endif
   // Acquire a lock for the address
   // clang-format off
   while (!lock_address((void*)dest, scope)) {}
@@ -106,6 +176,12 @@ host_atomic_compare_exchange(T* const dest,
                              dont_deduce_this_parameter_t<const T> val,
                              MemoryOrder /*order*/,
                              MemoryScope scope) {
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+  if constexpr (host_atomic_cmpxchg16b_eligible<T>::value) {
+    if (host_atomic_is_16byte_aligned(dest))
+      return host_atomic_compare_exchange_cmpxchg16b(dest, compare, val);
+  }
+#endif
   // Acquire a lock for the address
   // clang-format off
   while (!lock_address((void*)dest, scope)) {}
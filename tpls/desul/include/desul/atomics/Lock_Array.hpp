@@ -25,6 +25,7 @@ namespace desul {
 namespace Impl {
 
 struct HostLocks {
+#ifdef DESUL_ATOMICS_ENABLE_COMPACT_HOST_LOCKS
   static constexpr uint32_t HOST_SPACE_ATOMIC_MASK = 0xFFFF;
   static constexpr uint32_t HOST_SPACE_ATOMIC_XOR_MASK = 0x5A39;
   template <class is_always_void = void>
@@ -36,6 +37,30 @@ struct HostLocks {
     return &get_host_locks_()[((uint64_t(ptr) >> 2) & HOST_SPACE_ATOMIC_MASK) ^
                               HOST_SPACE_ATOMIC_XOR_MASK];
   }
+#else
+  // Striped lock table: every lock owns a 128 byte block (two cache lines, to
+  // also defeat the adjacent line prefetcher) so that threads spinning on
+  // different locks never share a line.  Addresses are spread over the stripes
+  // with Fibonacci hashing, neighbouring array elements land on unrelated
+  // stripes.  Define DESUL_ATOMICS_ENABLE_COMPACT_HOST_LOCKS to get the dense
+  // table of 65536 int32_t locks instead.
+  static constexpr int HOST_SPACE_ATOMIC_STRIPE_BITS = 12;
+  static constexpr uint32_t HOST_SPACE_ATOMIC_MASK =
+      (uint32_t(1) << HOST_SPACE_ATOMIC_STRIPE_BITS) - 1;
+  struct alignas(128) PaddedLock {
+    int32_t lock;
+  };
+  template <class is_always_void = void>
+  static PaddedLock* get_host_locks_() {
+    static PaddedLock HOST_SPACE_ATOMIC_LOCKS_DEVICE[HOST_SPACE_ATOMIC_MASK + 1] = {};
+    return HOST_SPACE_ATOMIC_LOCKS_DEVICE;
+  }
+  static inline int32_t* get_host_lock_(void* ptr) {
+    return &get_host_locks_()[((uint64_t(ptr) >> 2) * 0x9E3779B97F4A7C15ull) >>
+                              (64 - HOST_SPACE_ATOMIC_STRIPE_BITS)]
+                .lock;
+  }
+#endif
 };
 
 inline void init_lock_arrays() {
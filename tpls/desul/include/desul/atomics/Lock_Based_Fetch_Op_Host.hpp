@@ -11,12 +11,37 @@ SPDX-License-Identifier: (BSD-3-Clause)
 
 #include <desul/atomics/Common.hpp>
 #include <desul/atomics/Lock_Array.hpp>
+#include <desul/atomics/Operator_Function_Objects.hpp>
 #include <desul/atomics/Thread_Fence.hpp>
 #include <type_traits>
 
 namespace desul {
 namespace Impl {
 
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+// Returns the old value and stores the new one in newval
+template <class Oper, class T>
+inline T host_atomic_fetch_oper_cmpxchg16b(const Oper& op,
+                                           T* const dest,
+                                           const T& val,
+                                           T& newval) {
+  auto* const ptr = reinterpret_cast<host_atomic_uint128_t*>(dest);
+  host_atomic_uint128_t oldval = *ptr;
+  host_atomic_uint128_t assume;
+  do {
+    T const current = host_atomic_from_uint128(oldval, val);
+    if (check_early_exit(op, current, val)) {
+      newval = current;
+      return current;
+    }
+    assume = oldval;
+    newval = op.apply(current, val);
+    oldval = host_atomic_cmpxchg16b(ptr, assume, host_atomic_to_uint128(newval));
+  } while (assume != oldval);
+  return host_atomic_from_uint128(oldval, val);
+}
+#endif
+
 template <class Oper,
           class T,
           class MemoryOrder,
@@ -29,6 +54,14 @@ inline T host_atomic_fetch_oper(const Oper& op,
                                 dont_deduce_this_parameter_t<const T> val,
                                 MemoryOrder /*order*/,
                                 MemoryScope scope) {
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+  if constexpr (host_atomic_cmpxchg16b_eligible<T>::value) {
+    if (host_atomic_is_16byte_aligned(dest)) {
+      T newval = val;
+      return host_atomic_fetch_oper_cmpxchg16b(op, dest, val, newval);
+    }
+  }
+#endif
   // Acquire a lock for the address
   while (!lock_address((void*)dest, scope)) {
   }
@@ -53,6 +86,15 @@ inline T host_atomic_oper_fetch(const Oper& op,
                                 dont_deduce_this_parameter_t<const T> val,
                                 MemoryOrder /*order*/,
                                 MemoryScope scope) {
+#ifdef DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+  if constexpr (host_atomic_cmpxchg16b_eligible<T>::value) {
+    if (host_atomic_is_16byte_aligned(dest)) {
+      T newval = val;
+      (void)host_atomic_fetch_oper_cmpxchg16b(op, dest, val, newval);
+      return newval;
+    }
+  }
+#endif
   // Acquire a lock for the address
   while (!lock_address((void*)dest, scope)) {
   }
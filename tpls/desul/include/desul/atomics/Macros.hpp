@@ -62,6 +62,18 @@ SPDX-License-Identifier: (BSD-3-Clause)
 #define DESUL_HAVE_GCC_ATOMICS
 #endif
 
+// Lock-free host atomics for 16-byte types via cmpxchg16b on x86-64.  The
+// __atomic builtins route 16-byte operations through libatomic, but the __sync
+// builtins are expanded inline when the target has CX16 (-mcx16 or an -march
+// implying it).
+#if defined(DESUL_HAVE_GCC_ATOMICS) && defined(__x86_64__) &&      \
+    defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16) &&                \
+    !defined(DESUL_HAVE_16BYTE_COMPARE_AND_SWAP) &&                \
+    !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__) && \
+    !defined(__SYCL_DEVICE_ONLY__)
+#define DESUL_IMPL_HAVE_HOST_CMPXCHG16B
+#endif
+
 // Equivalent to above for MSVC atomics
 #if !defined(DESUL_HAVE_OPENMP_ATOMICS) && defined(_MSC_VER)
 #define DESUL_HAVE_MSVC_ATOMICS